@@ -0,0 +1,82 @@
+#include "Algorithms/ExecutionPolicy.h"
+
+#include "Memory/SharedPointer.h"
+#include "Threading/TaskScheduler.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_BEGIN(Execution)
+
+NAMESPACE_UNNAMED_BEGIN
+
+/**
+ * The fork-join job of a ParallelFor() call, which is shared with the helper tasks, since the helper tasks
+ * that start after all indices have been claimed may still touch it after the calling thread has returned.
+ */
+struct FParallelJob
+{
+	TFunctionRef<void(size_t)> Function;
+
+	size_t Num;
+
+	TAtomic<size_t> Next      = 0;
+	TAtomic<size_t> Completed = 0;
+
+	FORCEINLINE FParallelJob(TFunctionRef<void(size_t)> InFunction, size_t InNum) : Function(InFunction), Num(InNum) { }
+
+	void Work()
+	{
+		size_t Count = 0;
+
+		for (size_t Index; (Index = Next.FetchAdd(1, EMemoryOrder::Relaxed)) < Num; ++Count)
+		{
+			Function(Index);
+		}
+
+		if (Count != 0 && Completed.FetchAdd(Count, EMemoryOrder::AcquireRelease) + Count == Num) Completed.Notify(true);
+	}
+};
+
+NAMESPACE_UNNAMED_END
+
+void ParallelFor(size_t Num, TFunctionRef<void(size_t)> Function)
+{
+	if (Num <= 1)
+	{
+		for (size_t Index = 0; Index != Num; ++Index) Function(Index);
+
+		return;
+	}
+
+	TSharedRef<FParallelJob> Job = MakeShared<FParallelJob>(Function, Num);
+
+	// The calling thread also claims the indices, so at most one helper task is submitted for each worker of the task scheduler.
+	const size_t WorkerNum = Tasks::GetWorkerNum();
+
+	const size_t HelperNum = Num - 1 < WorkerNum ? Num - 1 : WorkerNum;
+
+	for (size_t Index = 0; Index != HelperNum; ++Index)
+	{
+		Tasks::Submit([Job] { Job->Work(); });
+	}
+
+	Job->Work();
+
+	// Runs the other tasks while the claimed indices are running, which also runs the helper tasks that have not started.
+	while (true)
+	{
+		const size_t Completed = Job->Completed.Load(EMemoryOrder::Acquire);
+
+		if (Completed == Num) break;
+
+		if (!Tasks::TryRunTask()) Job->Completed.Wait(Completed, EMemoryOrder::Acquire);
+	}
+}
+
+NAMESPACE_END(Execution)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -12,6 +12,8 @@ NAMESPACE_UNNAMED_BEGIN
 
 TAtomic<uint32> GRandState = 586103306;
 
+TAtomic<uint64> GThreadEngineNum = 0;
+
 NAMESPACE_UNNAMED_END
 
 uint32 Seed(uint32 InSeed)
@@ -44,6 +46,13 @@ uint32 Rand()
 	return Result % 0x7FFFFFFF;
 }
 
+FXoshiro256StarStar& ThreadEngine()
+{
+	thread_local FXoshiro256StarStar Engine(static_cast<uint64>(GRandState.Load(EMemoryOrder::Relaxed)) << 32 ^ GThreadEngineNum.FetchAdd(1, EMemoryOrder::Relaxed));
+
+	return Engine;
+}
+
 NAMESPACE_END(Math)
 
 NAMESPACE_MODULE_END(Utility)
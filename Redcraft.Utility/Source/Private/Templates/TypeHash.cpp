@@ -0,0 +1,31 @@
+#include "Templates/TypeHash.h"
+
+#include <ctime>
+#include <random>
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+uint64 GetProcessHashSeed()
+{
+	static const uint64 Seed = []
+	{
+		NAMESPACE_STD::random_device Device;
+
+		uint64 Result = static_cast<uint64>(Device()) << 32 | Device();
+
+		// Mix in the time and the randomized addresses in case the random device is deterministic on this platform.
+		Result = NAMESPACE_PRIVATE::HashMix(Result ^ static_cast<uint64>(NAMESPACE_STD::time(nullptr)), NAMESPACE_PRIVATE::HashSecret[1]);
+		Result = NAMESPACE_PRIVATE::HashMix(Result ^ reinterpret_cast<uintptr>(&Result),                NAMESPACE_PRIVATE::HashSecret[2]);
+		Result = NAMESPACE_PRIVATE::HashMix(Result ^ reinterpret_cast<uintptr>(&GetProcessHashSeed),    NAMESPACE_PRIVATE::HashSecret[3]);
+
+		return Result;
+	}();
+
+	return Seed;
+}
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
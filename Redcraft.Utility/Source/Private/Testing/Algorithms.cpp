@@ -3,6 +3,7 @@
 #include "Algorithms/Algorithms.h"
 #include "Containers/Array.h"
 #include "Containers/List.h"
+#include "Iterators/InsertIterator.h"
 #include "Ranges/Factory.h"
 #include "Numerics/Math.h"
 #include "Miscellaneous/AssertionMacros.h"
@@ -351,6 +352,1066 @@ void TestSearch()
 		always_check(Algorithms::EndsWith(Brr, Ranges::Iota(0, 2), { }, Projection));
 		always_check(Algorithms::EndsWith(Crr, Ranges::Iota(0, 2), { }, Projection));
 	}
+	{
+		auto Test = []<typename T>(TInPlaceType<T>)
+		{
+			// The explicit predicate selects the element-wise versions as the reference.
+			auto EqualTo = [](T A, T B) { return A == B; };
+
+			TArray<T> Arr(300);
+
+			for (size_t Index = 0; Index != Arr.Num(); ++Index) Arr[Index] = static_cast<T>(Index % 7 == 3 ? 0x5A : (Index * 13 + 1) % 0x50);
+
+			for (size_t First = 0; First != 9; ++First)
+			{
+				for (size_t Num : { 0, 1, 15, 16, 17, 31, 32, 33, 64, 127, 200, 291 })
+				{
+					TArrayView<const T> View(Arr.GetData() + First, Num);
+
+					const T Value = static_cast<T>(0x5A);
+
+					always_check(Algorithms::Find    (View, Value) == Algorithms::Find    (View, Value, EqualTo));
+					always_check(Algorithms::Count   (View, Value) == Algorithms::Count   (View, Value, EqualTo));
+					always_check(Algorithms::Contains(View, Value) == Algorithms::Contains(View, Value, EqualTo));
+
+					always_check(Algorithms::Find(View, static_cast<T>(0x7F)) == View.End());
+
+					TArray<T> Brr(View.Begin(), View.End());
+
+					always_check(Algorithms::Equal(View, Brr));
+
+					if (Num == 0) continue;
+
+					Brr[Num / 2] = static_cast<T>(Brr[Num / 2] ^ static_cast<T>(0x40));
+
+					always_check(!Algorithms::Equal(View, Brr));
+
+					auto [IterA, IterB] = Algorithms::Mismatch(View, Brr);
+
+					always_check(IterA - View.Begin() == static_cast<ptrdiff>(Num / 2));
+					always_check(IterB - Brr.Begin()  == static_cast<ptrdiff>(Num / 2));
+
+					always_check(!Algorithms::Equal(View, TArrayView<const T>(Brr.GetData(), Num - 1)));
+				}
+			}
+		};
+
+		Test(InPlaceType<uint8>);
+		Test(InPlaceType<int8>);
+		Test(InPlaceType<int16>);
+		Test(InPlaceType<u16char>);
+		Test(InPlaceType<int32>);
+		Test(InPlaceType<uint64>);
+	}
+}
+
+void TestBinarySearch()
+{
+	{
+		TArray<int32> Arr = { 1, 2, 2, 2, 4, 5, 5, 7, 9, 9 };
+		TList <int32> Brr = { 1, 2, 2, 2, 4, 5, 5, 7, 9, 9 };
+
+		for (int32 Value = 0; Value != 11; ++Value)
+		{
+			auto Test = [Value](auto& Range)
+			{
+				auto Lower = Algorithms::LowerBound(Range, Value);
+				auto Upper = Algorithms::UpperBound(Range, Value);
+
+				always_check(Algorithms::Distance(Ranges::Begin(Range), Lower) == Algorithms::Distance(Ranges::Begin(Range), Algorithms::FindIf(Range, [Value](int32 A) { return A >= Value; })));
+				always_check(Algorithms::Distance(Ranges::Begin(Range), Upper) == Algorithms::Distance(Ranges::Begin(Range), Algorithms::FindIf(Range, [Value](int32 A) { return A >  Value; })));
+
+				auto Equal = Algorithms::EqualRange(Range, Value);
+
+				always_check(Equal.Begin() == Lower && Equal.End() == Upper);
+
+				always_check(Algorithms::BinarySearch(Range, Value) == Algorithms::Contains(Range, Value));
+
+				always_check(Algorithms::LowerBound(Ranges::Begin(Range), Ranges::End(Range), Value) == Lower);
+				always_check(Algorithms::UpperBound(Ranges::Begin(Range), Ranges::End(Range), Value) == Upper);
+			};
+
+			Test(Arr);
+			Test(Brr);
+		}
+
+		TArray<int32> Empty;
+
+		always_check(Algorithms::LowerBound(Empty, 0) == Empty.End());
+		always_check(!Algorithms::BinarySearch(Empty, 0));
+	}
+
+	{
+		struct FEntry { int32 Key; int32 Data; };
+
+		TArray<FEntry> Arr = { { 1, 10 }, { 3, 30 }, { 3, 31 }, { 8, 80 } };
+
+		auto Projection = [](const FEntry& A) { return A.Key; };
+
+		always_check(Algorithms::LowerBound(Arr, 3, { }, Projection)->Data == 30);
+		always_check(Algorithms::UpperBound(Arr, 3, { }, Projection)->Data == 80);
+		always_check(Algorithms::EqualRange(Arr, 3, { }, Projection).Num() == 2);
+		always_check(!Algorithms::BinarySearch(Arr, 4, { }, Projection));
+
+		auto Greater = [](int32 A, int32 B) { return A > B; };
+
+		TArray<int32> Brr = { 9, 7, 7, 3, 1 };
+
+		always_check(Algorithms::LowerBound(Brr, 7, Greater) == Brr.Begin() + 1);
+		always_check(Algorithms::UpperBound(Brr, 7, Greater) == Brr.Begin() + 3);
+	}
+
+	{
+		for (size_t Num : { 0, 1, 2, 3, 7, 8, 15, 16, 17, 100, 1000 })
+		{
+			TArray<int32> Arr(Num);
+			TArray<int32> Brr(Num);
+
+			for (size_t Index = 0; Index != Num; ++Index) Arr[Index] = static_cast<int32>(Index * 2 + 1);
+
+			Algorithms::MakeEytzinger(Arr, Brr);
+
+			for (int32 Value = 0; Value <= static_cast<int32>(Num * 2 + 1); ++Value)
+			{
+				auto Iter = Algorithms::EytzingerLowerBound(Brr, Value);
+				auto Expe = Algorithms::LowerBound(Arr, Value);
+
+				if (Expe == Arr.End()) always_check(Iter == Brr.End());
+
+				else always_check(Iter != Brr.End() && *Iter == *Expe);
+			}
+		}
+	}
+}
+
+void TestSort()
+{
+	uint32 State = 0x2545F491;
+
+	auto Random = [&State]() -> int32
+	{
+		State ^= State << 13;
+		State ^= State >> 17;
+		State ^= State <<  5;
+
+		return static_cast<int32>(State % 1000);
+	};
+
+	auto Pattern = [&Random](TArray<int32>& Arr, size_t Num, int Kind)
+	{
+		Arr.SetNum(Num);
+
+		for (size_t Index = 0; Index != Num; ++Index)
+		{
+			switch (Kind)
+			{
+			case 0:  Arr[Index] = Random();                                               break;
+			case 1:  Arr[Index] = static_cast<int32>(Index);                              break;
+			case 2:  Arr[Index] = static_cast<int32>(Num - Index);                        break;
+			case 3:  Arr[Index] = 7;                                                      break;
+			case 4:  Arr[Index] = static_cast<int32>(Index < Num / 2 ? Index : Num - Index); break;
+			default: Arr[Index] = static_cast<int32>(Index % 16);                         break;
+			}
+		}
+	};
+
+	auto IsPermutation = [](const TArray<int32>& LHS, const TArray<int32>& RHS)
+	{
+		if (LHS.Num() != RHS.Num()) return false;
+
+		int64 SumA = 0, SumB = 0;
+		int64 SqrA = 0, SqrB = 0;
+
+		for (int32 Value : LHS) { SumA += Value; SqrA += static_cast<int64>(Value) * Value; }
+		for (int32 Value : RHS) { SumB += Value; SqrB += static_cast<int64>(Value) * Value; }
+
+		return SumA == SumB && SqrA == SqrB;
+	};
+
+	{
+		int32 Arr[] = { 1, 2, 2, 3 };
+
+		always_check( Algorithms::IsSorted(Arr));
+		always_check(!Algorithms::IsSorted(Arr, [](int32 A, int32 B) { return A > B; }));
+		always_check( Algorithms::IsSorted(Arr, { }, [](int32 A) { return A / 2; }));
+		always_check( Algorithms::IsSorted(Ranges::Iota(0, 8)));
+	}
+
+	{
+		TArray<int32> Arr;
+		TArray<int32> Brr;
+
+		for (size_t Num : { 0, 1, 2, 23, 24, 100, 129, 1000, 5000 })
+		{
+			for (int Kind = 0; Kind != 6; ++Kind)
+			{
+				Pattern(Arr, Num, Kind);
+
+				Brr = Arr;
+				Algorithms::Sort(Brr);
+				always_check(Algorithms::IsSorted(Brr) && IsPermutation(Arr, Brr));
+
+				Brr = Arr;
+				Algorithms::Sort(Brr.Begin(), Brr.End(), [](int32 A, int32 B) { return A > B; });
+				always_check(Algorithms::IsSorted(Brr, [](int32 A, int32 B) { return A > B; }) && IsPermutation(Arr, Brr));
+
+				Brr = Arr;
+				Algorithms::Sort(Brr, { }, [](int32 A) { return -A; });
+				always_check(Algorithms::IsSorted(Brr.Begin(), Brr.End(), { }, [](int32 A) { return -A; }) && IsPermutation(Arr, Brr));
+			}
+		}
+	}
+
+	{
+		struct FPair { int32 Key; int32 Order; };
+
+		TArray<FPair> Arr;
+
+		for (int32 Index = 0; Index != 3000; ++Index) Arr.PushBack({ Random() % 37, Index });
+
+		Algorithms::StableSort(Arr, { }, [](const FPair& A) { return A.Key; });
+
+		for (size_t Index = 1; Index < Arr.Num(); ++Index)
+		{
+			always_check(Arr[Index - 1].Key <= Arr[Index].Key);
+
+			if (Arr[Index - 1].Key == Arr[Index].Key) always_check(Arr[Index - 1].Order < Arr[Index].Order);
+		}
+
+		Algorithms::StableSort(Arr.Begin(), Arr.End(), [](int32 A, int32 B) { return A > B; }, [](const FPair& A) { return A.Key % 3; });
+
+		for (size_t Index = 1; Index < Arr.Num(); ++Index)
+		{
+			always_check(Arr[Index - 1].Key % 3 >= Arr[Index].Key % 3);
+
+			if (Arr[Index - 1].Key % 3 == Arr[Index].Key % 3) always_check(Arr[Index - 1].Key <= Arr[Index].Key);
+		}
+	}
+
+	{
+		TArray<int32> Arr;
+		TArray<int32> Brr;
+		TArray<int32> Crr;
+
+		for (int Kind = 0; Kind != 6; ++Kind)
+		{
+			Pattern(Arr, 1000, Kind);
+
+			Crr = Arr;
+			Algorithms::Sort(Crr);
+
+			for (size_t Middle : { 0, 1, 10, 500, 1000 })
+			{
+				Brr = Arr;
+				Algorithms::PartialSort(Brr, Brr.Begin() + Middle);
+				always_check(Algorithms::IsSorted(Brr.Begin(), Brr.Begin() + Middle) && IsPermutation(Arr, Brr));
+				always_check(Algorithms::Equal(Brr.Begin(), Brr.Begin() + Middle, Crr.Begin(), Crr.Begin() + Middle));
+
+				if (Middle == 1000) continue;
+
+				Brr = Arr;
+				Algorithms::NthElement(Brr.Begin(), Brr.Begin() + Middle, Brr.End());
+				always_check(Brr[Middle] == Crr[Middle] && IsPermutation(Arr, Brr));
+				always_check(Algorithms::AllOf(Brr.Begin(), Brr.Begin() + Middle, [&](int32 A) { return A <= Brr[Middle]; }));
+				always_check(Algorithms::AllOf(Brr.Begin() + Middle, Brr.End(), [&](int32 A) { return A >= Brr[Middle]; }));
+			}
+		}
+	}
+}
+
+void TestRadixSort()
+{
+	uint64 State = 0x9E3779B97F4A7C15;
+
+	auto Random = [&State]() -> uint64
+	{
+		State ^= State << 13;
+		State ^= State >>  7;
+		State ^= State << 17;
+
+		return State;
+	};
+
+	{
+		TArray<int32> Arr;
+
+		for (size_t Num : { 0, 1, 50, 100, 1000, 5000 })
+		{
+			Arr.SetNum(Num);
+
+			for (int32& Value : Arr) Value = static_cast<int32>(Random());
+
+			TArray<int32> Brr = Arr;
+			TArray<int32> Crr = Arr;
+
+			Algorithms::Sort(Brr);
+
+			Algorithms::RadixSort(Arr);
+			always_check(Arr == Brr);
+
+			TArray<int32> Buffer;
+
+			Buffer.SetNum(Num);
+
+			Algorithms::RadixSort(Crr, Buffer, [](int32 A) { return -static_cast<int64>(A); });
+			always_check(Algorithms::IsSorted(Crr, [](int32 A, int32 B) { return A > B; }));
+
+			Algorithms::RadixSort<TInlineAllocator<256>>(Crr.Begin(), Crr.End());
+			always_check(Crr == Brr);
+		}
+	}
+
+	{
+		TArray<double> Arr;
+
+		for (size_t Index = 0; Index != 1000; ++Index) Arr.PushBack(static_cast<double>(static_cast<int64>(Random())) / 1e10);
+
+		Arr.PushBack(0.0);
+		Arr.PushBack(-0.0);
+		Arr.PushBack(-1e300);
+		Arr.PushBack( 1e300);
+
+		Algorithms::RadixSort(Arr);
+
+		always_check(Algorithms::IsSorted(Arr));
+		always_check(Arr[0] == -1e300 && Arr[Arr.Num() - 1] == 1e300);
+
+		TArray<float> Brr = { 3.5f, -1.0f, 0.0f, -2.5f, 1.0f };
+
+		Algorithms::RadixSort(Brr);
+
+		always_check(Brr == TArray<float>({ -2.5f, -1.0f, 0.0f, 1.0f, 3.5f }));
+	}
+
+	{
+		enum class EKey : int8 { A = -3, B = 0, C = 5 };
+
+		struct FPair { EKey Key; uint64 Order; };
+
+		TArray<FPair> Arr;
+
+		for (uint64 Index = 0; Index != 3000; ++Index)
+		{
+			constexpr EKey Keys[] = { EKey::C, EKey::A, EKey::B };
+
+			Arr.PushBack({ Keys[Random() % 3], Index });
+		}
+
+		Algorithms::RadixSort(Arr, [](const FPair& A) { return A.Key; });
+
+		for (size_t Index = 1; Index < Arr.Num(); ++Index)
+		{
+			always_check(Arr[Index - 1].Key <= Arr[Index].Key);
+
+			if (Arr[Index - 1].Key == Arr[Index].Key) always_check(Arr[Index - 1].Order < Arr[Index].Order);
+		}
+	}
+
+	{
+		TArray<FStringView> Arr = { TEXT("banana"), TEXT(""), TEXT("apple"), TEXT("app"), TEXT("banana"), TEXT("cherry"), TEXT("b") };
+
+		for (size_t Index = 0; Index != 2000; ++Index)
+		{
+			constexpr FStringView Words[] = { TEXT("alpha"), TEXT("alphabet"), TEXT("beta"), TEXT("gamma"), TEXT("gam"), TEXT("delta"), TEXT("zeta"), TEXT("") };
+
+			Arr.PushBack(Words[Random() % 8]);
+		}
+
+		TArray<FStringView> Brr = Arr;
+
+		Algorithms::Sort(Brr);
+
+		Algorithms::RadixSort(Arr);
+
+		always_check(Arr == Brr);
+
+		TArray<FU32StringView> Crr = { U"\U0001F600", U"b", U"\u00E9", U"a", U"", U"ab" };
+
+		Algorithms::RadixSort(Crr);
+
+		always_check(Algorithms::IsSorted(Crr));
+	}
+}
+
+void TestMerge()
+{
+	{
+		TArray<int32> Arr = { 1, 2, 2, 4, 5, 5, 5, 8    };
+		TArray<int32> Brr = { 0, 2, 3, 5, 8, 8, 9       };
+		TArray<int32> Crr;
+
+		Crr.SetNum(Arr.Num() + Brr.Num());
+
+		always_check(Algorithms::Merge(Arr, Brr, Crr) == Crr.End());
+		always_check((Crr == TArray<int32>({ 0, 1, 2, 2, 2, 3, 4, 5, 5, 5, 5, 8, 8, 8, 9 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::SetUnion(Arr, Brr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 0, 1, 2, 2, 3, 4, 5, 5, 5, 8, 8, 9 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::SetIntersection(Arr, Brr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 2, 5, 8 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::SetDifference(Arr, Brr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 1, 2, 4, 5, 5 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::SetDifference(Brr, Arr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 0, 3, 8, 9 })));
+
+		Crr.SetNum(3);
+
+		always_check(Algorithms::Merge(Arr, Brr, Crr) == Crr.End());
+		always_check((Crr == TArray<int32>({ 0, 1, 2 })));
+
+		always_check( Algorithms::Includes(Arr, TArray<int32>({ 2, 2, 5, 8 })));
+		always_check(!Algorithms::Includes(Arr, TArray<int32>({ 2, 2, 2    })));
+		always_check(!Algorithms::Includes(Arr, TArray<int32>({ 3          })));
+		always_check( Algorithms::Includes(Arr, TArray<int32>(             )));
+		always_check( Algorithms::Includes(Arr.Begin(), Arr.End(), Brr.Begin(), Brr.Begin()));
+		always_check(!Algorithms::Includes(Arr.Begin(), Arr.End(), Brr.Begin(), Brr.End()));
+
+		Crr.SetNum(Arr.Num() + Brr.Num());
+
+		always_check(Algorithms::Merge(Arr.Begin(), Arr.End(), Brr.Begin(), Brr.End(), Crr) == Crr.End());
+		always_check((Crr == TArray<int32>({ 0, 1, 2, 2, 2, 3, 4, 5, 5, 5, 5, 8, 8, 8, 9 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::SetUnion(Arr.Begin(), Arr.End(), Brr.Begin(), Brr.End(), Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 0, 1, 2, 2, 3, 4, 5, 5, 5, 8, 8, 9 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::SetIntersection(Arr.Begin(), Arr.End(), Brr.Begin(), Brr.End(), Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 2, 5, 8 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::SetDifference(Arr.Begin(), Arr.End(), Brr.Begin(), Brr.End(), Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 1, 2, 4, 5, 5 })));
+	}
+
+	{
+		TList<int32> Arr = { 1, 3, 5, 7 };
+		TList<int32> Brr = { 3, 4, 5    };
+		TArray<int32> Crr;
+
+		Ignore = Algorithms::SetIntersection(Arr, Brr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 3, 5 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::SetUnion(Arr, Brr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check((Crr == TArray<int32>({ 1, 3, 4, 5, 7 })));
+	}
+
+	{
+		struct FPair { int32 Key; int32 Order; };
+
+		TArray<FPair> Arr;
+		TArray<FPair> Brr;
+
+		for (int32 Index = 0; Index != 2000; ++Index) Arr.PushBack({ Index / 4, 0 });
+
+		for (int32 Index = 0; Index != 20; ++Index) Brr.PushBack({ Index * 37 % 600, 1 });
+
+		Algorithms::Sort(Brr, { }, [](const FPair& A) { return A.Key; });
+
+		Brr.PushBack({ 12, 1 });
+
+		Algorithms::Sort(Brr, { }, [](const FPair& A) { return A.Key; });
+
+		TArray<FPair> Crr;
+		TArray<FPair> Drr;
+
+		auto Key = [](const FPair& A) { return A.Key; };
+
+		// The galloping paths must give the same results as the merging path, which is used when the sizes are close.
+		for (size_t Num : { 1, 21, 2000 })
+		{
+			const TArrayView<FPair> Short(Brr.Begin(), Num < Brr.Num() ? Num : Brr.Num());
+
+			Crr.Reset();
+			Drr.Reset();
+
+			Ignore = Algorithms::SetIntersection(Arr, Short, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel), { }, Key, Key);
+
+			TList<FPair> List;
+
+			for (const FPair& Pair : Short) List.PushBack(Pair);
+
+			Ignore = Algorithms::SetIntersection(Arr, List, Ranges::View(MakeBackInserter(Drr), UnreachableSentinel), { }, Key, Key);
+
+			always_check(Crr.Num() == Drr.Num());
+			always_check(Algorithms::Equal(Crr, Drr, [](const FPair& A, const FPair& B) { return A.Key == B.Key && A.Order == B.Order; }));
+			always_check(Algorithms::AllOf(Crr, [](const FPair& A) { return A.Order == 0; }));
+
+			Crr.Reset();
+
+			Ignore = Algorithms::SetIntersection(Short, Arr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel), { }, Key, Key);
+
+			always_check(Crr.Num() == Drr.Num());
+			always_check(Algorithms::AllOf(Crr, [](const FPair& A) { return A.Order == 1; }));
+			always_check(Algorithms::Equal(Crr, Drr, [](const FPair& A, const FPair& B) { return A.Key == B.Key; }));
+		}
+
+		TArray<int32> Err = { 1, 2, 2, 3, 5, 8, 13, 21, 34, 55 };
+		TArray<int32> Frr = { 2, 2, 2, 13 };
+		TArray<int32> Grr;
+
+		for (int32 Index = 0; Index != 1000; ++Index) Grr.PushBack(Index / 3);
+
+		Crr.Reset();
+
+		TArray<int32> Hrr;
+
+		Ignore = Algorithms::SetIntersection(Err, Frr, Ranges::View(MakeBackInserter(Hrr), UnreachableSentinel));
+		always_check((Hrr == TArray<int32>({ 2, 2, 13 })));
+
+		Hrr.Reset();
+
+		Ignore = Algorithms::SetIntersection(Frr, Grr, Ranges::View(MakeBackInserter(Hrr), UnreachableSentinel));
+		always_check((Hrr == TArray<int32>({ 2, 2, 2, 13 })));
+
+		Hrr.Reset();
+
+		Ignore = Algorithms::SetIntersection(Grr, Frr, Ranges::View(MakeBackInserter(Hrr), UnreachableSentinel));
+		always_check((Hrr == TArray<int32>({ 2, 2, 2, 13 })));
+	}
+
+	{
+		struct FPair { int32 Key; int32 Order; };
+
+		TArray<TArray<FPair>> Inputs;
+
+		Inputs.SetNum(7);
+
+		size_t Total = 0;
+
+		for (size_t Index = 0; Index != Inputs.Num(); ++Index)
+		{
+			for (int32 Value = 0; Value != static_cast<int32>(Index * 5); ++Value)
+			{
+				Inputs[Index].PushBack({ Value * static_cast<int32>(Index + 1) % 17, static_cast<int32>(Index) });
+			}
+
+			Algorithms::StableSort(Inputs[Index], { }, [](const FPair& A) { return A.Key; });
+
+			Total += Inputs[Index].Num();
+		}
+
+		TArray<FPair> Arr;
+
+		Ignore = Algorithms::MultiwayMerge(Inputs, Ranges::View(MakeBackInserter(Arr), UnreachableSentinel), { }, [](const FPair& A) { return A.Key; });
+
+		TArray<FPair> Brr;
+
+		for (const TArray<FPair>& Input : Inputs) for (const FPair& Pair : Input) Brr.PushBack(Pair);
+
+		Algorithms::StableSort(Brr, { }, [](const FPair& A) { return A.Key; });
+
+		always_check(Arr.Num() == Total);
+		always_check(Algorithms::Equal(Arr, Brr, [](const FPair& A, const FPair& B) { return A.Key == B.Key && A.Order == B.Order; }));
+
+		TArray<FPair> Crr;
+
+		Crr.SetNum(10);
+
+		always_check(Algorithms::MultiwayMerge<TInlineAllocator<8>>(Inputs, Crr, { }, [](const FPair& A) { return A.Key; }) == Crr.End());
+		always_check(Algorithms::Equal(Crr, TArrayView<FPair>(Brr.Begin(), 10), [](const FPair& A, const FPair& B) { return A.Key == B.Key && A.Order == B.Order; }));
+
+		Arr.Reset();
+
+		Ignore = Algorithms::MultiwayMerge(Inputs.Begin(), Inputs.End(), Ranges::View(MakeBackInserter(Arr), UnreachableSentinel), { }, [](const FPair& A) { return A.Key; });
+
+		always_check(Algorithms::Equal(Arr, Brr, [](const FPair& A, const FPair& B) { return A.Key == B.Key && A.Order == B.Order; }));
+
+		TArray<TArray<int32>> Single = { { 1, 2, 3 } };
+		TArray<int32>         Drr;
+
+		Ignore = Algorithms::MultiwayMerge(Single, Ranges::View(MakeBackInserter(Drr), UnreachableSentinel));
+		always_check((Drr == TArray<int32>({ 1, 2, 3 })));
+
+		TArray<TArray<int32>> Empty;
+
+		always_check(Algorithms::MultiwayMerge(Empty, Drr) == Drr.Begin());
+	}
+}
+
+void TestNumeric()
+{
+	{
+		TArray<int32> Arr = { 1, 2, 3, 4, 5 };
+		TList<int32>  Brr = { 1, 2, 3, 4, 5 };
+
+		always_check(Algorithms::Reduce(Arr, 0) == 15);
+		always_check(Algorithms::Reduce(Brr, 0) == 15);
+		always_check(Algorithms::Reduce(Arr, 10, [](int32 A, int32 B) { return A * B; }) == 1200);
+		always_check(Algorithms::Reduce(Arr, 0, { }, [](int32 A) { return A * A; }) == 55);
+		always_check(Algorithms::Reduce(Arr.Begin(), Arr.End(), static_cast<int64>(1)) == 16);
+		always_check(Algorithms::Reduce(TArray<int32>(), 7) == 7);
+
+		always_check(Algorithms::TransformReduce(Arr, Brr, 0) == 55);
+		always_check(Algorithms::TransformReduce(Arr, TArray<int32>({ 1, 1, 1 }), 0) == 6);
+		always_check(Algorithms::TransformReduce(Arr.Begin(), Arr.End(), Arr.Begin(), Arr.End(), 0, { }, [](int32 A, int32 B) { return A + B; }) == 30);
+
+		TArray<int32> Crr;
+
+		Crr.SetNum(5);
+
+		always_check(Algorithms::InclusiveScan(Arr, Crr) == Crr.End());
+		always_check((Crr == TArray<int32>({ 1, 3, 6, 10, 15 })));
+
+		always_check(Algorithms::ExclusiveScan(Brr, Crr, 0) == Crr.End());
+		always_check((Crr == TArray<int32>({ 0, 1, 3, 6, 10 })));
+
+		always_check(Algorithms::AdjacentDifference(Crr, Crr) == Crr.End());
+		always_check((Crr == TArray<int32>({ 0, 1, 2, 3, 4 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::InclusiveScan(Brr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel), [](int32 A, int32 B) { return A * B; });
+		always_check((Crr == TArray<int32>({ 1, 2, 6, 24, 120 })));
+
+		Crr.SetNum(3);
+
+		always_check(Algorithms::ExclusiveScan(Arr, Crr, 1, { }, [](int32 A) { return A * 2; }) == Crr.End());
+		always_check((Crr == TArray<int32>({ 1, 3, 7 })));
+
+		always_check(Algorithms::InclusiveScan(Arr, Arr) == Arr.End());
+		always_check((Arr == TArray<int32>({ 1, 3, 6, 10, 15 })));
+
+		always_check(Algorithms::ExclusiveScan(Arr, Arr, 0) == Arr.End());
+		always_check((Arr == TArray<int32>({ 0, 1, 4, 10, 20 })));
+	}
+
+	{
+		TArray<float> Arr;
+
+		Arr.SetNum(1000000);
+
+		for (float& Value : Arr) Value = 0.1f;
+
+		always_check(Math::Abs(Algorithms::Reduce(Arr, 0.0f) - 100000.0f) < 1.0f);
+		always_check(Math::Abs(Algorithms::TransformReduce(Arr, Arr, 0.0f) - 10000.0f) < 0.1f);
+
+		always_check(Math::Abs(Algorithms::Reduce(Execution::Parallel, Arr, 0.0f) - 100000.0f) < 1.0f);
+	}
+
+	{
+		TArray<int64> Arr;
+
+		Arr.SetNum(300000);
+
+		for (size_t Index = 0; Index != Arr.Num(); ++Index) Arr[Index] = static_cast<int64>(Index * 7 % 1000) - 500;
+
+		const int64 Sum = Algorithms::Reduce(Arr, static_cast<int64>(0), [](int64 A, int64 B) { return A + B; });
+
+		always_check(Algorithms::Reduce(Arr, static_cast<int64>(0)) == Sum);
+		always_check(Algorithms::Reduce(Execution::Parallel, Arr, static_cast<int64>(0)) == Sum);
+		always_check(Algorithms::Reduce(Execution::Sequenced, Arr.Begin(), Arr.End(), static_cast<int64>(0)) == Sum);
+		always_check(Algorithms::Reduce(Execution::Parallel, Arr, static_cast<int64>(0), { }, [](int64 A) { return -A; }) == -Sum);
+
+		always_check(Algorithms::TransformReduce(Execution::Parallel, Arr, Arr, static_cast<int64>(0)) == Algorithms::TransformReduce(Arr, Arr, static_cast<int64>(0)));
+
+		TArray<int64> Brr;
+		TArray<int64> Crr;
+
+		Brr.SetNum(Arr.Num());
+		Crr.SetNum(Arr.Num());
+
+		Ignore = Algorithms::InclusiveScan(Arr, Brr);
+		always_check(Algorithms::InclusiveScan(Execution::Parallel, Arr, Crr) == Crr.End());
+		always_check(Brr == Crr);
+
+		Ignore = Algorithms::ExclusiveScan(Arr, Brr, static_cast<int64>(3));
+		always_check(Algorithms::ExclusiveScan(Execution::Parallel, Arr, Crr, static_cast<int64>(3)) == Crr.End());
+		always_check(Brr == Crr);
+
+		Ignore = Algorithms::AdjacentDifference(Arr, Brr);
+		always_check(Algorithms::AdjacentDifference(Execution::Parallel, Arr, Crr) == Crr.End());
+		always_check(Brr == Crr);
+
+		Crr = Arr;
+
+		always_check(Algorithms::AdjacentDifference(Execution::Parallel, Crr, Crr) == Crr.End());
+		always_check(Brr == Crr);
+
+		always_check(Algorithms::InclusiveScan(Execution::Parallel, Crr, Crr) == Crr.End());
+		always_check(Arr == Crr);
+	}
+}
+
+void TestMutation()
+{
+	{
+		TArray<int32> Arr = { 1, 2, 3, 4, 5 };
+		TList<int32>  Brr = { 1, 2, 3, 4, 5 };
+		TArray<int32> Crr;
+
+		Crr.SetNum(3);
+
+		always_check(Algorithms::Copy(Arr, Crr) == Crr.End());
+		always_check((Crr == TArray<int32>({ 1, 2, 3 })));
+
+		Crr = { 0, 0, 0, 0, 0, 0, 0 };
+
+		always_check(Algorithms::Copy(Brr, Crr) == Crr.Begin() + 5);
+		always_check((Crr == TArray<int32>({ 1, 2, 3, 4, 5, 0, 0 })));
+
+		TArrayView<int32> Source(Crr.Begin(), 5);
+		TArrayView<int32> Target(Crr.Begin() + 2, 5);
+
+		always_check(Algorithms::Copy(Source, Target) == Target.End());
+		always_check((Crr == TArray<int32>({ 1, 2, 1, 2, 3, 4, 5 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::Move(Brr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel));
+		always_check(Crr == Arr);
+
+		always_check(Algorithms::Fill(Crr, 0) == Crr.End());
+		always_check((Crr == TArray<int32>({ 0, 0, 0, 0, 0 })));
+
+		always_check(Algorithms::Fill(Crr.Begin(), Crr.Begin() + 2, 258) == Crr.Begin() + 2);
+		always_check((Crr == TArray<int32>({ 258, 258, 0, 0, 0 })));
+
+		always_check(Algorithms::Fill(Brr, 7) == Brr.End());
+		always_check((Brr == TList<int32>({ 7, 7, 7, 7, 7 })));
+
+		TArray<float> Drr = { 1.0f, 2.0f };
+
+		Ignore = Algorithms::Fill(Drr, -0.0f);
+		always_check(Drr[0] == 0.0f && 1.0f / Drr[1] < 0.0f);
+
+		Crr.SetNum(5);
+
+		always_check(Algorithms::Transform(Arr, Crr, [](int32 A) { return A * 2; }) == Crr.End());
+		always_check((Crr == TArray<int32>({ 2, 4, 6, 8, 10 })));
+
+		always_check(Algorithms::Transform(Arr, Crr, Crr, [](int32 A, int32 B) { return A + B; }) == Crr.End());
+		always_check((Crr == TArray<int32>({ 3, 6, 9, 12, 15 })));
+
+		Crr.Reset();
+
+		Ignore = Algorithms::Transform(Arr, Ranges::View(MakeBackInserter(Crr), UnreachableSentinel), [](int32 A) { return A; }, [](int32 A) { return -A; });
+		always_check((Crr == TArray<int32>({ -1, -2, -3, -4, -5 })));
+	}
+
+	{
+		TArray<int32> Arr = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		TList<int32>  Brr = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+		auto IsEven = [](int32 A) { return A % 2 == 0; };
+
+		always_check(Algorithms::RemoveIf(Arr, IsEven) == Arr.Begin() + 4);
+		always_check(Algorithms::Equal(TArrayView<int32>(Arr.Begin(), 4), TArray<int32>({ 1, 3, 5, 7 })));
+
+		auto Iter = Algorithms::RemoveIf(Brr, IsEven);
+		always_check((TArray<int32>(Brr.Begin(), Iter) == TArray<int32>({ 1, 3, 5, 7 })));
+
+		Arr = { 1, 1, 2, 3, 3, 3, 1 };
+
+		always_check(Algorithms::Remove(Arr, 1) == Arr.Begin() + 4);
+		always_check(Algorithms::Equal(TArrayView<int32>(Arr.Begin(), 4), TArray<int32>({ 2, 3, 3, 3 })));
+
+		Arr = { 1, 1, 2, 3, 3, 3, 1 };
+
+		always_check(Algorithms::Unique(Arr) == Arr.Begin() + 4);
+		always_check(Algorithms::Equal(TArrayView<int32>(Arr.Begin(), 4), TArray<int32>({ 1, 2, 3, 1 })));
+
+		Arr = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+		always_check(Algorithms::Unique(Arr.Begin(), Arr.End(), { }, [](int32 A) { return A / 3; }) == Arr.Begin() + 3);
+		always_check(Algorithms::Equal(TArrayView<int32>(Arr.Begin(), 3), TArray<int32>({ 1, 3, 6 })));
+
+		TArray<TArray<int32>> Crr = { { 1 }, { 2, 2 }, { }, { 3 }, { 4, 4 } };
+
+		always_check(Algorithms::RemoveIf(Crr, [](const TArray<int32>& A) { return A.Num() != 1; }) == Crr.Begin() + 2);
+		always_check((Crr[0] == TArray<int32>({ 1 }) && Crr[1] == TArray<int32>({ 3 })));
+
+		TArray<int32> Drr = { 1, 1, 4, 5, 1, 4, 1, 2, 2, 3, 4, 4 };
+
+		Drr.RemoveAllIf(IsEven);
+		always_check((Drr == TArray<int32>({ 1, 1, 5, 1, 1, 3 })));
+	}
+
+	{
+		TArray<int32> Arr = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		TList<int32>  Brr = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+		auto IsOdd = [](int32 A) { return A % 2 == 1; };
+
+		auto IterA = Algorithms::Partition(Arr, IsOdd);
+		always_check(IterA == Arr.Begin() + 5);
+		always_check(Algorithms::AllOf(Arr.Begin(), IterA, IsOdd) && Algorithms::NoneOf(IterA, Arr.End(), IsOdd));
+
+		auto IterB = Algorithms::Partition(Brr, IsOdd);
+		always_check(Algorithms::AllOf(Brr.Begin(), IterB, IsOdd) && Algorithms::NoneOf(IterB, Brr.End(), IsOdd));
+		always_check(Algorithms::Count(Brr.Begin(), IterB, 1) + Algorithms::Count(Brr.Begin(), IterB, 9) == 2);
+
+		TArray<int32> Crr;
+
+		Crr.SetNum(200);
+
+		for (size_t Num : { 0, 1, 2, 7, 100, 200 })
+		{
+			for (size_t Middle = 0; Middle <= Num; Middle += Num / 5 + 1)
+			{
+				for (size_t Index = 0; Index != Crr.Num(); ++Index) Crr[Index] = static_cast<int32>(Index);
+
+				TArray<TArray<int32>> Drr;
+				TList<int32>          Err;
+
+				for (size_t Index = 0; Index != Num; ++Index) Drr.PushBack({ static_cast<int32>(Index) });
+				for (size_t Index = 0; Index != Num; ++Index) Err.PushBack(static_cast<int32>(Index));
+
+				auto Iter = Algorithms::Rotate(Crr.Begin(), Crr.Begin() + Middle, Crr.Begin() + Num);
+				always_check(Iter == Crr.Begin() + (Num - Middle));
+
+				Ignore = Algorithms::Rotate(Drr, Drr.Begin() + Middle);
+
+				Ignore = Algorithms::Rotate(Err, Algorithms::Next(Err.Begin(), Middle));
+
+				auto ErrIter = Err.Begin();
+
+				for (size_t Index = 0; Index != Num; ++Index, ++ErrIter)
+				{
+					always_check(Crr[Index] == static_cast<int32>((Index + Middle) % Num));
+					always_check(Drr[Index][0] == Crr[Index]);
+					always_check(*ErrIter == Crr[Index]);
+				}
+			}
+		}
+	}
+}
+
+void TestShuffle()
+{
+	{
+		FXoshiro256StarStar Engine(1);
+
+		TArray<int32> Arr;
+
+		for (int32 Index = 0; Index != 100; ++Index) Arr.PushBack(Index);
+
+		always_check(Algorithms::Shuffle(Arr, Engine) == Arr.End());
+
+		always_check(!Algorithms::IsSorted(Arr));
+
+		Algorithms::Sort(Arr);
+
+		for (int32 Index = 0; Index != 100; ++Index) always_check(Arr[Index] == Index);
+
+		TArray<int32> Brr;
+
+		always_check(Algorithms::Shuffle(Brr.Begin(), Brr.End(), Engine) == Brr.End());
+	}
+
+	{
+		FPCG64 Engine(2);
+
+		size_t Counts[6] = { };
+
+		for (size_t Round = 0; Round != 60000; ++Round)
+		{
+			int32 Arr[] = { 0, 1, 2 };
+
+			Algorithms::Shuffle(Arr, Engine);
+
+			++Counts[Arr[0] * 2 + (Arr[1] > Arr[2])];
+		}
+
+		for (size_t Count : Counts) always_check(Count > 9000 && Count < 11000);
+	}
+
+	{
+		FXoshiro256StarStar Engine(3);
+
+		TArray<int32> Arr = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+		size_t Counts[10] = { };
+
+		for (size_t Round = 0; Round != 10000; ++Round)
+		{
+			TArray<int32> Brr;
+
+			Algorithms::Sample(Arr, Ranges::View(MakeBackInserter(Brr), UnreachableSentinel), 3, Engine);
+
+			always_check(Brr.Num() == 3);
+			always_check(Brr[0] < Brr[1] && Brr[1] < Brr[2]);
+
+			for (int32 Value : Brr) ++Counts[Value];
+		}
+
+		for (size_t Count : Counts) always_check(Count > 2700 && Count < 3300);
+
+		TArray<int32> Brr;
+
+		Algorithms::Sample(Arr.Begin(), Arr.End(), Ranges::View(MakeBackInserter(Brr), UnreachableSentinel), 20, Engine);
+
+		always_check(Brr == Arr);
+
+		int32 Crr[4];
+
+		always_check(Algorithms::Sample(Arr, Crr, 8, Engine) == Crr + 4);
+	}
+
+	{
+		FXoshiro256StarStar Engine(4);
+
+		TList<int32> Arr;
+
+		for (int32 Index = 0; Index != 100; ++Index) Arr.PushBack(Index);
+
+		auto View = Ranges::View(Arr.Begin(), Arr.End());
+
+		static_assert(!CSizedRange<decltype(View)>);
+
+		size_t Counts[100] = { };
+
+		for (size_t Round = 0; Round != 10000; ++Round)
+		{
+			int32 Brr[10];
+
+			always_check(Algorithms::Sample(View, Brr, 10, Engine) == Brr + 10);
+
+			Algorithms::Sort(Brr);
+
+			always_check(Algorithms::Unique(Brr) == Brr + 10);
+
+			for (int32 Value : Brr) ++Counts[Value];
+		}
+
+		for (size_t Count : Counts) always_check(Count > 800 && Count < 1200);
+
+		int32 Crr[200];
+
+		always_check(Algorithms::Sample(View, Crr, 200, Engine) == Crr + 100);
+
+		Algorithms::Sort(Crr, Crr + 100);
+
+		for (int32 Index = 0; Index != 100; ++Index) always_check(Crr[Index] == Index);
+	}
+}
+
+void TestExecution()
+{
+	{
+		TArray<TAtomic<uint32>> Visits(100000);
+
+		for (TAtomic<uint32>& Visit : Visits) Visit.Store(0);
+
+		Execution::ParallelFor(Visits.Num(), [&Visits](size_t Index)
+		{
+			Ignore = Visits[Index].FetchAdd(1);
+
+			// The nested call runs on the calling thread only.
+			if (Index % 10000 == 0) Execution::ParallelFor(4, [&Visits, Index](size_t Nested) { Ignore = Visits[Index + Nested + 1].FetchAdd(1); });
+		});
+
+		for (size_t Index = 0; Index != Visits.Num(); ++Index)
+		{
+			always_check(Visits[Index].Load() == (Index % 10000 >= 1 && Index % 10000 <= 4 ? 2u : 1u));
+		}
+	}
+
+	uint32 State = 0x2545F491;
+
+	auto Random = [&State]() -> int32
+	{
+		State ^= State << 13;
+		State ^= State >> 17;
+		State ^= State <<  5;
+
+		return static_cast<int32>(State % 100000);
+	};
+
+	TArray<int32> Arr(1 << 20);
+
+	for (int32& Element : Arr) Element = Random();
+
+	{
+		auto Even = [](int32 A) { return A % 2 == 0; };
+		auto Less = [](int32 A) { return A < 100000; };
+
+		always_check(Algorithms::AllOf (Execution::Parallel, Arr, Less));
+		always_check(!Algorithms::AllOf(Execution::Parallel, Arr, Even));
+		always_check(Algorithms::AnyOf (Execution::Parallel, Arr, Even));
+		always_check(Algorithms::NoneOf(Execution::Parallel, Arr, [](int32 A) { return A < 0; }));
+
+		always_check(Algorithms::CountIf(Execution::Parallel, Arr, Even) == Algorithms::CountIf(Arr, Even));
+		always_check(Algorithms::Count(Execution::ParallelUnsequenced, Arr, 42) == Algorithms::Count(Arr, 42));
+		always_check(Algorithms::Count(Execution::Sequenced, Arr, 42) == Algorithms::Count(Arr, 42));
+
+		const int32 Last = Arr[Arr.Num() - 1];
+
+		always_check(Algorithms::Find(Execution::Parallel, Arr, Arr[0]) == Arr.Begin());
+		always_check(Algorithms::Find(Execution::Parallel, Arr, Last) == Algorithms::Find(Arr, Last));
+		always_check(Algorithms::Find(Execution::Parallel, Arr, -1) == Arr.End());
+		always_check(Algorithms::FindIfNot(Execution::Parallel, Arr.Begin(), Arr.End(), Less) == Arr.End());
+		always_check(Algorithms::Contains(Execution::Parallel, Arr, Last));
+		always_check(!Algorithms::Contains(Execution::Parallel, Arr, 100000));
+	}
+
+	{
+		TArray<int32> Brr = Arr;
+
+		always_check(Algorithms::Equal(Execution::Parallel, Arr, Brr));
+
+		Brr[Brr.Num() - 7] = -1;
+		Brr[Brr.Num() - 3] = -1;
+
+		always_check(!Algorithms::Equal(Execution::Parallel, Arr, Brr));
+
+		auto [IterA, IterB] = Algorithms::Mismatch(Execution::Parallel, Arr, Brr);
+
+		always_check(IterB == Brr.End() - 7);
+
+		always_check(!Algorithms::Equal(Execution::Parallel, Arr, TArrayView<int32>(Brr.GetData(), Brr.Num() - 1)));
+	}
+
+	{
+		TArray<int32> Brr = Arr;
+		TArray<int32> Crr = Arr;
+
+		Algorithms::Sort(Brr);
+		Algorithms::Sort(Execution::Parallel, Crr);
+
+		always_check(Brr == Crr);
+
+		Algorithms::Sort(Execution::Parallel, Crr.Begin(), Crr.End(), [](int32 A, int32 B) { return A > B; });
+
+		always_check(Algorithms::IsSorted(Crr, [](int32 A, int32 B) { return A > B; }));
+
+		Crr = Arr;
+
+		Algorithms::Sort(Execution::Parallel, TArrayView<int32>(Crr.GetData(), 1000));
+
+		always_check(Algorithms::IsSorted(TArrayView<int32>(Crr.GetData(), 1000)));
+	}
+
+	{
+		struct FPair { int32 Key; int32 Order; };
+
+		TArray<FPair> Brr(Arr.Num());
+
+		for (size_t Index = 0; Index != Arr.Num(); ++Index) Brr[Index] = { Arr[Index] % 1000, static_cast<int32>(Index) };
+
+		TArray<FPair> Crr = Brr;
+
+		Algorithms::StableSort(Brr, { }, [](const FPair& A) { return A.Key; });
+		Algorithms::StableSort(Execution::Parallel, Crr, { }, [](const FPair& A) { return A.Key; });
+
+		always_check(Algorithms::Equal(Brr, Crr, [](const FPair& A, const FPair& B) { return A.Key == B.Key && A.Order == B.Order; }));
+	}
 }
 
 NAMESPACE_PRIVATE_END
@@ -359,6 +1420,14 @@ void TestAlgorithms()
 {
 	NAMESPACE_PRIVATE::TestBasic();
 	NAMESPACE_PRIVATE::TestSearch();
+	NAMESPACE_PRIVATE::TestBinarySearch();
+	NAMESPACE_PRIVATE::TestSort();
+	NAMESPACE_PRIVATE::TestRadixSort();
+	NAMESPACE_PRIVATE::TestMerge();
+	NAMESPACE_PRIVATE::TestNumeric();
+	NAMESPACE_PRIVATE::TestMutation();
+	NAMESPACE_PRIVATE::TestShuffle();
+	NAMESPACE_PRIVATE::TestExecution();
 }
 
 NAMESPACE_END(Testing)
@@ -89,6 +89,19 @@ void TestArrayTemplate()
 		always_check((Array.Num() == 3));
 	}
 
+	{
+		TArray<int32, Allocator> Array = { 1, 1, 4, 5, 1, 4, 1, 2, 2, 3 };
+
+		always_check(Array.RemoveAllIf([](int32 A) { return A == 1; }) == 4);
+		always_check((Array == TArray<int32, Allocator>({ 4, 5, 4, 2, 2, 3 })));
+
+		always_check(Array.RemoveAllIf([](int32 A) { return A > 5; }) == 0);
+		always_check((Array == TArray<int32, Allocator>({ 4, 5, 4, 2, 2, 3 })));
+
+		always_check(Array.RemoveAllIf([](int32) { return true; }) == 6);
+		always_check((Array.IsEmpty()));
+	}
+
 	{
 		TArray<int32, Allocator> Array = { 1, 2, 3 };
 
@@ -375,6 +388,87 @@ void TestBitset()
 
 		always_check((GetTypeHash(BitsetA) == GetTypeHash(BitsetB)));
 	}
+
+	{
+		FBitset Bitset(200);
+
+		Bitset.Set(false);
+
+		always_check((Bitset.FindFirstSet() == INDEX_NONE));
+
+		Bitset[3]   = true;
+		Bitset[64]  = true;
+		Bitset[130] = true;
+		Bitset[199] = true;
+
+		always_check((Bitset.FindFirstSet()   ==   3));
+		always_check((Bitset.FindNextSet(3)   ==  64));
+		always_check((Bitset.FindNextSet(64)  == 130));
+		always_check((Bitset.FindNextSet(130) == 199));
+		always_check((Bitset.FindNextSet(199) == INDEX_NONE));
+
+		size_t Indices[4];
+		size_t Count = 0;
+
+		for (size_t Index : Bitset.SetBits()) Indices[Count++] = Index;
+
+		always_check((Count == 4));
+		always_check((Indices[0] == 3 && Indices[1] == 64 && Indices[2] == 130 && Indices[3] == 199));
+
+		Bitset.PopBack();
+
+		always_check((Bitset.FindNextSet(130) == INDEX_NONE));
+	}
+
+	{
+		FBitset BitsetA(1000);
+		FBitset BitsetB(700);
+
+		for (size_t Index = 0; Index != BitsetA.Num(); ++Index) BitsetA[Index] = Index % 3 == 0;
+		for (size_t Index = 0; Index != BitsetB.Num(); ++Index) BitsetB[Index] = Index % 5 == 0;
+
+		always_check((BitsetA.AndCount(BitsetB) == 47));
+		always_check((BitsetB.AndCount(BitsetA) == 47));
+
+		FBitset BitsetC = BitsetA; BitsetC.AndNot(BitsetB);
+
+		for (size_t Index = 0; Index != BitsetC.Num(); ++Index)
+		{
+			always_check((BitsetC[Index] == (Index % 3 == 0 && (Index >= 700 || Index % 5 != 0))));
+		}
+
+		FBitset BitsetE = BitsetA << 333;
+		FBitset BitsetF = BitsetA >> 333;
+
+		for (size_t Index = 0; Index != BitsetA.Num(); ++Index)
+		{
+			always_check((BitsetE[Index] == (Index >= 333 && BitsetA[Index - 333])));
+			always_check((BitsetF[Index] == (Index + 333 < BitsetA.Num() && BitsetA[Index + 333])));
+		}
+
+		always_check((!BitsetA.All() && BitsetA.Any()));
+		always_check(((BitsetA | ~BitsetA).All()));
+		always_check(((BitsetA & ~BitsetA).None()));
+	}
+
+	{
+		FBitset Bitset(1500);
+
+		for (size_t Index = 0; Index != Bitset.Num(); ++Index) Bitset[Index] = Index % 3 == 0;
+
+		TRankSelectIndex<FBitset> RankSelect(Bitset);
+
+		always_check((RankSelect.Count() == 500));
+		always_check((RankSelect.Rank(0)    ==   0));
+		always_check((RankSelect.Rank(1)    ==   1));
+		always_check((RankSelect.Rank(600)  == 200));
+		always_check((RankSelect.Rank(1500) == 500));
+
+		always_check((RankSelect.Select(0)   ==    0));
+		always_check((RankSelect.Select(200) ==  600));
+		always_check((RankSelect.Select(499) == 1497));
+		always_check((RankSelect.Select(500) == INDEX_NONE));
+	}
 }
 
 void TestStaticBitset()
@@ -500,6 +594,160 @@ void TestStaticBitset()
 
 		always_check((GetTypeHash(BitsetA) == GetTypeHash(BitsetB)));
 	}
+
+	{
+		TStaticBitset<200> BitsetA;
+		TStaticBitset<200> BitsetB;
+
+		for (size_t Index = 0; Index != BitsetA.Num(); ++Index) BitsetA[Index] = Index % 3 == 0;
+		for (size_t Index = 0; Index != BitsetB.Num(); ++Index) BitsetB[Index] = Index % 5 == 0;
+
+		always_check((BitsetA.AndCount(BitsetB) == 14));
+
+		TStaticBitset<200> BitsetC = BitsetA; BitsetC.AndNot(BitsetB);
+		TStaticBitset<200> BitsetD = BitsetA << 77;
+		TStaticBitset<200> BitsetE = BitsetA >> 77;
+
+		for (size_t Index = 0; Index != BitsetA.Num(); ++Index)
+		{
+			always_check((BitsetC[Index] == (Index % 3 == 0 && Index % 5 != 0)));
+			always_check((BitsetD[Index] == (Index >= 77 && BitsetA[Index - 77])));
+			always_check((BitsetE[Index] == (Index + 77 < BitsetA.Num() && BitsetA[Index + 77])));
+		}
+
+		static_assert((TStaticBitset<100>(0b0110) << 65 >> 64).ToIntegral() == 0b1100);
+		static_assert(TStaticBitset<100>(0b0110).AndNot(TStaticBitset<100>(0b0011)).ToIntegral() == 0b0100);
+	}
+
+	{
+		constexpr TStaticBitset<40> Bitset(0x80'0000'0104ull);
+
+		static_assert(Bitset.FindFirstSet()  ==  2);
+		static_assert(Bitset.FindNextSet(2)  ==  8);
+		static_assert(Bitset.FindNextSet(8)  == 39);
+		static_assert(Bitset.FindNextSet(39) == INDEX_NONE);
+
+		size_t Count = 0;
+
+		for (size_t Index : Bitset.SetBits()) Count += Index;
+
+		always_check((Count == 49));
+
+		TRankSelectIndex<TStaticBitset<40>> RankSelect(Bitset);
+
+		always_check((RankSelect.Rank(9) == 2 && RankSelect.Select(2) == 39));
+	}
+}
+
+void TestCompressedBitset()
+{
+	{
+		constexpr size_t Num = 3 * FCompressedBitset::ChunkWidth + 100;
+
+		FBitset ReferenceA(Num);
+		FBitset ReferenceB(Num);
+
+		for (size_t Index = 0; Index != Num; ++Index)
+		{
+			const size_t Low = Index % FCompressedBitset::ChunkWidth;
+
+			switch (Index / FCompressedBitset::ChunkWidth)
+			{
+			case 0:  ReferenceA[Index] = Low % 7   == 0;               break;
+			case 1:  ReferenceA[Index] = Low % 100 == 0;               break;
+			case 2:  ReferenceA[Index] = Low >= 1000 && Low < 60000;   break;
+			default: ReferenceA[Index] = Index == Num - 1;             break;
+			}
+
+			ReferenceB[Index] = Index % 5 == 0 && Index < 2 * FCompressedBitset::ChunkWidth + 30000;
+		}
+
+		FCompressedBitset BitsetA(ReferenceA);
+		FCompressedBitset BitsetB(ReferenceB);
+
+		always_check(BitsetA.Count() == ReferenceA.Count());
+		always_check(BitsetB.Count() == ReferenceB.Count());
+
+		always_check(BitsetA.ToBitset() == ReferenceA);
+
+		size_t Count = 0;
+
+		for (size_t Index : BitsetA.SetBits())
+		{
+			always_check(ReferenceA[Index]);
+
+			++Count;
+		}
+
+		always_check(Count == ReferenceA.Count());
+
+		const FCompressedBitset BitsetAnd    = BitsetA & BitsetB;
+		const FCompressedBitset BitsetOr     = BitsetA | BitsetB;
+		const FCompressedBitset BitsetXor    = BitsetA ^ BitsetB;
+		const FCompressedBitset BitsetAndNot = FCompressedBitset(BitsetA).AndNot(BitsetB);
+
+		for (size_t Index = 0; Index != Num; ++Index)
+		{
+			const uint32 Value = static_cast<uint32>(Index);
+
+			always_check(BitsetAnd   .Contains(Value) == (ReferenceA[Index] && ReferenceB[Index]));
+			always_check(BitsetOr    .Contains(Value) == (ReferenceA[Index] || ReferenceB[Index]));
+			always_check(BitsetXor   .Contains(Value) == (ReferenceA[Index] != ReferenceB[Index]));
+			always_check(BitsetAndNot.Contains(Value) == (ReferenceA[Index] && !ReferenceB[Index]));
+		}
+
+		always_check(BitsetA.AndCount(BitsetB) == BitsetAnd.Count());
+		always_check(BitsetAnd.Count() + BitsetXor.Count() == BitsetOr.Count());
+
+		TArray<uint8> Bytes;
+		TArray<uint8> OptimizedBytes;
+
+		FCompressedBitset BitsetC = BitsetA;
+
+		BitsetC.Optimize();
+
+		always_check(BitsetC == BitsetA);
+		always_check((BitsetC & BitsetB) == BitsetAnd);
+		always_check((BitsetC ^ BitsetB) == BitsetXor);
+		always_check(BitsetC.AndCount(BitsetB) == BitsetAnd.Count());
+
+		BitsetA.Serialize(Bytes);
+		BitsetC.Serialize(OptimizedBytes);
+
+		always_check(OptimizedBytes.Num() < Bytes.Num());
+
+		FCompressedBitset BitsetD;
+
+		always_check(BitsetD.Deserialize(Bytes) && BitsetD == BitsetA);
+		always_check(BitsetD.Deserialize(OptimizedBytes) && BitsetD == BitsetA);
+
+		OptimizedBytes.PopBack();
+
+		always_check(!BitsetD.Deserialize(OptimizedBytes) && BitsetD.IsEmpty());
+	}
+
+	{
+		FCompressedBitset Bitset = { 4000000000u, 7, 65536, 3 };
+
+		always_check(Bitset.Count() == 4);
+		always_check(Bitset.FindFirstSet() == 3);
+		always_check(Bitset.FindNextSet(7)  == 65536);
+		always_check(Bitset.FindNextSet(65536) == 4000000000u);
+		always_check(Bitset.FindNextSet(4000000000u) == INDEX_NONE);
+
+		for (uint32 Value = 0; Value != 5000; ++Value) Bitset.Add(Value * 2);
+
+		always_check(Bitset.Count() == 5004);
+
+		for (uint32 Value = 0; Value != 5000; Value += 2) Bitset.Remove(Value * 2);
+
+		always_check(Bitset.Count() == 2504);
+		always_check(!Bitset.Contains(0) && Bitset.Contains(2) && Bitset.Contains(3) && Bitset.Contains(4000000000u));
+
+		Bitset.Remove(4000000000u);
+
+		always_check(Bitset.FindNextSet(65536) == INDEX_NONE);
+	}
 }
 
 void TestList()
@@ -604,6 +852,7 @@ void TestContainers()
 	NAMESPACE_PRIVATE::TestArrayView();
 	NAMESPACE_PRIVATE::TestBitset();
 	NAMESPACE_PRIVATE::TestStaticBitset();
+	NAMESPACE_PRIVATE::TestCompressedBitset();
 	NAMESPACE_PRIVATE::TestList();
 }
 
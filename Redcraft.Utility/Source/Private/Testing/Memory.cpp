@@ -5,8 +5,11 @@
 #include "Memory/PointerTraits.h"
 #include "Memory/UniquePointer.h"
 #include "Memory/SharedPointer.h"
+#include "Memory/AtomicSharedPointer.h"
 #include "Memory/MemoryOperator.h"
+#include "Memory/BitwiseOperator.h"
 #include "Memory/InOutPointer.h"
+#include "Threading/TaskScheduler.h"
 #include "Miscellaneous/AssertionMacros.h"
 
 NAMESPACE_REDCRAFT_BEGIN
@@ -239,6 +242,77 @@ void TestMemoryOperator()
 	Memory::Free(PtrB);
 }
 
+void TestBitwiseOperator()
+{
+	{
+		uint8 BufferA[67];
+		uint8 BufferB[67];
+
+		for (size_t Index = 0; Index != 67; ++Index)
+		{
+			BufferA[Index] = static_cast<uint8>(Index * 37);
+			BufferB[Index] = static_cast<uint8>(Index * 91);
+		}
+
+		uint8 BufferC[67]; Memory::Memcpy(BufferC, BufferA); Memory::BitwiseAnd   (BufferC, BufferB, 67);
+		uint8 BufferD[67]; Memory::Memcpy(BufferD, BufferA); Memory::BitwiseOr    (BufferD, BufferB, 67);
+		uint8 BufferE[67]; Memory::Memcpy(BufferE, BufferA); Memory::BitwiseXor   (BufferE, BufferB, 67);
+		uint8 BufferF[67]; Memory::Memcpy(BufferF, BufferA); Memory::BitwiseAndNot(BufferF, BufferB, 67);
+		uint8 BufferG[67]; Memory::Memcpy(BufferG, BufferA); Memory::BitwiseNot   (BufferG,          67);
+
+		size_t Count = 0;
+
+		for (size_t Index = 0; Index != 67; ++Index)
+		{
+			always_check(BufferC[Index] == static_cast<uint8>(BufferA[Index] &  BufferB[Index]));
+			always_check(BufferD[Index] == static_cast<uint8>(BufferA[Index] |  BufferB[Index]));
+			always_check(BufferE[Index] == static_cast<uint8>(BufferA[Index] ^  BufferB[Index]));
+			always_check(BufferF[Index] == static_cast<uint8>(BufferA[Index] & ~BufferB[Index]));
+			always_check(BufferG[Index] == static_cast<uint8>(~BufferA[Index]));
+
+			Count += Math::CountAllOne(BufferC[Index]);
+		}
+
+		always_check(Memory::BitwiseAndCount(BufferA, BufferB, 67) == Count);
+	}
+
+	{
+		uint32 Buffer[37];
+
+		Memory::Memset(Buffer, 0x00);
+		always_check( Memory::IsAllZero(Buffer, 37));
+		always_check(!Memory::IsAllOne (Buffer, 37));
+
+		Buffer[36] = 1;
+		always_check(!Memory::IsAllZero(Buffer, 37));
+		always_check( Memory::IsAllZero(Buffer, 36));
+
+		Memory::Memset(Buffer, 0xFF);
+		always_check( Memory::IsAllOne(Buffer, 37));
+
+		Buffer[20] = 0;
+		always_check(!Memory::IsAllOne(Buffer, 37));
+	}
+
+	{
+		uint16 Buffer[29];
+
+		for (size_t Index = 0; Index != 29; ++Index) Buffer[Index] = static_cast<uint16>(Index == 0 ? 0x8001 : 0);
+
+		Memory::BitwiseShiftLeft(Buffer, 29, 16 * 20 + 3);
+
+		always_check(Buffer[20] == 0x0008 && Buffer[21] == 0x0004);
+
+		Memory::BitwiseShiftRight(Buffer, 29, 16 * 20 + 3);
+
+		always_check(Buffer[0] == 0x8001 && Memory::IsAllZero(Buffer + 1, 28));
+
+		Memory::BitwiseShiftRight(Buffer, 29, 16 * 29);
+
+		always_check(Memory::IsAllZero(Buffer, 29));
+	}
+}
+
 void TestPointerTraits()
 {
 	always_check(!TPointerTraits<int64>::bIsPointer);
@@ -1034,6 +1108,97 @@ void TestSharedPointer()
 
 }
 
+void TestAtomicSharedPointer()
+{
+	static_assert(TAtomicSharedPtr<int32>::bIsAlwaysLockFree);
+
+	{
+		TAtomicSharedPtr<int32> Temp;
+
+		always_check(!Temp.Load().IsValid());
+
+		TSharedPtr<int32> Value = MakeShared<int32>(1);
+
+		Temp.Store(Value);
+
+		always_check(Temp.Load() == Value);
+		always_check(Value.GetSharedReferenceCount() == 2);
+
+		TSharedPtr<int32> Old = Temp.Exchange(MakeShared<int32>(2));
+
+		always_check(Old == Value);
+		always_check(*Temp.Load() == 2);
+		always_check(Value.GetSharedReferenceCount() == 2);
+
+		Old.Reset();
+
+		always_check(Value.GetSharedReferenceCount() == 1);
+
+		TSharedPtr<int32> Expected = Value;
+
+		always_check(!Temp.CompareExchange(Expected, MakeShared<int32>(3)));
+		always_check(*Expected == 2);
+
+		always_check(Temp.CompareExchange(Expected, Value));
+		always_check(Temp.Load() == Value);
+
+		Temp = nullptr;
+
+		always_check(!static_cast<TSharedPtr<int32>>(Temp).IsValid());
+		always_check(Value.GetSharedReferenceCount() == 1);
+
+		Expected = nullptr;
+
+		always_check(Temp.CompareExchange(Expected, Value));
+		always_check(Temp.Load() == Value);
+	}
+
+	{
+		TSharedPtr<int32> Value = MakeShared<int32>(0);
+
+		{
+			TAtomicSharedPtr<int32> Temp = Value;
+
+			always_check(Value.GetSharedReferenceCount() == 2);
+		}
+
+		always_check(Value.GetSharedReferenceCount() == 1);
+	}
+
+	{
+		TAtomicSharedPtr<int32> Temp(MakeShared<int32>(0));
+
+		TAtomic<size_t> Finished = 0;
+
+		constexpr size_t TaskNum = 8;
+
+		// The readers always see a valid snapshot, and the writers increment the snapshot by the compare-exchange.
+		for (size_t Index = 0; Index != TaskNum; ++Index)
+		{
+			Tasks::Submit([&]
+			{
+				for (size_t Inner = 0; Inner != 1000; ++Inner)
+				{
+					TSharedPtr<int32> Expected = Temp.Load();
+
+					always_check(Expected.IsValid());
+
+					if (Inner % 4 != 0) continue;
+
+					while (!Temp.CompareExchange(Expected, MakeShared<int32>(*Expected + 1)));
+				}
+
+				Finished.FetchAdd(1);
+			});
+		}
+
+		Tasks::RunUntil([&] { return Finished.Load() == TaskNum; });
+
+		always_check(*Temp.Load() == TaskNum * 250);
+		always_check(Temp.Load().GetSharedReferenceCount() == 2);
+	}
+}
+
 void TestInOutPointer()
 {
 	{
@@ -1070,9 +1235,11 @@ void TestMemory()
 	NAMESPACE_PRIVATE::TestMemoryBuffer();
 	NAMESPACE_PRIVATE::TestMemoryMalloc();
 	NAMESPACE_PRIVATE::TestMemoryOperator();
+	NAMESPACE_PRIVATE::TestBitwiseOperator();
 	NAMESPACE_PRIVATE::TestPointerTraits();
 	NAMESPACE_PRIVATE::TestUniquePointer();
 	NAMESPACE_PRIVATE::TestSharedPointer();
+	NAMESPACE_PRIVATE::TestAtomicSharedPointer();
 	NAMESPACE_PRIVATE::TestInOutPointer();
 }
 
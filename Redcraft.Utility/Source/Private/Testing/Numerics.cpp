@@ -601,6 +601,112 @@ void TestMath()
 	always_check(static_cast<uint8>(Math::LerpStable(0, 255, 1.0)) == 255);
 }
 
+void TestRandom()
+{
+	static_assert(CUniformRandomBitGenerator<FSplitMix64>);
+	static_assert(CUniformRandomBitGenerator<FXoshiro256StarStar>);
+
+#	if PLATFORM_HAS_INT128
+	static_assert(CUniformRandomBitGenerator<FPCG64>);
+#	endif
+
+	{
+		FSplitMix64 Engine(0);
+
+		always_check(Engine() == 0xE220A8397B1DCDAF);
+		always_check(Engine() == 0x6E789E6AA1B965F4);
+		always_check(Engine() == 0x06C45D188009454F);
+	}
+
+	{
+		FXoshiro256StarStar EngineA(42);
+		FXoshiro256StarStar EngineB(42);
+		FXoshiro256StarStar EngineC(43);
+
+		always_check(EngineA() == EngineB());
+		always_check(EngineA() != EngineC());
+
+		EngineB.Jump();
+
+		always_check(EngineA() != EngineB());
+	}
+
+#	if PLATFORM_HAS_INT128
+	{
+		FPCG64 EngineA(42, 0);
+		FPCG64 EngineB(42, 0);
+		FPCG64 EngineC(42, 1);
+
+		always_check(EngineA() == EngineB());
+		always_check(EngineA() != EngineC());
+
+		// The state and the increment of the engine, the increment must be odd so that the lowest bit of the state alternates.
+		struct FState { uint128 State; uint128 Increment; };
+
+		for (uint64 Stream : { 0u64, 1u64, 2u64, 0xFFFFFFFFFFFFFFFFu64 })
+		{
+			FPCG64 Engine(42, Stream);
+
+			const FState Before = Math::BitCast<FState>(Engine);
+
+			always_check((Before.Increment & 1) == 1);
+
+			Ignore = Engine();
+
+			const FState After = Math::BitCast<FState>(Engine);
+
+			always_check(((Before.State ^ After.State) & 1) == 1);
+		}
+	}
+#	endif
+
+	{
+		FXoshiro256StarStar Engine;
+
+		size_t Counts[10] = { };
+
+		for (size_t Index = 0; Index != 100000; ++Index)
+		{
+			const int32 Value = Math::Rand(Engine, 10);
+
+			always_check(Value >= 0 && Value < 10);
+
+			++Counts[Value];
+		}
+
+		for (size_t Count : Counts) always_check(Count > 9000 && Count < 11000);
+
+		for (size_t Index = 0; Index != 1000; ++Index)
+		{
+			always_check(Math::Rand(Engine, static_cast<uint64>(-1)) < static_cast<uint64>(-1));
+			always_check(Math::Rand(Engine, static_cast<uint8>(3)) < 3);
+
+			const double      Real  = Math::Rand(Engine, 2.0);
+			const float       Float = Math::Rand(Engine, 1.0f);
+			const long double Long  = Math::Rand(Engine, 1.0L);
+
+			always_check(Real  >= 0.0  && Real  < 2.0);
+			always_check(Float >= 0.0f && Float < 1.0f);
+			always_check(Long  >= 0.0L && Long  < 1.0L);
+
+			const auto Within = Math::RandWithin(Engine, -5, 5);
+
+			always_check(Within >= -5 && Within < 5);
+		}
+
+		always_check(Math::Rand(Engine, 0) == 0);
+		always_check(Math::Rand(Engine, 1) == 0);
+	}
+
+	{
+		FXoshiro256StarStar& Engine = Math::ThreadEngine();
+
+		always_check(&Engine == &Math::ThreadEngine());
+
+		always_check(Engine() != Engine());
+	}
+}
+
 NAMESPACE_PRIVATE_END
 
 void TestNumeric()
@@ -608,6 +714,7 @@ void TestNumeric()
 	NAMESPACE_PRIVATE::TestLiteral();
 	NAMESPACE_PRIVATE::TestBit();
 	NAMESPACE_PRIVATE::TestMath();
+	NAMESPACE_PRIVATE::TestRandom();
 }
 
 NAMESPACE_END(Testing)
@@ -453,6 +453,66 @@ void TestMiscView()
 	}
 }
 
+void TestParallel()
+{
+	{
+		TArray<int> Arr = { 0, 1, 2, 3, 4, 5, 6, 7 };
+		TArray<int> Brr = { 0, 4, 8, 12 };
+
+		TArray<int> Crr = Ranges::Parallel(Arr, Ranges::Filter([](int Value) { return Value % 2 == 0; }) | Ranges::Transform([](int Value) { return Value * 2; }));
+
+		TList<int> List = Arr | Ranges::Parallel<TList>(Ranges::Filter([](int Value) { return Value % 2 == 0; }) | Ranges::Transform([](int Value) { return Value * 2; }));
+
+		always_check(Brr == Crr);
+		always_check(List == TList<int>({ 0, 4, 8, 12 }));
+	}
+
+	{
+		TArray<int> Arr = Ranges::Iota(0, 100000) | Ranges::To<TArray<int>>();
+
+		auto Pipeline = Ranges::Filter([](int Value) { return Value % 3 != 0; }) | Ranges::Transform([](int Value) { return static_cast<int64>(Value) * Value; });
+
+		TArray<int64> Brr = Arr | Pipeline | Ranges::To<TArray<int64>>();
+
+		TArray<int64> Crr = Arr | Ranges::Parallel<TArray<int64>>(Pipeline);
+
+		TArray<int64> Drr = Ranges::Parallel(Arr, [](auto Chunk) { return Chunk | Ranges::Transform([](int Value) { return static_cast<int64>(Value); }); });
+
+		always_check(Brr == Crr);
+
+		always_check(Drr.Num() == Arr.Num());
+
+		for (size_t Index = 0; Index != Drr.Num(); ++Index) always_check(Drr[Index] == Arr[Index]);
+	}
+
+	{
+		TArray<int> Arr = Ranges::Iota(0, 100000) | Ranges::To<TArray<int>>();
+
+		auto PipelineA = Ranges::Filter([](int Value) { return Value % 3 != 0; }) | Ranges::Take(50000);
+		auto PipelineB = Ranges::TakeWhile([](int Value) { return Value < 70000; }) | Ranges::Transform([](int Value) { return Value * 2; });
+
+		TArray<int> Brr = Arr | PipelineA | Ranges::To<TArray<int>>();
+		TArray<int> Crr = Arr | PipelineB | Ranges::To<TArray<int>>();
+
+		TArray<int> Drr = Arr | Ranges::Parallel(PipelineA);
+		TArray<int> Err = Arr | Ranges::Parallel(PipelineB);
+
+		always_check(Brr.Num() == 50000);
+		always_check(Crr.Num() == 70000);
+
+		always_check(Brr == Drr);
+		always_check(Crr == Err);
+	}
+
+	{
+		TArray<int> Arr;
+
+		TArray<int> Brr = Arr | Ranges::Parallel(Ranges::Transform([](int Value) { return Value + 1; }));
+
+		always_check(Brr.IsEmpty());
+	}
+}
+
 NAMESPACE_PRIVATE_END
 
 void TestRange()
@@ -462,6 +522,7 @@ void TestRange()
 	NAMESPACE_PRIVATE::TestAllView();
 	NAMESPACE_PRIVATE::TestMoveView();
 	NAMESPACE_PRIVATE::TestMiscView();
+	NAMESPACE_PRIVATE::TestParallel();
 }
 
 NAMESPACE_END(Testing)
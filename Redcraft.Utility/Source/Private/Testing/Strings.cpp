@@ -6,6 +6,7 @@
 #include "Strings/String.h"
 #include "Strings/StringView.h"
 #include "Strings/Convert.h"
+#include "Strings/MultiPatternMatcher.h"
 #include "Miscellaneous/AssertionMacros.h"
 
 NAMESPACE_REDCRAFT_BEGIN
@@ -213,6 +214,137 @@ void TestStringView()
 	Test(InPlaceType<unicodechar>);
 }
 
+void TestMultiPatternMatcher()
+{
+	auto Test = []<typename T>(TInPlaceType<T>)
+	{
+		{
+			TMultiPatternMatcher<T> Matcher = { LITERAL(T, "he"), LITERAL(T, "she"), LITERAL(T, "his"), LITERAL(T, "hers") };
+
+			always_check(Matcher.Num() == 4);
+
+			TArray<typename TMultiPatternMatcher<T>::FMatch> Matches;
+
+			always_check(Matcher.FindAll(LITERAL_VIEW(T, "ushers"), [&](const auto& Match) { Matches.PushBack(Match); }) == 3);
+
+			always_check(Matches.Num() == 3);
+
+			always_check(Matches[0].Pattern == 1 && Matches[0].Position == 1 && Matches[0].Length == 3);
+			always_check(Matches[1].Pattern == 0 && Matches[1].Position == 2 && Matches[1].Length == 2);
+			always_check(Matches[2].Pattern == 3 && Matches[2].Position == 2 && Matches[2].Length == 4);
+
+			always_check( Matcher.Contains(LITERAL_VIEW(T, "this")));
+			always_check(!Matcher.Contains(LITERAL_VIEW(T, "world")));
+			always_check(!Matcher.Contains(LITERAL_VIEW(T, "")));
+
+			always_check(Matcher.FindFirst(LITERAL_VIEW(T, "ushers"))->Pattern == 1);
+			always_check(!Matcher.FindFirst(LITERAL_VIEW(T, "h e")).IsValid());
+
+			always_check(Matcher.FindAll(LITERAL_VIEW(T, "hehehe"), [](const auto&) { return false; }) == 1);
+		}
+
+		{
+			TMultiPatternMatcher<T> Matcher = { LITERAL(T, "a"), LITERAL(T, ""), LITERAL(T, "aa"), LITERAL(T, "a") };
+
+			TArray<size_t> Patterns;
+
+			always_check(Matcher.FindAll(LITERAL_VIEW(T, "aaa"), [&](const auto& Match) { Patterns.PushBack(Match.Pattern); }) == 8);
+
+			always_check(Patterns == TArray<size_t>({ 0, 3, 2, 0, 3, 2, 0, 3 }));
+		}
+
+		{
+			TMultiPatternMatcher<T> Matcher;
+
+			always_check(Matcher.Num() == 0);
+			always_check(Matcher.NumStates() == 1);
+			always_check(!Matcher.Contains(LITERAL_VIEW(T, "Hello")));
+		}
+	};
+
+	Test(InPlaceType<char>);
+	Test(InPlaceType<wchar>);
+	Test(InPlaceType<u8char>);
+	Test(InPlaceType<u16char>);
+	Test(InPlaceType<u32char>);
+	Test(InPlaceType<unicodechar>);
+
+	{
+		const u32char Pattern[] = { 0x1F600, 0x4E2D, 'A' };
+
+		FU32MultiPatternMatcher Matcher = { TStringView<u32char>(Pattern, 3), TStringView<u32char>(Pattern + 1, 1) };
+
+		const u32char Text[] = { 'A', 0x1F600, 0x4E2D, 'A', 0x4E2E, 0x4E2D };
+
+		TArray<size_t> Positions;
+
+		always_check(Matcher.FindAll(TStringView<u32char>(Text, 6), [&](const auto& Match) { Positions.PushBack(Match.Position); }) == 3);
+
+		always_check(Positions == TArray<size_t>({ 2, 1, 5 }));
+	}
+
+	{
+		uint8 Text[] = { 0x00, 0xFF, 0x00, 0xFF, 0x80 };
+
+		TArray<TArray<uint8>> Patterns = { { 0x00, 0xFF }, { 0xFF, 0x80 } };
+
+		FByteMultiPatternMatcher Matcher(Patterns);
+
+		always_check(Matcher.FindAll(TArrayView(Text), [](const auto&) { }) == 3);
+
+		always_check(Matcher.FindFirst(TArrayView(Text))->Position == 0);
+	}
+
+	{
+		uint32 Seed = 0x2545F491;
+
+		auto Random = [&Seed] { Seed ^= Seed << 13; Seed ^= Seed >> 17; Seed ^= Seed << 5; return Seed; };
+
+		for (size_t Round = 0; Round != 64; ++Round)
+		{
+			TArray<FString> Patterns;
+
+			for (size_t Index = Random() % 16; Index != 0; --Index)
+			{
+				FString Pattern;
+
+				for (size_t Length = Random() % 5; Length != 0; --Length) Pattern.PushBack(static_cast<char>('a' + Random() % 3));
+
+				Patterns.PushBack(Pattern);
+			}
+
+			FString Text;
+
+			for (size_t Length = Random() % 256; Length != 0; --Length) Text.PushBack(static_cast<char>('a' + Random() % 4));
+
+			FMultiPatternMatcher Matcher(Patterns);
+
+			size_t Expected = 0;
+
+			for (const FString& Pattern : Patterns)
+			{
+				if (Pattern.IsEmpty()) continue;
+
+				for (size_t Position = 0; Position + Pattern.Num() <= Text.Num(); ++Position)
+				{
+					if (Text.Substr(Position, Pattern.Num()) == Pattern) ++Expected;
+				}
+			}
+
+			size_t Checked = 0;
+
+			always_check(Matcher.FindAll(Text, [&](const auto& Match)
+			{
+				always_check(Text.Substr(Match.Position, Match.Length) == Patterns[Match.Pattern]);
+
+				++Checked;
+			}) == Expected);
+
+			always_check(Checked == Expected);
+		}
+	}
+}
+
 void TestString()
 {
 	auto Test = []<typename T>(TInPlaceType<T>)
@@ -638,6 +770,7 @@ void TestString()
 {
 	NAMESPACE_PRIVATE::TestChar();
 	NAMESPACE_PRIVATE::TestStringView();
+	NAMESPACE_PRIVATE::TestMultiPatternMatcher();
 	NAMESPACE_PRIVATE::TestString();
 	NAMESPACE_PRIVATE::TestConvert();
 	NAMESPACE_PRIVATE::TestFormatting();
@@ -1598,6 +1598,116 @@ void TestPropagateConst()
 	}
 }
 
+void TestTypeHash()
+{
+	{
+		constexpr uint8 Bytes[] =
+		{
+			0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+			0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+			0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+			0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+			0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+		};
+
+		constexpr size_t HashA = HashRange(Bytes,  3);
+		constexpr size_t HashB = HashRange(Bytes, 13);
+		constexpr size_t HashC = HashRange(Bytes, 40);
+		constexpr size_t HashD = HashRange(Bytes, 80);
+
+		always_check(HashA == HashBytes(Bytes,  3));
+		always_check(HashB == HashBytes(Bytes, 13));
+		always_check(HashC == HashBytes(Bytes, 40));
+		always_check(HashD == HashBytes(Bytes, 80));
+
+		always_check(HashD == GetTypeHash(Bytes));
+
+		for (size_t Count = 0; Count != 80; ++Count)
+		{
+			always_check(HashBytes(Bytes, Count) != HashBytes(Bytes, Count + 1));
+			always_check(HashBytes(Bytes, Count) != HashBytes(Bytes, Count, 1));
+		}
+
+		uint8 Buffer[80];
+
+		for (size_t Index = 0; Index != 80; ++Index)
+		{
+			for (size_t Offset = 0; Offset != 80; ++Offset) Buffer[Offset] = Bytes[Offset];
+
+			Buffer[Index] ^= 0x10;
+
+			always_check(HashBytes(Buffer, 80) != HashD);
+		}
+	}
+
+	{
+		constexpr int32 Integers[] = { 114, 514, 1919, 810 };
+
+		constexpr size_t Hash = GetTypeHash(Integers);
+
+		always_check(Hash == HashBytes(Integers, sizeof(Integers)));
+
+		const TOptional<int32> Optionals[] = { 114, 514, 1919, 810 };
+
+		always_check(GetTypeHash(Optionals) == HashCombine(HashCombine(HashCombine(HashCombine(0, 114), 514), 1919), 810));
+	}
+
+	{
+		// Flipping any bit of the input should flip every bit of the hash value with the probability close to one half.
+		auto IsAvalanche = []<typename H>(const H& Hasher) -> bool
+		{
+			constexpr size_t NumSamples = 1000;
+			constexpr size_t OutputBits = sizeof(size_t) * 8;
+
+			uint64 Input = 0x2545F4914F6CDD1Du64;
+
+			uint32 Flips[64][OutputBits] = { };
+
+			for (size_t Sample = 0; Sample != NumSamples; ++Sample)
+			{
+				Input = Input * 6364136223846793005u64 + 1442695040888963407u64;
+
+				const size_t Hash = Hasher(Input);
+
+				for (size_t InputBit = 0; InputBit != 64; ++InputBit)
+				{
+					const size_t Diff = Hash ^ Hasher(Input ^ 1ull << InputBit);
+
+					for (size_t OutputBit = 0; OutputBit != OutputBits; ++OutputBit) Flips[InputBit][OutputBit] += Diff >> OutputBit & 1;
+				}
+			}
+
+			for (const auto& Row : Flips)
+			{
+				for (uint32 Count : Row)
+				{
+					if (Count < NumSamples * 4 / 10 || Count > NumSamples * 6 / 10) return false;
+				}
+			}
+
+			return true;
+		};
+
+		always_check(!IsAvalanche(FDefaultHasher()));
+		always_check( IsAvalanche(FMixedHasher()));
+		always_check( IsAvalanche(FSeededHasher()));
+		always_check( IsAvalanche(FSeededHasher(114514)));
+	}
+
+	{
+		constexpr int32 Integers[] = { 114, 514, 1919, 810 };
+
+		const TOptional<int32> Optional = 114;
+
+		always_check(FSeededHasher().GetSeed() == GetProcessHashSeed());
+
+		always_check(FSeededHasher(1)(Integers) == HashBytes(Integers, sizeof(Integers), 1));
+		always_check(FSeededHasher(1)(Integers) != FSeededHasher(2)(Integers));
+		always_check(FSeededHasher(1)(Optional) != FSeededHasher(2)(Optional));
+		always_check(FSeededHasher(1)(Optional) == FSeededHasher(1)(Optional));
+	}
+}
+
 void TestMiscTemplates()
 {
 	struct FTestRetainedRef { explicit FTestRetainedRef(TRetainedRef<const int64> InRef) { } };
@@ -1622,6 +1732,7 @@ void TestTemplates()
 	NAMESPACE_PRIVATE::TestAtomic();
 	NAMESPACE_PRIVATE::TestScopeHelper();
 	NAMESPACE_PRIVATE::TestPropagateConst();
+	NAMESPACE_PRIVATE::TestTypeHash();
 	NAMESPACE_PRIVATE::TestMiscTemplates();
 }
 
@@ -0,0 +1,908 @@
+#include "Testing/Testing.h"
+
+#include "Threading/Threading.h"
+#include "Algorithms/ExecutionPolicy.h"
+#include "Templates/Atomic.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_BEGIN(Testing)
+
+NAMESPACE_PRIVATE_BEGIN
+
+void TestTaskScheduler()
+{
+	always_check(Tasks::GetWorkerNum() >= 1);
+	always_check(!Tasks::IsWorkerThread());
+
+	{
+		TAtomic<size_t> Counter = 0;
+
+		for (size_t Index = 0; Index != 1000; ++Index)
+		{
+			Tasks::Submit([&Counter] { Counter.FetchAdd(1); });
+		}
+
+		Tasks::RunUntil([&Counter] { return Counter.Load() == 1000; });
+	}
+
+	{
+		TAtomic<size_t> Counter = 0;
+
+		// The tasks submitted from the tasks go into the deques of the workers, which are stolen by the others.
+		for (size_t Index = 0; Index != 16; ++Index)
+		{
+			Tasks::Submit([&Counter]
+			{
+				for (size_t Inner = 0; Inner != 64; ++Inner)
+				{
+					Tasks::Submit([&Counter] { Counter.FetchAdd(1); });
+				}
+
+				Counter.FetchAdd(1);
+			});
+		}
+
+		Tasks::RunUntil([&Counter] { return Counter.Load() == 16 * 65; });
+
+		always_check(Counter.Load() == 16 * 65);
+	}
+
+	{
+		TAtomic<size_t> Sum = 0;
+
+		Execution::ParallelFor(64, [&Sum](size_t Index)
+		{
+			Execution::ParallelFor(64, [&Sum, Index](size_t Inner) { Sum.FetchAdd(Index * 64 + Inner, EMemoryOrder::Relaxed); });
+		});
+
+		always_check(Sum.Load() == 4096 * 4095 / 2);
+	}
+
+	{
+		TAtomic<bool> bDone = false;
+
+		Tasks::Submit([&bDone] { bDone = true; bDone.Notify(); });
+
+		bDone.Wait(false);
+
+		always_check(bDone.Load());
+	}
+
+	always_check(!Tasks::TryRunTask());
+}
+
+void TestFuture()
+{
+	{
+		TPromise<int32> Promise;
+
+		TFuture<int32> Future = Promise.GetFuture();
+
+		always_check(Future.IsValid());
+		always_check(!Future.IsReady());
+
+		Promise.SetValue(42);
+
+		always_check(Future.IsReady());
+		always_check(Future.Get() == 42);
+		always_check(!Future.IsValid());
+	}
+
+	{
+		TFuture<int32> Future = Async([] { return 20; })
+			.Then([](int32 Value) { return Value + 1; })
+			.Then([](int32 Value) { return Value * 2; });
+
+		always_check(Future.Get() == 42);
+
+		TFuture<void> Void = Async([] { }).Then([] { return 1; }).Then([](int32) { });
+
+		Void.Get();
+	}
+
+	{
+		TPromise<TArray<int32>> Promise;
+
+		TFuture<size_t> Future = Promise.GetFuture().Then([](TArray<int32> Array) { return Array.Num(); });
+
+		Promise.SetValue(TArray<int32>({ 1, 2, 3 }));
+
+		always_check(Future.Get() == 3);
+	}
+
+	{
+		TFuture<TTuple<int32, double>> Future = WhenAll(Async([] { return 1; }), Async([] { return 2.0; }));
+
+		TTuple<int32, double> Result = Future.Get();
+
+		always_check(Result.template GetValue<0>() == 1);
+		always_check(Result.template GetValue<1>() == 2.0);
+	}
+
+	{
+		TArray<TFuture<int32>> Futures;
+
+		for (int32 Index = 0; Index != 64; ++Index) Futures.PushBack(Async([Index] { return Index * Index; }));
+
+		TArray<int32> Result = WhenAll(Futures).Get();
+
+		always_check(Result.Num() == 64);
+
+		for (int32 Index = 0; Index != 64; ++Index) always_check(Result[Index] == Index * Index);
+
+		TArray<TFuture<void>> Voids;
+
+		TAtomic<int32> Counter = 0;
+
+		for (int32 Index = 0; Index != 16; ++Index) Voids.PushBack(Async([&Counter] { Counter.FetchAdd(1); }));
+
+		WhenAll(Voids).Get();
+
+		always_check(Counter.Load() == 16);
+
+		TArray<TFuture<int32>> Empty;
+
+		always_check(WhenAll(Empty).Get().IsEmpty());
+	}
+
+	{
+		TPromise<int32> PromiseA;
+		TPromise<int32> PromiseB;
+
+		TArray<TFuture<int32>> Futures;
+
+		Futures.PushBack(PromiseA.GetFuture());
+		Futures.PushBack(PromiseB.GetFuture());
+
+		TFuture<TTuple<size_t, int32>> Future = WhenAny(Futures);
+
+		always_check(!Future.IsReady());
+
+		PromiseB.SetValue(2);
+
+		TTuple<size_t, int32> Result = Future.Get();
+
+		always_check(Result.template GetValue<0>() == 1);
+		always_check(Result.template GetValue<1>() == 2);
+
+		PromiseA.SetValue(1);
+	}
+
+	{
+		TPromise<int32, FHeapAllocator> Promise;
+
+		TFuture<int32> Future = Promise.GetFuture();
+
+		Tasks::Submit([&Promise] { Promise.SetValue(7); });
+
+		always_check(Future.Get() == 7);
+	}
+}
+
+TTask<int32> TaskAdd(int32 A, int32 B)
+{
+	co_return A + B;
+}
+
+TTask<int32> TaskSum(int32 Num)
+{
+	int32 Result = 0;
+
+	// The tasks complete synchronously, which are chained by the symmetric transfer.
+	for (int32 Index = 0; Index != Num; ++Index) Result = co_await TaskAdd(Result, 1);
+
+	co_return Result;
+}
+
+TTask<bool> TaskOnWorker()
+{
+	co_await ResumeOn();
+
+	co_return Tasks::IsWorkerThread();
+}
+
+TTask<int32> TaskAwaitFuture()
+{
+	const int32 Value = co_await Async([] { return 20; });
+
+	co_await Async([] { });
+
+	co_return Value + 1;
+}
+
+// GCC 12 does not match the deallocation function with the allocation function template of the promise,
+// which is paired through the frame header, so the false positive is suppressed for the coroutine in the arena.
+#if PLATFORM_COMPILER_GCC
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+TTask<int32> TaskInArena(TCoroutineArena<1024>& Arena, int32 Depth)
+{
+	if (Depth == 0) co_return 0;
+
+	always_check(Arena.GetUsed() != 0);
+
+	co_return co_await TaskInArena(Arena, Depth - 1) + 1;
+}
+
+#if PLATFORM_COMPILER_GCC
+#	pragma GCC diagnostic pop
+#endif
+
+TTask<> TaskIncrement(TAtomic<int32>& Counter)
+{
+	Counter.FetchAdd(1);
+
+	co_return;
+}
+
+void TestTask()
+{
+	{
+		TTask<int32> Task = TaskAdd(1, 2);
+
+		always_check(Task.IsValid());
+		always_check(!Task.IsDone());
+
+		always_check(SyncWait(MoveTemp(Task)) == 3);
+	}
+
+	always_check(SyncWait(TaskSum(1000)) == 1000);
+
+	always_check(SyncWait(TaskOnWorker()));
+
+	always_check(SyncWait(TaskAwaitFuture()) == 21);
+
+	{
+		TCoroutineArena<1024> Arena;
+
+		always_check(SyncWait(TaskInArena(Arena, 4)) == 4);
+
+		always_check(Arena.GetUsed() == 0);
+	}
+
+	{
+		TAtomic<int32> Counter = 0;
+
+		for (int32 Index = 0; Index != 16; ++Index) Spawn(TaskIncrement(Counter));
+
+		Tasks::RunUntil([&Counter] { return Counter.Load() == 16; });
+	}
+
+	{
+		TFuture<int32> Future = ToFuture(TaskAdd(20, 22));
+
+		always_check(Future.Get() == 42);
+	}
+}
+
+void TestTaskGraph()
+{
+	{
+		FTaskGraph Graph;
+
+		Graph.Execute();
+
+		always_check(Graph.GetCriticalPath().IsEmpty());
+	}
+
+	{
+		FTaskGraph Graph;
+
+		TAtomic<int32> Stage = 0;
+
+		int32 Loaded = 0;
+		int32 Parsed = 0;
+
+		TAtomic<int32> Transformed = 0;
+
+		const size_t Load  = Graph.AddTask([&] { Loaded = ++Stage; });
+		const size_t Parse = Graph.AddTask([&] { always_check(Loaded != 0); Parsed = ++Stage; });
+
+		TArray<size_t> Transforms;
+
+		for (int32 Index = 0; Index != 8; ++Index)
+		{
+			Transforms.PushBack(Graph.AddTask([&] { always_check(Parsed != 0); Transformed.FetchAdd(1); }));
+		}
+
+		const size_t Write = Graph.AddTask([&] { always_check(Transformed.Load() == 8); ++Stage; });
+
+		Graph.AddDependency(Load, Parse);
+
+		for (size_t Transform : Transforms)
+		{
+			Graph.AddDependency(Parse, Transform);
+			Graph.AddDependency(Transform, Write);
+		}
+
+		always_check(Graph.Num() == 11);
+
+		for (int32 Index = 0; Index != 16; ++Index)
+		{
+			Stage = 0; Loaded = 0; Parsed = 0; Transformed = 0;
+
+			Graph.Execute();
+
+			always_check(Stage.Load() == 3);
+
+			always_check(Graph.GetStartTime(Load) <= Graph.GetFinishTime(Load));
+			always_check(Graph.GetFinishTime(Load) <= Graph.GetStartTime(Parse));
+			always_check(Graph.GetFinishTime(Parse) <= Graph.GetStartTime(Write));
+		}
+
+		TArray<size_t> Path = Graph.GetCriticalPath();
+
+		always_check(Path.Num() == 4);
+		always_check(Path[0] == Load);
+		always_check(Path[1] == Parse);
+		always_check(Path[3] == Write);
+	}
+
+	{
+		FTaskGraph Graph;
+
+		TAtomic<int32> Counter = 0;
+
+		for (int32 Index = 0; Index != 64; ++Index) Graph.AddTask([&Counter] { Counter.FetchAdd(1); });
+
+		for (size_t Index = 1; Index != 32; ++Index) Graph.AddDependency(Index - 1, Index);
+
+		Graph.Execute();
+
+		always_check(Counter.Load() == 64);
+
+		always_check(Graph.GetCriticalPath().Num() >= 1);
+	}
+}
+
+template <typename T>
+void TestExclusiveLock(T& Mutex)
+{
+	always_check(Mutex.TryLock());
+	always_check(!Mutex.TryLock());
+
+	Mutex.Unlock();
+
+	size_t Counter = 0;
+
+	TAtomic<size_t> Finished = 0;
+
+	constexpr size_t TaskNum = 8;
+
+	auto Work = [&]
+	{
+		for (size_t Index = 0; Index != 1000; ++Index)
+		{
+			TScopeLock Lock(Mutex);
+
+			++Counter;
+		}
+	};
+
+	for (size_t Index = 0; Index != TaskNum; ++Index)
+	{
+		Tasks::Submit([&] { Work(); Finished.FetchAdd(1); });
+	}
+
+	Work();
+
+	Tasks::RunUntil([&] { return Finished.Load() == TaskNum; });
+
+	TScopeLock Lock(Mutex);
+
+	always_check(Counter == (TaskNum + 1) * 1000);
+}
+
+void TestMutex()
+{
+	{
+		FSpinLock Mutex;
+
+		TestExclusiveLock(Mutex);
+	}
+
+	{
+		FMutex Mutex;
+
+		TestExclusiveLock(Mutex);
+
+		TScopeLock Lock(Mutex);
+
+		always_check(!Mutex.TryLock());
+
+		Lock.Unlock();
+
+		always_check(Mutex.TryLock());
+
+		Mutex.Unlock();
+	}
+
+	{
+		FSharedMutex Mutex;
+
+		TestExclusiveLock(Mutex);
+
+		{
+			TScopeSharedLock LockA(Mutex);
+			TScopeSharedLock LockB(Mutex);
+
+			always_check(!Mutex.TryLock());
+			always_check(Mutex.TryLockShared());
+
+			Mutex.UnlockShared();
+		}
+
+		{
+			TScopeLock Lock(Mutex);
+
+			always_check(!Mutex.TryLockShared());
+		}
+
+		int32 Values[2] = { 0, 0 };
+
+		TAtomic<size_t> Finished = 0;
+
+		constexpr size_t TaskNum = 8;
+
+		// The writers keep the two values equal, which the readers must never observe as different.
+		for (size_t Index = 0; Index != TaskNum; ++Index)
+		{
+			Tasks::Submit([&, Index]
+			{
+				for (size_t Inner = 0; Inner != 1000; ++Inner)
+				{
+					if ((Inner + Index) % 16 == 0)
+					{
+						TScopeLock Lock(Mutex);
+
+						++Values[0];
+						++Values[1];
+					}
+					else
+					{
+						TScopeSharedLock Lock(Mutex);
+
+						always_check(Values[0] == Values[1]);
+					}
+				}
+
+				Finished.FetchAdd(1);
+			});
+		}
+
+		Tasks::RunUntil([&] { return Finished.Load() == TaskNum; });
+
+		TScopeSharedLock Lock(Mutex);
+
+		always_check(Values[0] == Values[1]);
+	}
+}
+
+void TestPerThread()
+{
+	always_check(GetThreadIndex() == GetThreadIndex());
+
+	{
+		TPerThread<int32> Values;
+
+		Values.Get() = 42;
+
+		always_check(Values.Get() == 42);
+
+		int32 Sum = 0;
+
+		Values.ForEach([&Sum](int32 Value) { Sum += Value; });
+
+		always_check(Sum == 42);
+	}
+
+	{
+		FShardedCounter Counter;
+
+		TShardedMax<int64> Max;
+
+		FShardedHistogram Histogram;
+
+		always_check(Counter.Get() == 0);
+		always_check(Max.Get() == TNumericLimits<int64>::Min());
+
+		TAtomic<size_t> Finished = 0;
+
+		constexpr size_t TaskNum = 8;
+
+		auto Work = [&](size_t Offset)
+		{
+			for (size_t Index = 0; Index != 1000; ++Index)
+			{
+				Counter.Add();
+
+				Max.Update(static_cast<int64>(Offset * 1000 + Index));
+
+				Histogram.Record(Index);
+			}
+		};
+
+		for (size_t Index = 0; Index != TaskNum; ++Index)
+		{
+			Tasks::Submit([&, Index] { Work(Index); Finished.FetchAdd(1); });
+		}
+
+		Work(TaskNum);
+
+		Tasks::RunUntil([&] { return Finished.Load() == TaskNum; });
+
+		always_check(Counter.Get() == (TaskNum + 1) * 1000);
+
+		always_check(Max.Get() == static_cast<int64>(TaskNum * 1000 + 999));
+
+		TStaticArray<uint64, FShardedHistogram::BucketNum> Buckets = Histogram.Get();
+
+		always_check(Buckets[0] == TaskNum + 1);
+		always_check(Buckets[1] == TaskNum + 1);
+		always_check(Buckets[2] == (TaskNum + 1) * 2);
+		always_check(Buckets[10] == (TaskNum + 1) * (1000 - 512));
+		always_check(Buckets[11] == 0);
+
+		always_check(FShardedHistogram::GetBucketIndex(0) == 0);
+		always_check(FShardedHistogram::GetBucketIndex(1) == 1);
+		always_check(FShardedHistogram::GetBucketIndex(TNumericLimits<uint64>::Max()) == 64);
+	}
+}
+
+struct FReclamationNode
+{
+	uint64 Magic;
+	uint64 Value;
+
+	FReclamationNode* Next;
+};
+
+constexpr uint64 ReclamationAlive = 0xA11CEA11CEA11CE0;
+constexpr uint64 ReclamationDead  = 0xDEADDEADDEADDEAD;
+
+/** The Treiber stack that is pushed and popped by many tasks, the popped nodes are retired to the domain, and poisoned when they are freed. */
+template <typename T>
+void TestReclamationStack()
+{
+	TAtomic<FReclamationNode*> Head = nullptr;
+
+	TAtomic<uint64> PushedSum = 0;
+	TAtomic<uint64> PoppedSum = 0;
+	TAtomic<size_t> FreedNum  = 0;
+
+	static TAtomic<size_t>* Freed;
+
+	Freed = &FreedNum;
+
+	auto Deleter = [](void* Ptr)
+	{
+		static_cast<FReclamationNode*>(Ptr)->Magic = ReclamationDead;
+
+		Memory::Free(Ptr);
+
+		Freed->FetchAdd(1, EMemoryOrder::Relaxed);
+	};
+
+	constexpr size_t TaskNum = 8;
+	constexpr size_t StepNum = 1000;
+
+	{
+		T Domain;
+
+		auto Push = [&](uint64 Value)
+		{
+			FReclamationNode* Node = static_cast<FReclamationNode*>(Memory::Malloc(sizeof(FReclamationNode)));
+
+			Node->Magic = ReclamationAlive;
+			Node->Value = Value;
+			Node->Next  = Head.Load(EMemoryOrder::Relaxed);
+
+			while (!Head.CompareExchange(Node->Next, Node, EMemoryOrder::Release, EMemoryOrder::Relaxed, true));
+
+			PushedSum.FetchAdd(Value, EMemoryOrder::Relaxed);
+		};
+
+		auto Pop = [&]
+		{
+			FReclamationNode* Node;
+
+			if constexpr (CSameAs<T, FEpochDomain>)
+			{
+				FEpochGuard Guard(Domain);
+
+				Node = Head.Load(EMemoryOrder::Acquire);
+
+				while (Node != nullptr)
+				{
+					always_check(Node->Magic == ReclamationAlive);
+
+					if (Head.CompareExchange(Node, Node->Next, EMemoryOrder::Acquire, EMemoryOrder::Acquire, true)) break;
+				}
+			}
+			else
+			{
+				FHazardPointer Hazard(Domain);
+
+				while (true)
+				{
+					Node = Hazard.Protect(Head);
+
+					if (Node == nullptr) break;
+
+					always_check(Node->Magic == ReclamationAlive);
+
+					FReclamationNode* Expected = Node;
+
+					if (Head.CompareExchange(Expected, Node->Next, EMemoryOrder::Acquire, EMemoryOrder::Relaxed, true)) break;
+				}
+			}
+
+			if (Node == nullptr) return false;
+
+			PoppedSum.FetchAdd(Node->Value, EMemoryOrder::Relaxed);
+
+			Domain.Retire(Node, Deleter);
+
+			return true;
+		};
+
+		TAtomic<size_t> Finished = 0;
+
+		auto Work = [&](size_t Offset)
+		{
+			for (size_t Index = 0; Index != StepNum; ++Index)
+			{
+				Push(Offset * StepNum + Index + 1);
+
+				if (Index % 3 != 0) Pop();
+			}
+		};
+
+		for (size_t Index = 0; Index != TaskNum; ++Index)
+		{
+			Tasks::Submit([&, Index] { Work(Index); Finished.FetchAdd(1); });
+		}
+
+		Work(TaskNum);
+
+		Tasks::RunUntil([&] { return Finished.Load() == TaskNum; });
+
+		while (Pop());
+
+		always_check(PushedSum.Load() == PoppedSum.Load());
+
+		Domain.Flush();
+	}
+
+	always_check(FreedNum.Load() == (TaskNum + 1) * StepNum);
+}
+
+void TestReclamation()
+{
+	{
+		FEpochDomain Domain;
+
+		const uint64 Epoch = Domain.GetEpoch();
+
+		{
+			FEpochGuard Guard(Domain);
+
+			FEpochGuard Nested(Domain);
+
+			Domain.Retire(Memory::Malloc(16));
+
+			// The epoch cannot advance twice while the thread is in the critical section.
+			for (size_t Index = 0; Index != 4; ++Index) Domain.Flush();
+
+			always_check(Domain.GetEpoch() <= Epoch + 1);
+		}
+
+		for (size_t Index = 0; Index != 4; ++Index) Domain.Flush();
+
+		always_check(Domain.GetEpoch() >= Epoch + 2);
+	}
+
+	{
+		FHazardDomain Domain;
+
+		TAtomic<FReclamationNode*> Source = static_cast<FReclamationNode*>(Memory::Malloc(sizeof(FReclamationNode)));
+
+		static bool bFreed;
+
+		bFreed = false;
+
+		{
+			FHazardPointer Hazard(Domain);
+
+			FReclamationNode* Node = Hazard.Protect(Source);
+
+			Source.Store(nullptr);
+
+			Domain.Retire(Node, [](void* Ptr) { bFreed = true; Memory::Free(Ptr); });
+
+			Domain.Flush();
+
+			always_check(!bFreed);
+		}
+
+		Domain.Flush();
+
+		always_check(bFreed);
+	}
+
+	TestReclamationStack<FEpochDomain>();
+	TestReclamationStack<FHazardDomain>();
+}
+
+void TestEventLoop()
+{
+	struct FLargeCapture { uint8 Padding[200]; };
+
+	{
+		FEventLoop Loop(64);
+
+		TArray<size_t> Order;
+
+		for (size_t Index = 0; Index != 100; ++Index)
+		{
+			if (Index % 2 == 0) Loop.Post([&Order, Index] { Order.PushBack(Index); });
+
+			else Loop.Post([&Order, Index, Large = FLargeCapture()] { Order.PushBack(Index + Large.Padding[0]); });
+		}
+
+		always_check(Loop.Num() == 100);
+		always_check(Loop.Max() > 64);
+
+		always_check(Loop.RunOnce() == 100);
+		always_check(Loop.Num() == 0);
+
+		always_check(Order.Num() == 100);
+
+		for (size_t Index = 0; Index != 100; ++Index) always_check(Order[Index] == Index);
+	}
+
+	{
+		FEventLoop Loop(256);
+
+		size_t Next = 0;
+
+		// The records of different sizes are wrapped around with the padding records, and the buffer never grows.
+		for (size_t Round = 0; Round != 100; ++Round)
+		{
+			for (size_t Index = 0; Index != 3; ++Index)
+			{
+				const size_t Expected = Round * 3 + Index;
+
+				if ((Round + Index) % 2 == 0) Loop.Post([&Next, Expected] { always_check(Next++ == Expected); });
+
+				else Loop.Post([&Next, Expected, Padding = TStaticArray<uint64, 6>()] { always_check(Next++ == Expected + Padding[0]); });
+			}
+
+			always_check(Loop.RunOnce() == 3);
+		}
+
+		always_check(Next == 300);
+		always_check(Loop.Max() == 256);
+	}
+
+	{
+		FEventLoop Loop(64);
+
+		size_t Count = 0;
+
+		// The buffer grows while the callback is running, which should keep the captures of the running callback.
+		Loop.Post([&Loop, &Count, Magic = static_cast<size_t>(42), Large = FLargeCapture()]
+		{
+			for (size_t Index = 0; Index != 20; ++Index) Loop.Post([&Count, Large] { Count += 1 + Large.Padding[0]; });
+
+			always_check(Magic == 42);
+		});
+
+		always_check(Loop.RunOnce() == 1);
+		always_check(Loop.Num() == 20);
+		always_check(Loop.RunOnce() == 20);
+		always_check(Count == 20);
+	}
+
+	{
+		TSharedRef<int32> Shared = MakeShared<int32>(0);
+
+		{
+			FEventLoop Loop(64);
+
+			for (size_t Index = 0; Index != 10; ++Index) Loop.Post([Shared] { });
+
+			Loop.PostRemote([Shared] { });
+
+			always_check(Shared.GetSharedReferenceCount() == 12);
+		}
+
+		always_check(Shared.GetSharedReferenceCount() == 1);
+	}
+
+	{
+		using FRemoteNode  = NAMESPACE_REDCRAFT::NAMESPACE_PRIVATE::FEventRemoteNode;
+		using FRemoteQueue = NAMESPACE_REDCRAFT::NAMESPACE_PRIVATE::FEventRemoteQueue;
+
+		FRemoteQueue Queue;
+
+		size_t Count = 0;
+
+		FRemoteNode* X = new FRemoteNode { nullptr, [&Count] { ++Count; } };
+		FRemoteNode* Y = new FRemoteNode { nullptr, [&Count] { ++Count; } };
+
+		// The pop has moved the tail from the stub to the last node X and checked that X is the head,
+		// then the producer pushes Y just before the stub is pushed behind X, so the stub becomes the head of a non-empty queue.
+		Queue.Push(X);
+
+		Queue.Tail = X;
+
+		Queue.Push(Y);
+
+		Queue.Push(&Queue.Stub);
+
+		always_check(Queue.Drain() == 2);
+		always_check(Count == 2);
+
+		always_check(Queue.Tail == &Queue.Stub);
+		always_check(Queue.Head.Load() == &Queue.Stub);
+		always_check(Queue.Drain() == 0);
+	}
+
+	{
+		FEventLoop Loop;
+
+		constexpr size_t TaskNum = 8;
+		constexpr size_t PostNum = 100;
+
+		size_t RemoteCount = 0;
+		size_t LocalCount  = 0;
+
+		for (size_t Index = 0; Index != TaskNum; ++Index)
+		{
+			Tasks::Submit([&]
+			{
+				for (size_t Post = 0; Post != PostNum; ++Post)
+				{
+					Loop.PostRemote([&]
+					{
+						Loop.Post([&] { ++LocalCount; });
+
+						if (++RemoteCount == TaskNum * PostNum) Loop.Post([&Loop] { Loop.Stop(); });
+					});
+				}
+			});
+		}
+
+		Loop.Run();
+
+		always_check(RemoteCount == TaskNum * PostNum);
+		always_check(LocalCount  == TaskNum * PostNum);
+	}
+}
+
+NAMESPACE_PRIVATE_END
+
+void TestThreading()
+{
+	NAMESPACE_PRIVATE::TestTaskScheduler();
+	NAMESPACE_PRIVATE::TestFuture();
+	NAMESPACE_PRIVATE::TestTask();
+	NAMESPACE_PRIVATE::TestTaskGraph();
+	NAMESPACE_PRIVATE::TestMutex();
+	NAMESPACE_PRIVATE::TestPerThread();
+	NAMESPACE_PRIVATE::TestReclamation();
+	NAMESPACE_PRIVATE::TestEventLoop();
+}
+
+NAMESPACE_END(Testing)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -0,0 +1,56 @@
+#include "Threading/PerThread.h"
+
+#include "Threading/Mutex.h"
+#include "Containers/Array.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_UNNAMED_BEGIN
+
+FMutex GThreadIndexMutex;
+
+TArray<size_t> GFreeThreadIndices;
+
+size_t GThreadIndexNum = 0;
+
+/** The index of the thread, which is returned to the free list when the thread exits. */
+struct FThreadIndex
+{
+	size_t Index;
+
+	FThreadIndex()
+	{
+		TScopeLock Lock(GThreadIndexMutex);
+
+		if (GFreeThreadIndices.IsEmpty()) Index = GThreadIndexNum++;
+
+		else
+		{
+			Index = GFreeThreadIndices.Back();
+
+			GFreeThreadIndices.PopBack(false);
+		}
+	}
+
+	~FThreadIndex()
+	{
+		TScopeLock Lock(GThreadIndexMutex);
+
+		GFreeThreadIndices.PushBack(Index);
+	}
+};
+
+NAMESPACE_UNNAMED_END
+
+size_t GetThreadIndex()
+{
+	thread_local FThreadIndex ThreadIndex;
+
+	return ThreadIndex.Index;
+}
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -0,0 +1,404 @@
+#include "Threading/TaskScheduler.h"
+
+#include "Templates/Atomic.h"
+#include "Templates/Noncopyable.h"
+#include "Memory/Memory.h"
+
+#include <thread>
+#include <mutex>
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_BEGIN(Tasks)
+
+NAMESPACE_UNNAMED_BEGIN
+
+/** The number of times that an idle worker looks for the tasks before it parks. */
+constexpr size_t IdleSpinNum = 64;
+
+struct FTaskNode
+{
+	TUniqueFunction<void()> Function;
+
+	FTaskNode* Next = nullptr;
+};
+
+/**
+ * The Chase-Lev deque, with the memory orders of "Correct and Efficient Work-Stealing for Weak Memory Models".
+ * Only the owner pushes and pops at the bottom, and the others steal at the top. The replaced buffers are kept
+ * until the deque is destroyed, since the thieves may be reading them.
+ */
+class FWorkStealingDeque final : FSingleton
+{
+public:
+
+	FWorkStealingDeque() : Buffer(new FBuffer(64, nullptr)) { }
+
+	~FWorkStealingDeque()
+	{
+		for (FBuffer* Iter = Buffer.Load(EMemoryOrder::Relaxed); Iter != nullptr; )
+		{
+			FBuffer* Previous = Iter->Previous;
+
+			delete Iter;
+
+			Iter = Previous;
+		}
+	}
+
+	void Push(FTaskNode* Task)
+	{
+		const int64 BottomIndex = Bottom.Load(EMemoryOrder::Relaxed);
+		const int64 TopIndex    = Top   .Load(EMemoryOrder::Acquire);
+
+		FBuffer* Array = Buffer.Load(EMemoryOrder::Relaxed);
+
+		if (BottomIndex - TopIndex > Array->Mask)
+		{
+			FBuffer* NewArray = new FBuffer((Array->Mask + 1) * 2, Array);
+
+			for (int64 Index = TopIndex; Index != BottomIndex; ++Index)
+			{
+				NewArray->At(Index).Store(Array->At(Index).Load(EMemoryOrder::Relaxed), EMemoryOrder::Relaxed);
+			}
+
+			Buffer.Store(NewArray, EMemoryOrder::Release);
+
+			Array = NewArray;
+		}
+
+		Array->At(BottomIndex).Store(Task, EMemoryOrder::Relaxed);
+
+		AtomicThreadFence(EMemoryOrder::Release);
+
+		Bottom.Store(BottomIndex + 1, EMemoryOrder::Relaxed);
+	}
+
+	NODISCARD FTaskNode* Pop()
+	{
+		const int64 BottomIndex = Bottom.Load(EMemoryOrder::Relaxed) - 1;
+
+		FBuffer* Array = Buffer.Load(EMemoryOrder::Relaxed);
+
+		Bottom.Store(BottomIndex, EMemoryOrder::Relaxed);
+
+		AtomicThreadFence(EMemoryOrder::SequentiallyConsistent);
+
+		int64 TopIndex = Top.Load(EMemoryOrder::Relaxed);
+
+		if (TopIndex > BottomIndex)
+		{
+			Bottom.Store(BottomIndex + 1, EMemoryOrder::Relaxed);
+
+			return nullptr;
+		}
+
+		FTaskNode* Task = Array->At(BottomIndex).Load(EMemoryOrder::Relaxed);
+
+		// The last task may be stolen at the same time, so it is taken by the same compare exchange as the thieves.
+		if (TopIndex == BottomIndex)
+		{
+			if (!Top.CompareExchange(TopIndex, TopIndex + 1, EMemoryOrder::SequentiallyConsistent, EMemoryOrder::Relaxed)) Task = nullptr;
+
+			Bottom.Store(BottomIndex + 1, EMemoryOrder::Relaxed);
+		}
+
+		return Task;
+	}
+
+	NODISCARD FTaskNode* Steal()
+	{
+		int64 TopIndex = Top.Load(EMemoryOrder::Acquire);
+
+		AtomicThreadFence(EMemoryOrder::SequentiallyConsistent);
+
+		const int64 BottomIndex = Bottom.Load(EMemoryOrder::Acquire);
+
+		if (TopIndex >= BottomIndex) return nullptr;
+
+		FBuffer* Array = Buffer.Load(EMemoryOrder::Acquire);
+
+		FTaskNode* Task = Array->At(TopIndex).Load(EMemoryOrder::Relaxed);
+
+		if (!Top.CompareExchange(TopIndex, TopIndex + 1, EMemoryOrder::SequentiallyConsistent, EMemoryOrder::Relaxed)) return nullptr;
+
+		return Task;
+	}
+
+	NODISCARD bool IsEmpty() const
+	{
+		return Bottom.Load(EMemoryOrder::Relaxed) <= Top.Load(EMemoryOrder::Relaxed);
+	}
+
+private:
+
+	struct FBuffer
+	{
+		int64 Mask;
+
+		TAtomic<FTaskNode*>* Slots;
+
+		FBuffer* Previous;
+
+		FORCEINLINE FBuffer(int64 Capacity, FBuffer* InPrevious) : Mask(Capacity - 1), Slots(new TAtomic<FTaskNode*>[Capacity]), Previous(InPrevious) { }
+
+		FORCEINLINE ~FBuffer() { delete[] Slots; }
+
+		NODISCARD FORCEINLINE TAtomic<FTaskNode*>& At(int64 Index) { return Slots[Index & Mask]; }
+	};
+
+	alignas(Memory::DestructiveInterference) TAtomic<int64> Top    = 0;
+	alignas(Memory::DestructiveInterference) TAtomic<int64> Bottom = 0;
+
+	TAtomic<FBuffer*> Buffer;
+
+};
+
+struct alignas(Memory::DestructiveInterference) FWorker
+{
+	FWorkStealingDeque Deque;
+
+	NAMESPACE_STD::thread Thread;
+};
+
+thread_local FWorker* GCurrentWorker = nullptr;
+
+thread_local uint32 GStealSeed = 0;
+
+class FTaskScheduler final : FSingleton
+{
+public:
+
+	FTaskScheduler()
+	{
+		const size_t Concurrency = NAMESPACE_STD::thread::hardware_concurrency();
+
+		// The detached tasks need at least one worker to run them even if there is a single hardware thread.
+		WorkerNum = Concurrency > 2 ? Concurrency - 1 : 1;
+
+		Workers = new FWorker[WorkerNum];
+
+		for (size_t Index = 0; Index != WorkerNum; ++Index)
+		{
+			Workers[Index].Thread = NAMESPACE_STD::thread([this, Index] { WorkerMain(Index); });
+		}
+	}
+
+	~FTaskScheduler()
+	{
+		bExit.Store(true);
+
+		WakeEpoch.FetchAdd(1);
+		WakeEpoch.Notify(true);
+
+		for (size_t Index = 0; Index != WorkerNum; ++Index) Workers[Index].Thread.join();
+
+		delete[] Workers;
+	}
+
+	NODISCARD FORCEINLINE size_t Num() const { return WorkerNum; }
+
+	NODISCARD FORCEINLINE bool IsWorker() const { return GCurrentWorker != nullptr; }
+
+	void Submit(TUniqueFunction<void()> Task)
+	{
+		checkf(Task.IsValid(), TEXT("The task should not be empty."));
+
+		FTaskNode* Node = new FTaskNode { MoveTemp(Task) };
+
+		if (GCurrentWorker != nullptr) GCurrentWorker->Deque.Push(Node);
+
+		else
+		{
+			NAMESPACE_STD::lock_guard Lock(InjectionMutex);
+
+			if (InjectionTail != nullptr) InjectionTail->Next = Node;
+
+			else InjectionHead = Node;
+
+			InjectionTail = Node;
+
+			InjectionNum.Store(InjectionNum.Load(EMemoryOrder::Relaxed) + 1, EMemoryOrder::Relaxed);
+		}
+
+		// Pairs with the fence of the parking worker, so either the worker sees the task or the task sees the worker.
+		AtomicThreadFence(EMemoryOrder::SequentiallyConsistent);
+
+		if (SleeperNum.Load(EMemoryOrder::Relaxed) != 0)
+		{
+			WakeEpoch.FetchAdd(1, EMemoryOrder::Relaxed);
+			WakeEpoch.Notify(false);
+		}
+	}
+
+	NODISCARD FTaskNode* FindTask()
+	{
+		if (GCurrentWorker != nullptr)
+		{
+			if (FTaskNode* Task = GCurrentWorker->Deque.Pop()) return Task;
+		}
+
+		if (InjectionNum.Load(EMemoryOrder::Relaxed) != 0)
+		{
+			NAMESPACE_STD::lock_guard Lock(InjectionMutex);
+
+			if (FTaskNode* Task = InjectionHead)
+			{
+				InjectionHead = Task->Next;
+
+				if (InjectionHead == nullptr) InjectionTail = nullptr;
+
+				InjectionNum.Store(InjectionNum.Load(EMemoryOrder::Relaxed) - 1, EMemoryOrder::Relaxed);
+
+				return Task;
+			}
+		}
+
+		// The victims are visited from a random start, so the thieves do not contend on the same worker.
+		if (GStealSeed == 0) GStealSeed = static_cast<uint32>(reinterpret_cast<uintptr>(&GStealSeed) >> 4) | 1;
+
+		GStealSeed ^= GStealSeed << 13;
+		GStealSeed ^= GStealSeed >> 17;
+		GStealSeed ^= GStealSeed << 5;
+
+		const size_t Start = GStealSeed % WorkerNum;
+
+		for (size_t Offset = 0; Offset != WorkerNum; ++Offset)
+		{
+			FWorker& Victim = Workers[(Start + Offset) % WorkerNum];
+
+			if (&Victim == GCurrentWorker) continue;
+
+			if (FTaskNode* Task = Victim.Deque.Steal()) return Task;
+		}
+
+		return nullptr;
+	}
+
+	FORCEINLINE static void RunTask(FTaskNode* Task)
+	{
+		Task->Function();
+
+		delete Task;
+	}
+
+private:
+
+	FWorker* Workers;
+	size_t   WorkerNum;
+
+	NAMESPACE_STD::mutex InjectionMutex;
+
+	FTaskNode* InjectionHead = nullptr;
+	FTaskNode* InjectionTail = nullptr;
+
+	alignas(Memory::DestructiveInterference) TAtomic<size_t> InjectionNum = 0;
+
+	alignas(Memory::DestructiveInterference) TAtomic<uint32> WakeEpoch  = 0;
+	alignas(Memory::DestructiveInterference) TAtomic<size_t> SleeperNum = 0;
+
+	TAtomic<bool> bExit = false;
+
+	NODISCARD bool HasTask() const
+	{
+		if (InjectionNum.Load(EMemoryOrder::Relaxed) != 0) return true;
+
+		for (size_t Index = 0; Index != WorkerNum; ++Index)
+		{
+			if (!Workers[Index].Deque.IsEmpty()) return true;
+		}
+
+		return false;
+	}
+
+	void WorkerMain(size_t Index)
+	{
+		GCurrentWorker = &Workers[Index];
+
+		while (true)
+		{
+			FTaskNode* Task = FindTask();
+
+			for (size_t Spin = 0; Task == nullptr && Spin != IdleSpinNum; ++Spin)
+			{
+				NAMESPACE_STD::this_thread::yield();
+
+				Task = FindTask();
+			}
+
+			if (Task != nullptr)
+			{
+				RunTask(Task);
+
+				continue;
+			}
+
+			// The submitted tasks are finished before exiting, since the workers exit only if no task is found.
+			if (bExit.Load(EMemoryOrder::Acquire)) return;
+
+			const uint32 Epoch = WakeEpoch.Load(EMemoryOrder::Relaxed);
+
+			SleeperNum.FetchAdd(1, EMemoryOrder::Relaxed);
+
+			AtomicThreadFence(EMemoryOrder::SequentiallyConsistent);
+
+			if (!HasTask() && !bExit.Load(EMemoryOrder::Relaxed)) WakeEpoch.Wait(Epoch, EMemoryOrder::Relaxed);
+
+			SleeperNum.FetchSub(1, EMemoryOrder::Relaxed);
+		}
+	}
+
+};
+
+FTaskScheduler& GetTaskScheduler()
+{
+	static FTaskScheduler TaskScheduler;
+
+	return TaskScheduler;
+}
+
+NAMESPACE_UNNAMED_END
+
+size_t GetWorkerNum()
+{
+	return GetTaskScheduler().Num();
+}
+
+bool IsWorkerThread()
+{
+	return GetTaskScheduler().IsWorker();
+}
+
+void Submit(TUniqueFunction<void()> Task)
+{
+	GetTaskScheduler().Submit(MoveTemp(Task));
+}
+
+bool TryRunTask()
+{
+	FTaskScheduler& TaskScheduler = GetTaskScheduler();
+
+	FTaskNode* Task = TaskScheduler.FindTask();
+
+	if (Task == nullptr) return false;
+
+	FTaskScheduler::RunTask(Task);
+
+	return true;
+}
+
+void RunUntil(TFunctionRef<bool()> Predicate)
+{
+	while (!Predicate())
+	{
+		if (!TryRunTask()) NAMESPACE_STD::this_thread::yield();
+	}
+}
+
+NAMESPACE_END(Tasks)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -2,4 +2,12 @@
 
 #include "CoreTypes.h"
 #include "Algorithms/Basic.h"
+#include "Algorithms/ExecutionPolicy.h"
 #include "Algorithms/Search.h"
+#include "Algorithms/BinarySearch.h"
+#include "Algorithms/Sort.h"
+#include "Algorithms/RadixSort.h"
+#include "Algorithms/Merge.h"
+#include "Algorithms/Numeric.h"
+#include "Algorithms/Mutation.h"
+#include "Algorithms/Shuffle.h"
@@ -2,6 +2,7 @@
 
 #include "CoreTypes.h"
 #include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
 #include "Iterators/Utility.h"
 #include "Iterators/Sentinel.h"
 #include "Iterators/BasicIterator.h"
@@ -13,6 +14,20 @@ NAMESPACE_REDCRAFT_BEGIN
 NAMESPACE_MODULE_BEGIN(Redcraft)
 NAMESPACE_MODULE_BEGIN(Utility)
 
+NAMESPACE_PRIVATE_BEGIN
+
+/** Swaps the elements that the iterators point to, which also works for the proxy references. */
+template <typename I>
+FORCEINLINE constexpr void IterSwap(I A, I B)
+{
+	TIteratorElement<I> Temp = MoveTemp(*A);
+
+	*A = MoveTemp(*B);
+	*B = MoveTemp(Temp);
+}
+
+NAMESPACE_PRIVATE_END
+
 NAMESPACE_BEGIN(Algorithms)
 
 /** Increments given iterator 'Iter' by 'N' elements. */
@@ -0,0 +1,427 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Invoke.h"
+#include "Templates/ReferenceWrapper.h"
+#include "Iterators/Utility.h"
+#include "Iterators/Sentinel.h"
+#include "Iterators/BasicIterator.h"
+#include "Ranges/Utility.h"
+#include "Ranges/View.h"
+#include "Algorithms/Basic.h"
+#include "Memory/Memory.h"
+#include "Numerics/Bit.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+/**
+ * Finds the first element in the range [First, First + Num) that does not satisfy the test, where the elements that satisfy the test
+ * must precede the others. The random access ranges are searched without branching on the comparison results, and the contiguous
+ * ranges also prefetch both of the candidates of the next step, so the cache misses of the steps overlap each other.
+ */
+template <typename I, typename F>
+NODISCARD constexpr I PartitionPoint(I First, size_t Num, F Test)
+{
+	if constexpr (CRandomAccessIterator<I>)
+	{
+		if (Num == 0) return First;
+
+		while (Num > 1)
+		{
+			const size_t Half = Num / 2;
+
+			if constexpr (CContiguousIterator<I>)
+			{
+				if (!IsConstantEvaluated())
+				{
+					const size_t NextHalf = (Num - Half) / 2;
+
+					Memory::Prefetch(ToAddress(First) + NextHalf);
+					Memory::Prefetch(ToAddress(First) + Half + NextHalf);
+				}
+			}
+
+			First = Test(*(First + Half)) ? First + Half : First;
+
+			Num -= Half;
+		}
+
+		return Test(*First) ? First + 1 : First;
+	}
+
+	else
+	{
+		while (Num > 0)
+		{
+			const size_t Half = Num / 2;
+
+			I Middle = Algorithms::Next(First, Half);
+
+			if (Test(*Middle))
+			{
+				First = ++Middle;
+
+				Num -= Half + 1;
+			}
+
+			else Num = Half;
+		}
+
+		return First;
+	}
+}
+
+/** @return The number of elements of the range, which is computed by walking the range if it is not sized. */
+template <typename R>
+NODISCARD FORCEINLINE constexpr size_t BinarySearchNum(R& Range)
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+
+		return Ranges::Num(Range);
+	}
+
+	else return Algorithms::Distance(Range);
+}
+
+template <typename I, typename J>
+constexpr void MakeEytzinger(I& Source, J Destination, size_t Num, size_t Index)
+{
+	if (Index > Num) return;
+
+	MakeEytzinger(Source, Destination, Num, Index * 2);
+
+	*(Destination + (Index - 1)) = *Source++;
+
+	MakeEytzinger(Source, Destination, Num, Index * 2 + 1);
+}
+
+NAMESPACE_PRIVATE_END
+
+NAMESPACE_BEGIN(Algorithms)
+
+/**
+ * Finds the first element in the sorted range that is not less than the given value.
+ * The random access ranges are searched branchlessly, and the contiguous ranges also prefetch the candidates of the next step.
+ *
+ * @param Range      - The range to search, which must be partitioned by the value.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The iterator to the first element that is not less than the value, or the end iterator if not found.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CBorrowedRange<R>)
+NODISCARD constexpr TRangeIterator<R> LowerBound(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	const size_t Num = NAMESPACE_PRIVATE::BinarySearchNum(Range);
+
+	return NAMESPACE_PRIVATE::PartitionPoint(Ranges::Begin(Range), Num, [&Predicate, &Projection, &Value]<typename U>(U&& A) -> bool
+	{
+		return Invoke(Predicate, Invoke(Projection, Forward<U>(A)), Value);
+	});
+}
+
+/**
+ * Finds the first element in the sorted range that is not less than the given value.
+ * The random access ranges are searched branchlessly, and the contiguous ranges also prefetch the candidates of the next step.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The iterator to the first element that is not less than the value, or the end iterator if not found.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD FORCEINLINE constexpr I LowerBound(I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::LowerBound(Ranges::View(MoveTemp(First), Last), Value, Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Finds the first element in the sorted range that is greater than the given value.
+ * The random access ranges are searched branchlessly, and the contiguous ranges also prefetch the candidates of the next step.
+ *
+ * @param Range      - The range to search, which must be partitioned by the value.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The iterator to the first element that is greater than the value, or the end iterator if not found.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CBorrowedRange<R>)
+NODISCARD constexpr TRangeIterator<R> UpperBound(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	const size_t Num = NAMESPACE_PRIVATE::BinarySearchNum(Range);
+
+	return NAMESPACE_PRIVATE::PartitionPoint(Ranges::Begin(Range), Num, [&Predicate, &Projection, &Value]<typename U>(U&& A) -> bool
+	{
+		return !Invoke(Predicate, Value, Invoke(Projection, Forward<U>(A)));
+	});
+}
+
+/**
+ * Finds the first element in the sorted range that is greater than the given value.
+ * The random access ranges are searched branchlessly, and the contiguous ranges also prefetch the candidates of the next step.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The iterator to the first element that is greater than the value, or the end iterator if not found.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD FORCEINLINE constexpr I UpperBound(I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::UpperBound(Ranges::View(MoveTemp(First), Last), Value, Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Finds the subrange of the elements in the sorted range that are equivalent to the given value.
+ *
+ * @param Range      - The range to search, which must be partitioned by the value.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The view of the equivalent elements, which is empty and positioned at the insertion point if not found.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CBorrowedRange<R>)
+NODISCARD constexpr Ranges::TRangeView<TRangeIterator<R>> EqualRange(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	auto Less = [&Predicate, &Projection, &Value]<typename U>(U&& A) -> bool
+	{
+		return Invoke(Predicate, Invoke(Projection, Forward<U>(A)), Value);
+	};
+
+	auto LessEqual = [&Predicate, &Projection, &Value]<typename U>(U&& A) -> bool
+	{
+		return !Invoke(Predicate, Value, Invoke(Projection, Forward<U>(A)));
+	};
+
+	const size_t Num = NAMESPACE_PRIVATE::BinarySearchNum(Range);
+
+	auto First = NAMESPACE_PRIVATE::PartitionPoint(Ranges::Begin(Range), Num, Less);
+
+	const size_t Rest = Num - static_cast<size_t>(Algorithms::Distance(Ranges::Begin(Range), First));
+
+	auto Last = NAMESPACE_PRIVATE::PartitionPoint(First, Rest, LessEqual);
+
+	return Ranges::View(MoveTemp(First), MoveTemp(Last));
+}
+
+/**
+ * Finds the subrange of the elements in the sorted range that are equivalent to the given value.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The view of the equivalent elements, which is empty and positioned at the insertion point if not found.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD FORCEINLINE constexpr Ranges::TRangeView<I> EqualRange(I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::EqualRange(Ranges::View(MoveTemp(First), Last), Value, Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Checks if the sorted range contains an element equivalent to the given value.
+ *
+ * @param Range      - The range to search, which must be partitioned by the value.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return true if an equivalent element is found, false otherwise.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD constexpr bool BinarySearch(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	const size_t Num = NAMESPACE_PRIVATE::BinarySearchNum(Range);
+
+	auto Iter = NAMESPACE_PRIVATE::PartitionPoint(Ranges::Begin(Range), Num, [&Predicate, &Projection, &Value]<typename U>(U&& A) -> bool
+	{
+		return Invoke(Predicate, Invoke(Projection, Forward<U>(A)), Value);
+	});
+
+	return Iter != Ranges::End(Range) && !Invoke(Predicate, Value, Invoke(Projection, *Iter));
+}
+
+/**
+ * Checks if the sorted range contains an element equivalent to the given value.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return true if an equivalent element is found, false otherwise.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD FORCEINLINE constexpr bool BinarySearch(I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::BinarySearch(Ranges::View(MoveTemp(First), Last), Value, Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Copies the sorted range into the destination range in the Eytzinger order, which is the breadth-first order of the implicit
+ * binary search tree, where the children of the element at index I are at index 2 * I + 1 and 2 * I + 2. The searches by
+ * EytzingerLowerBound() touch the elements in the order of the memory, so they are much more cache friendly for the large ranges.
+ *
+ * @param Range       - The sorted range to copy from.
+ * @param Destination - The range to copy to, which must have the same number of elements as the source range.
+ */
+template <CInputRange R1, CRandomAccessRange R2> requires (CSizedRange<R2&> && CIndirectlyWritable<TRangeIterator<R2>, TRangeReference<R1>>)
+constexpr void MakeEytzinger(R1&& Range, R2&& Destination)
+{
+	const size_t Num = Ranges::Num(Destination);
+
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Ranges::Num(Range) == Num, TEXT("Illegal destination range. Please check Ranges::Num(Range) == Ranges::Num(Destination)."));
+	}
+
+	auto Iter = Ranges::Begin(Range);
+
+	NAMESPACE_PRIVATE::MakeEytzinger(Iter, Ranges::Begin(Destination), Num, 1);
+}
+
+/**
+ * Finds the first element that is not less than the given value in the range built by MakeEytzinger().
+ * The search is branchless, and prefetches the cache line of the descendants four levels below if the range is contiguous.
+ *
+ * @param Range      - The range in the Eytzinger order to search.
+ * @param Value      - The value to compare the elements to.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The iterator to the first element that is not less than the value in the sorted order, or the end iterator if not found.
+ */
+template <CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CSizedRange<R&> && CBorrowedRange<R>)
+NODISCARD constexpr TRangeIterator<R> EytzingerLowerBound(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	auto First = Ranges::Begin(Range);
+
+	const size_t Num = Ranges::Num(Range);
+
+	// The descendants of the index K at four levels below are at [16 * K, 16 * K + 16), which is a cache line of the small elements.
+	constexpr size_t PrefetchScale = 16;
+
+	// The index is one-based here, so that the children of the index K are simply 2 * K and 2 * K + 1.
+	size_t Index = 1;
+
+	while (Index <= Num)
+	{
+		if constexpr (CContiguousIterator<TRangeIterator<R>>)
+		{
+			if (!IsConstantEvaluated() && Index * PrefetchScale <= Num) Memory::Prefetch(ToAddress(First) + (Index * PrefetchScale - 1));
+		}
+
+		Index = Index * 2 + static_cast<size_t>(Invoke(Predicate, Invoke(Projection, *(First + (Index - 1))), Value));
+	}
+
+	// The path turns right at the elements less than the value, so the answer is where the path last turned left.
+	Index >>= Math::CountRightZero(~Index) + 1;
+
+	return Index != 0 ? First + (Index - 1) : Ranges::End(Range);
+}
+
+NAMESPACE_END(Algorithms)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
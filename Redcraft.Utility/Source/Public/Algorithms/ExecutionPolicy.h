@@ -0,0 +1,158 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Function.h"
+#include "Templates/Atomic.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_BEGIN(Execution)
+
+/** The execution policy that the algorithm runs sequentially on the calling thread. */
+struct FSequencedPolicy final { };
+
+/** The execution policy that the algorithm may run in parallel on the worker pool. */
+struct FParallelPolicy final { };
+
+/** The execution policy that the algorithm may run in parallel on the worker pool and may be vectorized. */
+struct FParallelUnsequencedPolicy final { };
+
+inline constexpr FSequencedPolicy           Sequenced;
+inline constexpr FParallelPolicy            Parallel;
+inline constexpr FParallelUnsequencedPolicy ParallelUnsequenced;
+
+/**
+ * Invokes the function for each index in the range [0, 'Num') on the task scheduler and the calling thread, and waits for all of them.
+ * The indices are claimed in increasing order, so the earlier indices are always started first. It can be nested and called from
+ * the tasks, since the waiting thread runs the other pending tasks instead of blocking the worker.
+ *
+ * @param Num      - The number of indices.
+ * @param Function - The function to invoke with each index.
+ */
+REDCRAFTUTILITY_API void ParallelFor(size_t Num, TFunctionRef<void(size_t)> Function);
+
+NAMESPACE_END(Execution)
+
+/** A concept specifies the type is an execution policy. */
+template <typename T>
+concept CExecutionPolicy = CSameAs<TRemoveCVRef<T>, Execution::FSequencedPolicy>
+	|| CSameAs<TRemoveCVRef<T>, Execution::FParallelPolicy> || CSameAs<TRemoveCVRef<T>, Execution::FParallelUnsequencedPolicy>;
+
+NAMESPACE_PRIVATE_BEGIN
+
+template <typename T>
+concept CParallelPolicy = CSameAs<TRemoveCVRef<T>, Execution::FParallelPolicy> || CSameAs<TRemoveCVRef<T>, Execution::FParallelUnsequencedPolicy>;
+
+/**
+ * The chunks depend only on the number of elements and not on the number of threads,
+ * so that the parallel algorithms give the same results on different machines.
+ */
+constexpr size_t ParallelMinChunkSize  = 16384;
+constexpr size_t ParallelMaxChunkNum   = 256;
+constexpr size_t ParallelCancelInterval = 1024;
+
+NODISCARD FORCEINLINE constexpr size_t ParallelChunkNum(size_t Num)
+{
+	const size_t Result = Num / ParallelMinChunkSize;
+
+	return Result == 0 ? 1 : Result < ParallelMaxChunkNum ? Result : ParallelMaxChunkNum;
+}
+
+NODISCARD FORCEINLINE constexpr size_t ParallelChunkBegin(size_t Num, size_t ChunkNum, size_t Chunk)
+{
+	return static_cast<size_t>(static_cast<uint64>(Num) * Chunk / ChunkNum);
+}
+
+/**
+ * Finds the first index in the range [0, 'Num') that satisfies the test in parallel.
+ * The chunks give up once an index before them has been found, which is checked every few elements.
+ *
+ * @return The first index that satisfies the test, or 'Num' if not found.
+ */
+template <typename F>
+NODISCARD size_t ParallelFindIndex(size_t Num, F Test)
+{
+	const size_t ChunkNum = ParallelChunkNum(Num);
+
+	if (ChunkNum == 1)
+	{
+		for (size_t Index = 0; Index != Num; ++Index)
+		{
+			if (Test(Index)) return Index;
+		}
+
+		return Num;
+	}
+
+	TAtomic<size_t> Result = Num;
+
+	Execution::ParallelFor(ChunkNum, [&Result, &Test, Num, ChunkNum](size_t Chunk)
+	{
+		const size_t First = ParallelChunkBegin(Num, ChunkNum, Chunk);
+		const size_t Last  = ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+		for (size_t Block = First; Block < Last; Block += ParallelCancelInterval)
+		{
+			if (Result.Load(EMemoryOrder::Relaxed) < Block) return;
+
+			const size_t BlockLast = Block + ParallelCancelInterval < Last ? Block + ParallelCancelInterval : Last;
+
+			for (size_t Index = Block; Index != BlockLast; ++Index)
+			{
+				if (Test(Index))
+				{
+					Ignore = Result.FetchFn([Index](size_t Old) { return Old < Index ? Old : Index; });
+
+					return;
+				}
+			}
+		}
+	});
+
+	return Result.Load();
+}
+
+/** @return The number of indices in the range [0, 'Num') that satisfy the test, which are counted in parallel. */
+template <typename F>
+NODISCARD size_t ParallelCountIndex(size_t Num, F Test)
+{
+	const size_t ChunkNum = ParallelChunkNum(Num);
+
+	size_t Counts[ParallelMaxChunkNum];
+
+	auto CountChunk = [&Counts, &Test, Num, ChunkNum](size_t Chunk)
+	{
+		const size_t First = ParallelChunkBegin(Num, ChunkNum, Chunk);
+		const size_t Last  = ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+		size_t Result = 0;
+
+		for (size_t Index = First; Index != Last; ++Index)
+		{
+			if (Test(Index)) ++Result;
+		}
+
+		Counts[Chunk] = Result;
+	};
+
+	if (ChunkNum == 1) CountChunk(0);
+
+	else Execution::ParallelFor(ChunkNum, CountChunk);
+
+	size_t Result = 0;
+
+	for (size_t Chunk = 0; Chunk != ChunkNum; ++Chunk) Result += Counts[Chunk];
+
+	return Result;
+}
+
+NAMESPACE_PRIVATE_END
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
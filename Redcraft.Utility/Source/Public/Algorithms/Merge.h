@@ -0,0 +1,856 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Invoke.h"
+#include "Templates/ReferenceWrapper.h"
+#include "Iterators/Utility.h"
+#include "Iterators/Sentinel.h"
+#include "Iterators/BasicIterator.h"
+#include "Ranges/Utility.h"
+#include "Ranges/View.h"
+#include "Algorithms/Basic.h"
+#include "Algorithms/BinarySearch.h"
+#include "Memory/Allocators.h"
+#include "Memory/MemoryOperator.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+/** The intersection gallops through the longer range if it is at least this number of times longer than the shorter range. */
+constexpr size_t SetIntersectionGallopRatio = 32;
+
+/** Copies the rest of the input range to the output range, and returns false if the output range is insufficient. */
+template <typename I, typename S, typename O, typename T>
+NODISCARD FORCEINLINE constexpr bool MergeCopy(I& Iter, S Sent, O& OutIter, T OutSent)
+{
+	for (; Iter != Sent; ++Iter)
+	{
+		if (OutIter == OutSent) UNLIKELY return false;
+
+		*OutIter++ = *Iter;
+	}
+
+	return true;
+}
+
+/**
+ * Finds the first index not less than 'Start' in the range [First, First + Num) whose element does not satisfy the test,
+ * by doubling the step from 'Start' and then binary searching the last step. It takes O(log D) comparisons,
+ * where D is the distance to the result, so the short range can skip through the long range quickly.
+ */
+template <typename I, typename F>
+NODISCARD constexpr size_t Gallop(I First, size_t Start, size_t Num, F Test)
+{
+	if (Start == Num || !Test(*(First + Start))) return Start;
+
+	size_t Low  = Start;
+	size_t Step = 1;
+
+	while (Low + Step < Num && Test(*(First + (Low + Step))))
+	{
+		Low  += Step;
+		Step *= 2;
+	}
+
+	const size_t High = Low + Step < Num ? Low + Step : Num;
+
+	return static_cast<size_t>(PartitionPoint(First + (Low + 1), High - Low - 1, Test) - First);
+}
+
+template <typename I, typename S>
+struct TMergeCursor
+{
+	I Iter;
+	S Sent;
+};
+
+NAMESPACE_PRIVATE_END
+
+NAMESPACE_BEGIN(Algorithms)
+
+/**
+ * Merges two sorted ranges into the output range. The merge is stable, the elements of the left hand side range
+ * precede the equivalent elements of the right hand side range. If the output range is insufficient, return directly.
+ *
+ * @param LHS           - The left hand side sorted range.
+ * @param RHS           - The right hand side sorted range.
+ * @param Output        - The output range to write the result.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CInputRange R2, COutputRange<TRangeReference<R1>> R3,
+	CRegularInvocable<TRangeReference<R1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TRangeReference<R2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (COutputRange<R3, TRangeReference<R2>> && CBorrowedRange<R3>)
+constexpr TRangeIterator<R3> Merge(R1&& LHS, R2&& RHS, R3&& Output, Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(LHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(LHS)."));
+	}
+
+	if constexpr (CSizedRange<R2&>)
+	{
+		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
+	}
+
+	auto IterA = Ranges::Begin(LHS);
+	auto SentA = Ranges::End  (LHS);
+
+	auto IterB = Ranges::Begin(RHS);
+	auto SentB = Ranges::End  (RHS);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	while (IterA != SentA && IterB != SentB)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		if (Invoke(Predicate, Invoke(RHSProjection, *IterB), Invoke(LHSProjection, *IterA)))
+		{
+			*OutIter++ = *IterB;
+
+			++IterB;
+		}
+
+		else
+		{
+			*OutIter++ = *IterA;
+
+			++IterA;
+		}
+	}
+
+	if (NAMESPACE_PRIVATE::MergeCopy(IterA, SentA, OutIter, OutSent))
+	{
+		Ignore = NAMESPACE_PRIVATE::MergeCopy(IterB, SentB, OutIter, OutSent);
+	}
+
+	return OutIter;
+}
+
+/**
+ * Merges two sorted ranges into the output range. The merge is stable, the elements of the left hand side range
+ * precede the equivalent elements of the right hand side range. If the output range is insufficient, return directly.
+ *
+ * @param LHSFirst      - The iterator of the left hand side sorted range.
+ * @param LHSLast       - The sentinel of the left hand side sorted range.
+ * @param RHSFirst      - The iterator of the right hand side sorted range.
+ * @param RHSLast       - The sentinel of the right hand side sorted range.
+ * @param Output        - The output range to write the result.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputIterator I1, CSentinelFor<I1> S1, CInputIterator I2, CSentinelFor<I2> S2, COutputRange<TIteratorReference<I1>> R,
+	CRegularInvocable<TIteratorReference<I1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TIteratorReference<I2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (COutputRange<R, TIteratorReference<I2>> && CBorrowedRange<R>)
+FORCEINLINE constexpr TRangeIterator<R> Merge(I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast, R&& Output,
+	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedSentinelFor<S1, I1>)
+	{
+		checkf(LHSFirst - LHSLast <= 0, TEXT("Illegal range iterator. Please check LHSFirst <= LHSLast."));
+	}
+
+	if constexpr (CSizedSentinelFor<S2, I2>)
+	{
+		checkf(RHSFirst - RHSLast <= 0, TEXT("Illegal range iterator. Please check RHSFirst <= RHSLast."));
+	}
+
+	return Algorithms::Merge(
+		Ranges::View(MoveTemp(LHSFirst), LHSLast),
+		Ranges::View(MoveTemp(RHSFirst), RHSLast),
+		Forward<R>(Output), Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+}
+
+/**
+ * Computes the union of two sorted ranges into the output range. If an element is found M times in the left hand side range
+ * and N times in the right hand side range, it is written max(M, N) times, the first M from the left hand side range and
+ * the last max(N - M, 0) from the right hand side range. If the output range is insufficient, return directly.
+ *
+ * @param LHS           - The left hand side sorted range.
+ * @param RHS           - The right hand side sorted range.
+ * @param Output        - The output range to write the result.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CInputRange R2, COutputRange<TRangeReference<R1>> R3,
+	CRegularInvocable<TRangeReference<R1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TRangeReference<R2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (COutputRange<R3, TRangeReference<R2>> && CBorrowedRange<R3>)
+constexpr TRangeIterator<R3> SetUnion(R1&& LHS, R2&& RHS, R3&& Output, Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(LHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(LHS)."));
+	}
+
+	if constexpr (CSizedRange<R2&>)
+	{
+		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
+	}
+
+	auto IterA = Ranges::Begin(LHS);
+	auto SentA = Ranges::End  (LHS);
+
+	auto IterB = Ranges::Begin(RHS);
+	auto SentB = Ranges::End  (RHS);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	while (IterA != SentA && IterB != SentB)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		if (Invoke(Predicate, Invoke(RHSProjection, *IterB), Invoke(LHSProjection, *IterA)))
+		{
+			*OutIter++ = *IterB;
+
+			++IterB;
+		}
+
+		else
+		{
+			if (!Invoke(Predicate, Invoke(LHSProjection, *IterA), Invoke(RHSProjection, *IterB))) ++IterB;
+
+			*OutIter++ = *IterA;
+
+			++IterA;
+		}
+	}
+
+	if (NAMESPACE_PRIVATE::MergeCopy(IterA, SentA, OutIter, OutSent))
+	{
+		Ignore = NAMESPACE_PRIVATE::MergeCopy(IterB, SentB, OutIter, OutSent);
+	}
+
+	return OutIter;
+}
+
+/**
+ * Computes the union of two sorted ranges into the output range. If an element is found M times in the left hand side range
+ * and N times in the right hand side range, it is written max(M, N) times, the first M from the left hand side range and
+ * the last max(N - M, 0) from the right hand side range. If the output range is insufficient, return directly.
+ *
+ * @param LHSFirst      - The iterator of the left hand side sorted range.
+ * @param LHSLast       - The sentinel of the left hand side sorted range.
+ * @param RHSFirst      - The iterator of the right hand side sorted range.
+ * @param RHSLast       - The sentinel of the right hand side sorted range.
+ * @param Output        - The output range to write the result.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputIterator I1, CSentinelFor<I1> S1, CInputIterator I2, CSentinelFor<I2> S2, COutputRange<TIteratorReference<I1>> R,
+	CRegularInvocable<TIteratorReference<I1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TIteratorReference<I2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (COutputRange<R, TIteratorReference<I2>> && CBorrowedRange<R>)
+FORCEINLINE constexpr TRangeIterator<R> SetUnion(I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast, R&& Output,
+	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedSentinelFor<S1, I1>)
+	{
+		checkf(LHSFirst - LHSLast <= 0, TEXT("Illegal range iterator. Please check LHSFirst <= LHSLast."));
+	}
+
+	if constexpr (CSizedSentinelFor<S2, I2>)
+	{
+		checkf(RHSFirst - RHSLast <= 0, TEXT("Illegal range iterator. Please check RHSFirst <= RHSLast."));
+	}
+
+	return Algorithms::SetUnion(
+		Ranges::View(MoveTemp(LHSFirst), LHSLast),
+		Ranges::View(MoveTemp(RHSFirst), RHSLast),
+		Forward<R>(Output), Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+}
+
+/**
+ * Computes the intersection of two sorted ranges into the output range. If an element is found M times in the left hand side range
+ * and N times in the right hand side range, the first min(M, N) of the left hand side range are written.
+ * If one sized random access range is much shorter than the other, the short range gallops through the long range,
+ * which takes O(M log(N / M)) comparisons. If the output range is insufficient, return directly.
+ *
+ * @param LHS           - The left hand side sorted range.
+ * @param RHS           - The right hand side sorted range.
+ * @param Output        - The output range to write the result.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CInputRange R2, COutputRange<TRangeReference<R1>> R3,
+	CRegularInvocable<TRangeReference<R1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TRangeReference<R2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CBorrowedRange<R3>)
+constexpr TRangeIterator<R3> SetIntersection(R1&& LHS, R2&& RHS, R3&& Output, Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(LHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(LHS)."));
+	}
+
+	if constexpr (CSizedRange<R2&>)
+	{
+		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
+	}
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	if constexpr (CRandomAccessRange<R1> && CRandomAccessRange<R2> && CSizedRange<R1&> && CSizedRange<R2&>)
+	{
+		auto FirstA = Ranges::Begin(LHS);
+		auto FirstB = Ranges::Begin(RHS);
+
+		const size_t NumA = Ranges::Num(LHS);
+		const size_t NumB = Ranges::Num(RHS);
+
+		// Each element of the left hand side range finds its first equivalent element in the rest of the right hand side range.
+		if (NumA * NAMESPACE_PRIVATE::SetIntersectionGallopRatio < NumB)
+		{
+			size_t IndexB = 0;
+
+			for (size_t IndexA = 0; IndexA != NumA; ++IndexA)
+			{
+				auto&& ValueA = Invoke(LHSProjection, *(FirstA + IndexA));
+
+				IndexB = NAMESPACE_PRIVATE::Gallop(FirstB, IndexB, NumB, [&]<typename U>(U&& B) -> bool
+				{
+					return Invoke(Predicate, Invoke(RHSProjection, Forward<U>(B)), ValueA);
+				});
+
+				if (IndexB == NumB) break;
+
+				if (!Invoke(Predicate, ValueA, Invoke(RHSProjection, *(FirstB + IndexB))))
+				{
+					if (OutIter == OutSent) UNLIKELY return OutIter;
+
+					*OutIter++ = *(FirstA + IndexA);
+
+					++IndexB;
+				}
+			}
+
+			return OutIter;
+		}
+
+		// Each element of the right hand side range finds its first equivalent element in the rest of the left hand side range.
+		if (NumB * NAMESPACE_PRIVATE::SetIntersectionGallopRatio < NumA)
+		{
+			size_t IndexA = 0;
+
+			for (size_t IndexB = 0; IndexB != NumB; ++IndexB)
+			{
+				auto&& ValueB = Invoke(RHSProjection, *(FirstB + IndexB));
+
+				IndexA = NAMESPACE_PRIVATE::Gallop(FirstA, IndexA, NumA, [&]<typename U>(U&& A) -> bool
+				{
+					return Invoke(Predicate, Invoke(LHSProjection, Forward<U>(A)), ValueB);
+				});
+
+				if (IndexA == NumA) break;
+
+				if (!Invoke(Predicate, ValueB, Invoke(LHSProjection, *(FirstA + IndexA))))
+				{
+					if (OutIter == OutSent) UNLIKELY return OutIter;
+
+					*OutIter++ = *(FirstA + IndexA);
+
+					++IndexA;
+				}
+			}
+
+			return OutIter;
+		}
+
+		// The arithmetic keys are cheap to compare, so both comparisons are done to advance the indices without branching.
+		if constexpr (CArithmetic<TRemoveCVRef<TInvokeResult<Proj1, TRangeReference<R1>>>> && CArithmetic<TRemoveCVRef<TInvokeResult<Proj2, TRangeReference<R2>>>>)
+		{
+			size_t IndexA = 0;
+			size_t IndexB = 0;
+
+			while (IndexA != NumA && IndexB != NumB)
+			{
+				auto&& ValueA = Invoke(LHSProjection, *(FirstA + IndexA));
+				auto&& ValueB = Invoke(RHSProjection, *(FirstB + IndexB));
+
+				const bool bLess    = Invoke(Predicate, ValueA, ValueB);
+				const bool bGreater = Invoke(Predicate, ValueB, ValueA);
+
+				if (!bLess && !bGreater)
+				{
+					if (OutIter == OutSent) UNLIKELY return OutIter;
+
+					*OutIter++ = *(FirstA + IndexA);
+				}
+
+				IndexA += !bGreater;
+				IndexB += !bLess;
+			}
+
+			return OutIter;
+		}
+	}
+
+	auto IterA = Ranges::Begin(LHS);
+	auto SentA = Ranges::End  (LHS);
+
+	auto IterB = Ranges::Begin(RHS);
+	auto SentB = Ranges::End  (RHS);
+
+	while (IterA != SentA && IterB != SentB)
+	{
+		if (Invoke(Predicate, Invoke(LHSProjection, *IterA), Invoke(RHSProjection, *IterB))) ++IterA;
+
+		else if (Invoke(Predicate, Invoke(RHSProjection, *IterB), Invoke(LHSProjection, *IterA))) ++IterB;
+
+		else
+		{
+			if (OutIter == OutSent) UNLIKELY return OutIter;
+
+			*OutIter++ = *IterA;
+
+			++IterA;
+			++IterB;
+		}
+	}
+
+	return OutIter;
+}
+
+/**
+ * Computes the intersection of two sorted ranges into the output range. If an element is found M times in the left hand side range
+ * and N times in the right hand side range, the first min(M, N) of the left hand side range are written.
+ * If one sized random access range is much shorter than the other, the short range gallops through the long range,
+ * which takes O(M log(N / M)) comparisons. If the output range is insufficient, return directly.
+ *
+ * @param LHSFirst      - The iterator of the left hand side sorted range.
+ * @param LHSLast       - The sentinel of the left hand side sorted range.
+ * @param RHSFirst      - The iterator of the right hand side sorted range.
+ * @param RHSLast       - The sentinel of the right hand side sorted range.
+ * @param Output        - The output range to write the result.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputIterator I1, CSentinelFor<I1> S1, CInputIterator I2, CSentinelFor<I2> S2, COutputRange<TIteratorReference<I1>> R,
+	CRegularInvocable<TIteratorReference<I1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TIteratorReference<I2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CBorrowedRange<R>)
+FORCEINLINE constexpr TRangeIterator<R> SetIntersection(I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast, R&& Output,
+	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedSentinelFor<S1, I1>)
+	{
+		checkf(LHSFirst - LHSLast <= 0, TEXT("Illegal range iterator. Please check LHSFirst <= LHSLast."));
+	}
+
+	if constexpr (CSizedSentinelFor<S2, I2>)
+	{
+		checkf(RHSFirst - RHSLast <= 0, TEXT("Illegal range iterator. Please check RHSFirst <= RHSLast."));
+	}
+
+	return Algorithms::SetIntersection(
+		Ranges::View(MoveTemp(LHSFirst), LHSLast),
+		Ranges::View(MoveTemp(RHSFirst), RHSLast),
+		Forward<R>(Output), Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+}
+
+/**
+ * Computes the difference of two sorted ranges into the output range, which is the elements of the left hand side range
+ * that are not found in the right hand side range. If an element is found M times in the left hand side range and N times
+ * in the right hand side range, the last max(M - N, 0) of the left hand side range are written.
+ * If the output range is insufficient, return directly.
+ *
+ * @param LHS           - The left hand side sorted range.
+ * @param RHS           - The right hand side sorted range.
+ * @param Output        - The output range to write the result.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CInputRange R2, COutputRange<TRangeReference<R1>> R3,
+	CRegularInvocable<TRangeReference<R1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TRangeReference<R2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CBorrowedRange<R3>)
+constexpr TRangeIterator<R3> SetDifference(R1&& LHS, R2&& RHS, R3&& Output, Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(LHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(LHS)."));
+	}
+
+	if constexpr (CSizedRange<R2&>)
+	{
+		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
+	}
+
+	auto IterA = Ranges::Begin(LHS);
+	auto SentA = Ranges::End  (LHS);
+
+	auto IterB = Ranges::Begin(RHS);
+	auto SentB = Ranges::End  (RHS);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	while (IterA != SentA && IterB != SentB)
+	{
+		if (Invoke(Predicate, Invoke(LHSProjection, *IterA), Invoke(RHSProjection, *IterB)))
+		{
+			if (OutIter == OutSent) UNLIKELY return OutIter;
+
+			*OutIter++ = *IterA;
+
+			++IterA;
+		}
+
+		else
+		{
+			if (!Invoke(Predicate, Invoke(RHSProjection, *IterB), Invoke(LHSProjection, *IterA))) ++IterA;
+
+			++IterB;
+		}
+	}
+
+	Ignore = NAMESPACE_PRIVATE::MergeCopy(IterA, SentA, OutIter, OutSent);
+
+	return OutIter;
+}
+
+/**
+ * Computes the difference of two sorted ranges into the output range, which is the elements of the left hand side range
+ * that are not found in the right hand side range. If an element is found M times in the left hand side range and N times
+ * in the right hand side range, the last max(M - N, 0) of the left hand side range are written.
+ * If the output range is insufficient, return directly.
+ *
+ * @param LHSFirst      - The iterator of the left hand side sorted range.
+ * @param LHSLast       - The sentinel of the left hand side sorted range.
+ * @param RHSFirst      - The iterator of the right hand side sorted range.
+ * @param RHSLast       - The sentinel of the right hand side sorted range.
+ * @param Output        - The output range to write the result.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputIterator I1, CSentinelFor<I1> S1, CInputIterator I2, CSentinelFor<I2> S2, COutputRange<TIteratorReference<I1>> R,
+	CRegularInvocable<TIteratorReference<I1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TIteratorReference<I2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CBorrowedRange<R>)
+FORCEINLINE constexpr TRangeIterator<R> SetDifference(I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast, R&& Output,
+	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedSentinelFor<S1, I1>)
+	{
+		checkf(LHSFirst - LHSLast <= 0, TEXT("Illegal range iterator. Please check LHSFirst <= LHSLast."));
+	}
+
+	if constexpr (CSizedSentinelFor<S2, I2>)
+	{
+		checkf(RHSFirst - RHSLast <= 0, TEXT("Illegal range iterator. Please check RHSFirst <= RHSLast."));
+	}
+
+	return Algorithms::SetDifference(
+		Ranges::View(MoveTemp(LHSFirst), LHSLast),
+		Ranges::View(MoveTemp(RHSFirst), RHSLast),
+		Forward<R>(Output), Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+}
+
+/**
+ * Checks if the sorted left hand side range includes the sorted right hand side range. If an element is found
+ * N times in the right hand side range, it must be found at least N times in the left hand side range.
+ *
+ * @param LHS           - The left hand side sorted range.
+ * @param RHS           - The right hand side sorted range.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return true if the left hand side range includes the right hand side range, false otherwise.
+ */
+template <CInputRange R1, CInputRange R2,
+	CRegularInvocable<TRangeReference<R1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TRangeReference<R2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD constexpr bool Includes(R1&& LHS, R2&& RHS, Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(LHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(LHS)."));
+	}
+
+	if constexpr (CSizedRange<R2&>)
+	{
+		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
+	}
+
+	if constexpr (CSizedRange<R1&> && CSizedRange<R2&>)
+	{
+		if (Ranges::Num(LHS) < Ranges::Num(RHS)) return false;
+	}
+
+	auto IterA = Ranges::Begin(LHS);
+	auto SentA = Ranges::End  (LHS);
+
+	auto IterB = Ranges::Begin(RHS);
+	auto SentB = Ranges::End  (RHS);
+
+	for (; IterB != SentB; ++IterA)
+	{
+		if (IterA == SentA) return false;
+
+		if (Invoke(Predicate, Invoke(RHSProjection, *IterB), Invoke(LHSProjection, *IterA))) return false;
+
+		if (!Invoke(Predicate, Invoke(LHSProjection, *IterA), Invoke(RHSProjection, *IterB))) ++IterB;
+	}
+
+	return true;
+}
+
+/**
+ * Checks if the sorted left hand side range includes the sorted right hand side range. If an element is found
+ * N times in the right hand side range, it must be found at least N times in the left hand side range.
+ *
+ * @param LHSFirst      - The iterator of the left hand side range.
+ * @param LHSLast       - The sentinel of the left hand side range.
+ * @param RHSFirst      - The iterator of the right hand side range.
+ * @param RHSLast       - The sentinel of the right hand side range.
+ * @param Predicate     - The strict weak ordering predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before comparing.
+ * @param RHSProjection - The projection to apply to the right hand side elements before comparing.
+ *
+ * @return true if the left hand side range includes the right hand side range, false otherwise.
+ */
+template <CInputIterator I1, CSentinelFor<I1> S1, CInputIterator I2, CSentinelFor<I2> S2,
+	CRegularInvocable<TIteratorReference<I1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TIteratorReference<I2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD FORCEINLINE constexpr bool Includes(I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast,
+	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedSentinelFor<S1, I1>)
+	{
+		checkf(LHSFirst - LHSLast <= 0, TEXT("Illegal range iterator. Please check LHSFirst <= LHSLast."));
+	}
+
+	if constexpr (CSizedSentinelFor<S2, I2>)
+	{
+		checkf(RHSFirst - RHSLast <= 0, TEXT("Illegal range iterator. Please check RHSFirst <= RHSLast."));
+	}
+
+	return Algorithms::Includes(
+		Ranges::View(MoveTemp(LHSFirst), LHSLast),
+		Ranges::View(MoveTemp(RHSFirst), RHSLast),
+		Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+}
+
+/**
+ * Merges any number of sorted ranges into the output range by a tournament tree, which takes O(N log K) comparisons
+ * for N elements in K ranges. The merge is stable, the elements of the earlier ranges precede the equivalent elements
+ * of the later ranges. The tree is allocated by the given allocator. If the output range is insufficient, return directly.
+ *
+ * @param Inputs     - The range of the sorted ranges to merge.
+ * @param Output     - The output range to write the result.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <typename Allocator = FHeapAllocator, CRandomAccessRange R, COutputRange<TRangeReference<TRangeReference<R>>> R2,
+	CRegularInvocable<TRangeReference<TRangeReference<R>>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<TRangeReference<R>>>, TInvokeResult<Proj, TRangeReference<TRangeReference<R>>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<TRangeReference<R>>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CSizedRange<R&> && CForwardRange<TRangeReference<R>> && CBorrowedRange<R2> && CAllocator<Allocator, size_t>)
+TRangeIterator<R2> MultiwayMerge(R&& Inputs, R2&& Output, Pred Predicate = { }, Proj Projection = { })
+{
+	checkf(Algorithms::Distance(Inputs) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Inputs)."));
+
+	using FCursor = NAMESPACE_PRIVATE::TMergeCursor<TRangeIterator<TRangeReference<R>>, TRangeSentinel<TRangeReference<R>>>;
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	const size_t Num = Ranges::Num(Inputs);
+
+	if (Num == 0) return OutIter;
+
+	typename Allocator::template TForElementType<FCursor> CursorAllocator;
+	typename Allocator::template TForElementType<size_t>  TreeAllocator;
+
+	FCursor* Cursors = CursorAllocator.Allocate(CursorAllocator.CalculateSlackReserve(Num));
+
+	// The losers of the internal nodes are at [1, Num) and the winner is at 0, the rest is for building the tree.
+	size_t* Tree = TreeAllocator.Allocate(TreeAllocator.CalculateSlackReserve(Num * 3));
+
+	for (size_t Index = 0; Index != Num; ++Index)
+	{
+		auto&& Input = *(Ranges::Begin(Inputs) + Index);
+
+		new (Cursors + Index) FCursor { Ranges::Begin(Input), Ranges::End(Input) };
+	}
+
+	// The exhausted ranges always lose, and the earlier ranges win the ties, which keeps the merge stable.
+	auto Beats = [&Predicate, &Projection, Cursors](size_t A, size_t B) -> bool
+	{
+		if (Cursors[A].Iter == Cursors[A].Sent) return false;
+		if (Cursors[B].Iter == Cursors[B].Sent) return true;
+
+		if (A < B) return !Invoke(Predicate, Invoke(Projection, *Cursors[B].Iter), Invoke(Projection, *Cursors[A].Iter));
+
+		return Invoke(Predicate, Invoke(Projection, *Cursors[A].Iter), Invoke(Projection, *Cursors[B].Iter));
+	};
+
+	// The leaves are at [Num, 2 * Num) of the winners, and the children of the node N are 2 * N and 2 * N + 1.
+	size_t* Winners = Tree + Num;
+
+	for (size_t Index = 0; Index != Num; ++Index) Winners[Num + Index] = Index;
+
+	for (size_t Node = Num - 1; Node != 0; --Node)
+	{
+		const size_t A = Winners[Node * 2];
+		const size_t B = Winners[Node * 2 + 1];
+
+		if (Beats(A, B)) { Winners[Node] = A; Tree[Node] = B; }
+		else             { Winners[Node] = B; Tree[Node] = A; }
+	}
+
+	Tree[0] = Winners[1];
+
+	while (true)
+	{
+		size_t Winner = Tree[0];
+
+		if (Cursors[Winner].Iter == Cursors[Winner].Sent) break;
+
+		if (OutIter == OutSent) UNLIKELY break;
+
+		*OutIter++ = *Cursors[Winner].Iter;
+
+		++Cursors[Winner].Iter;
+
+		// Replays the matches on the path from the leaf of the winner to the root.
+		for (size_t Node = (Num + Winner) / 2; Node != 0; Node /= 2)
+		{
+			if (Beats(Tree[Node], Winner)) Swap(Tree[Node], Winner);
+		}
+
+		Tree[0] = Winner;
+	}
+
+	Memory::Destruct(Cursors, Num);
+
+	CursorAllocator.Deallocate(Cursors);
+	TreeAllocator.Deallocate(Tree);
+
+	return OutIter;
+}
+
+/**
+ * Merges any number of sorted ranges into the output range by a tournament tree, which takes O(N log K) comparisons
+ * for N elements in K ranges. The merge is stable, the elements of the earlier ranges precede the equivalent elements
+ * of the later ranges. The tree is allocated by the given allocator. If the output range is insufficient, return directly.
+ *
+ * @param First      - The iterator of the range of the sorted ranges to merge.
+ * @param Last       - The sentinel of the range of the sorted ranges to merge.
+ * @param Output     - The output range to write the result.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <typename Allocator = FHeapAllocator, CRandomAccessIterator I, CSizedSentinelFor<I> S, COutputRange<TRangeReference<TIteratorReference<I>>> R,
+	CRegularInvocable<TRangeReference<TIteratorReference<I>>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<TIteratorReference<I>>>, TInvokeResult<Proj, TRangeReference<TIteratorReference<I>>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<TIteratorReference<I>>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CForwardRange<TIteratorReference<I>> && CBorrowedRange<R> && CAllocator<Allocator, size_t>)
+FORCEINLINE TRangeIterator<R> MultiwayMerge(I First, S Last, R&& Output, Pred Predicate = { }, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::MultiwayMerge<Allocator>(Ranges::View(MoveTemp(First), Last), Forward<R>(Output), Ref(Predicate), Ref(Projection));
+}
+
+NAMESPACE_END(Algorithms)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
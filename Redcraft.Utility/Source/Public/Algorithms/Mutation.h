@@ -0,0 +1,727 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Invoke.h"
+#include "Templates/ReferenceWrapper.h"
+#include "Iterators/Utility.h"
+#include "Iterators/Sentinel.h"
+#include "Iterators/BasicIterator.h"
+#include "Ranges/Utility.h"
+#include "Ranges/View.h"
+#include "Algorithms/Basic.h"
+#include "Memory/Address.h"
+#include "Memory/Memory.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+/** A concept specifies the elements of the iterator can be copied to the output iterator by their object representations. */
+template <typename I, typename O>
+concept CMutationMemcpyable = CContiguousIterator<I> && CContiguousIterator<O>
+	&& CSameAs<TIteratorElement<I>, TIteratorElement<O>> && CTriviallyCopyable<TIteratorElement<I>>
+	&& !CConst<TRemoveReference<TIteratorReference<O>>>;
+
+/** A concept specifies the elements of the iterator can be reordered by moving and swapping. */
+template <typename I>
+concept CPermutable = CForwardIterator<I> && CMovable<TIteratorElement<I>>
+	&& CConstructibleFrom<TIteratorElement<I>, TIteratorRValueReference<I>>
+	&& CIndirectlyWritable<I, TIteratorRValueReference<I>>
+	&& CIndirectlyWritable<I, TIteratorElement<I>>;
+
+/** The small elements are written unconditionally by the removing algorithms, which avoids the mispredicted branches. */
+template <typename I>
+concept CMutationBranchless = CContiguousIterator<I> && CTriviallyCopyable<TIteratorElement<I>>
+	&& sizeof(TIteratorElement<I>) <= 16 && !CConst<TRemoveReference<TIteratorReference<I>>>;
+
+/** The smaller part of the rotating range is buffered on the stack if it is not larger than this number of bytes. */
+constexpr size_t RotateBufferSize = 256;
+
+NAMESPACE_PRIVATE_END
+
+NAMESPACE_BEGIN(Algorithms)
+
+/**
+ * Copies the elements of the input range to the output range. The contiguous trivially copyable elements are copied
+ * by their object representations if both ranges are sized. If the output range is insufficient, return directly.
+ *
+ * @param Input  - The range of elements to copy.
+ * @param Output - The output range to write the result.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CRange R2> requires (COutputRange<R2, TRangeReference<R1>> && CBorrowedRange<R2>)
+constexpr TRangeIterator<R2> Copy(R1&& Input, R2&& Output)
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(Input) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+	}
+
+	if constexpr (CSizedRange<R1&> && CSizedRange<R2&> && NAMESPACE_PRIVATE::CMutationMemcpyable<TRangeIterator<R1>, TRangeIterator<R2>>)
+	{
+		if (!IsConstantEvaluated())
+		{
+			const size_t Num = Ranges::Num(Input) < Ranges::Num(Output) ? Ranges::Num(Input) : Ranges::Num(Output);
+
+			auto OutIter = Ranges::Begin(Output);
+
+			if (Num != 0) Memory::Memmove(ToAddress(OutIter), ToAddress(Ranges::Begin(Input)), Num * sizeof(TRangeElement<R1>));
+
+			return OutIter + Num;
+		}
+	}
+
+	auto Iter = Ranges::Begin(Input);
+	auto Sent = Ranges::End  (Input);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	for (; Iter != Sent; ++Iter)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		*OutIter++ = *Iter;
+	}
+
+	return OutIter;
+}
+
+/**
+ * Moves the elements of the input range to the output range. The contiguous trivially copyable elements are moved
+ * by their object representations if both ranges are sized. If the output range is insufficient, return directly.
+ *
+ * @param Input  - The range of elements to move.
+ * @param Output - The output range to write the result.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CRange R2> requires (COutputRange<R2, TRangeRValueReference<R1>> && CBorrowedRange<R2>)
+constexpr TRangeIterator<R2> Move(R1&& Input, R2&& Output)
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(Input) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+	}
+
+	if constexpr (CSizedRange<R1&> && CSizedRange<R2&> && NAMESPACE_PRIVATE::CMutationMemcpyable<TRangeIterator<R1>, TRangeIterator<R2>>)
+	{
+		if (!IsConstantEvaluated())
+		{
+			const size_t Num = Ranges::Num(Input) < Ranges::Num(Output) ? Ranges::Num(Input) : Ranges::Num(Output);
+
+			auto OutIter = Ranges::Begin(Output);
+
+			if (Num != 0) Memory::Memmove(ToAddress(OutIter), ToAddress(Ranges::Begin(Input)), Num * sizeof(TRangeElement<R1>));
+
+			return OutIter + Num;
+		}
+	}
+
+	auto Iter = Ranges::Begin(Input);
+	auto Sent = Ranges::End  (Input);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	for (; Iter != Sent; ++Iter)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		*OutIter++ = MoveTemp(*Iter);
+	}
+
+	return OutIter;
+}
+
+/**
+ * Assigns the given value to the elements of the range. The contiguous arithmetic elements are filled by Memory::Memset()
+ * if all bytes of the value are the same, such as zero.
+ *
+ * @param Range - The range of elements to fill.
+ * @param Value - The value to assign.
+ *
+ * @return The iterator that points to the end of the range.
+ */
+template <CRange R, typename T> requires (COutputRange<R, const T&> && CBorrowedRange<R>)
+constexpr TRangeIterator<R> Fill(R&& Range, const T& Value)
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	if constexpr (CSizedRange<R&> && CContiguousRange<R> && CArithmetic<T> && CSameAs<TRangeElement<R>, T>)
+	{
+		if (!IsConstantEvaluated())
+		{
+			const uint8* Bytes = reinterpret_cast<const uint8*>(&Value);
+
+			bool bUniform = true;
+
+			for (size_t Index = 1; Index != sizeof(T); ++Index) bUniform &= Bytes[Index] == Bytes[0];
+
+			if (bUniform)
+			{
+				auto Iter = Ranges::Begin(Range);
+
+				const size_t Num = Ranges::Num(Range);
+
+				if (Num != 0) Memory::Memset(ToAddress(Iter), Bytes[0], Num * sizeof(T));
+
+				return Iter + Num;
+			}
+		}
+	}
+
+	auto Iter = Ranges::Begin(Range);
+	auto Sent = Ranges::End  (Range);
+
+	for (; Iter != Sent; ++Iter) *Iter = Value;
+
+	return Iter;
+}
+
+/**
+ * Assigns the given value to the elements of the range. The contiguous arithmetic elements are filled by Memory::Memset()
+ * if all bytes of the value are the same, such as zero.
+ *
+ * @param First - The iterator of the range.
+ * @param Last  - The sentinel of the range.
+ * @param Value - The value to assign.
+ *
+ * @return The iterator that points to the end of the range.
+ */
+template <CInputOrOutputIterator I, CSentinelFor<I> S, typename T> requires (COutputIterator<I, const T&>)
+FORCEINLINE constexpr I Fill(I First, S Last, const T& Value)
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::Fill(Ranges::View(MoveTemp(First), Last), Value);
+}
+
+/**
+ * Applies the operation to the projected elements of the input range and writes the results to the output range.
+ * If the output range is insufficient, return directly.
+ *
+ * @param Input      - The range of elements to transform.
+ * @param Output     - The output range to write the result.
+ * @param Operation  - The unary operation to apply to the projected elements.
+ * @param Projection - The projection to apply to the elements before transforming.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CRange R2,
+	CRegularInvocable<TRangeReference<R1>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CInvocable<TInvokeResult<Proj, TRangeReference<R1>>> F>
+	requires (COutputRange<R2, TInvokeResult<F, TInvokeResult<Proj, TRangeReference<R1>>>> && CBorrowedRange<R2>)
+constexpr TRangeIterator<R2> Transform(R1&& Input, R2&& Output, F Operation, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(Input) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+	}
+
+	auto Iter = Ranges::Begin(Input);
+	auto Sent = Ranges::End  (Input);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	for (; Iter != Sent; ++Iter)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		*OutIter++ = Invoke(Operation, Invoke(Projection, *Iter));
+	}
+
+	return OutIter;
+}
+
+/**
+ * Applies the operation to each pair of the projected elements of the two input ranges and writes the results
+ * to the output range, which stops at the end of the shorter input range. If the output range is insufficient, return directly.
+ *
+ * @param LHS           - The left hand side range of elements.
+ * @param RHS           - The right hand side range of elements.
+ * @param Output        - The output range to write the result.
+ * @param Operation     - The binary operation to apply to the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before transforming.
+ * @param RHSProjection - The projection to apply to the right hand side elements before transforming.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CInputRange R2, CRange R3,
+	CRegularInvocable<TRangeReference<R1>> Proj1 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CRegularInvocable<TRangeReference<R2>> Proj2 =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CInvocable<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> F>
+	requires (COutputRange<R3, TInvokeResult<F, TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>> && CBorrowedRange<R3>)
+constexpr TRangeIterator<R3> Transform(R1&& LHS, R2&& RHS, R3&& Output, F Operation, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(LHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(LHS)."));
+	}
+
+	if constexpr (CSizedRange<R2&>)
+	{
+		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
+	}
+
+	auto IterA = Ranges::Begin(LHS);
+	auto SentA = Ranges::End  (LHS);
+
+	auto IterB = Ranges::Begin(RHS);
+	auto SentB = Ranges::End  (RHS);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	for (; IterA != SentA && IterB != SentB; ++IterA, ++IterB)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		*OutIter++ = Invoke(Operation, Invoke(LHSProjection, *IterA), Invoke(RHSProjection, *IterB));
+	}
+
+	return OutIter;
+}
+
+/**
+ * Removes the elements that satisfy the predicate from the range by moving the remaining elements to the front,
+ * the order of the remaining elements is preserved. The elements after the returned iterator are valid but unspecified.
+ * The small contiguous trivially copyable elements are compacted without branching on the predicate.
+ *
+ * @param Range      - The range of elements to examine.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator that points to the new end of the range.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TRangeReference<R>>> Pred>
+	requires (NAMESPACE_PRIVATE::CPermutable<TRangeIterator<R>> && CBorrowedRange<R>)
+constexpr TRangeIterator<R> RemoveIf(R&& Range, Pred Predicate, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto Iter = Ranges::Begin(Range);
+	auto Sent = Ranges::End  (Range);
+
+	for (; Iter != Sent; ++Iter)
+	{
+		if (Invoke(Predicate, Invoke(Projection, *Iter))) break;
+	}
+
+	if (Iter == Sent) return Iter;
+
+	auto Result = Iter;
+
+	if constexpr (NAMESPACE_PRIVATE::CMutationBranchless<TRangeIterator<R>>)
+	{
+		if (!IsConstantEvaluated())
+		{
+			for (++Iter; Iter != Sent; ++Iter)
+			{
+				const bool bRemove = Invoke(Predicate, Invoke(Projection, *Iter));
+
+				*Result = *Iter;
+
+				Result += !bRemove;
+			}
+
+			return Result;
+		}
+	}
+
+	for (++Iter; Iter != Sent; ++Iter)
+	{
+		if (!Invoke(Predicate, Invoke(Projection, *Iter)))
+		{
+			*Result = MoveTemp(*Iter);
+
+			++Result;
+		}
+	}
+
+	return Result;
+}
+
+/**
+ * Removes the elements that satisfy the predicate from the range by moving the remaining elements to the front,
+ * the order of the remaining elements is preserved. The elements after the returned iterator are valid but unspecified.
+ * The small contiguous trivially copyable elements are compacted without branching on the predicate.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator that points to the new end of the range.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TIteratorReference<I>>> Pred>
+	requires (NAMESPACE_PRIVATE::CPermutable<I>)
+FORCEINLINE constexpr I RemoveIf(I First, S Last, Pred Predicate, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::RemoveIf(Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Removes the elements that equal the given value from the range by moving the remaining elements to the front,
+ * the order of the remaining elements is preserved. The elements after the returned iterator are valid but unspecified.
+ *
+ * @param Range      - The range of elements to examine.
+ * @param Value      - The value to remove.
+ * @param Predicate  - The equivalence relation predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator that points to the new end of the range.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CEquivalenceRelation<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+	requires (NAMESPACE_PRIVATE::CPermutable<TRangeIterator<R>> && CBorrowedRange<R>)
+FORCEINLINE constexpr TRangeIterator<R> Remove(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	return Algorithms::RemoveIf(Forward<R>(Range), [&Predicate, &Value]<typename U>(U&& A) { return Invoke(Predicate, Forward<U>(A), Value); }, Ref(Projection));
+}
+
+/**
+ * Removes the elements that equal the given value from the range by moving the remaining elements to the front,
+ * the order of the remaining elements is preserved. The elements after the returned iterator are valid but unspecified.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Value      - The value to remove.
+ * @param Predicate  - The equivalence relation predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator that points to the new end of the range.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
+	CEquivalenceRelation<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+	requires (NAMESPACE_PRIVATE::CPermutable<I>)
+FORCEINLINE constexpr I Remove(I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::Remove(Ranges::View(MoveTemp(First), Last), Value, Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Removes the consecutive equivalent elements except the first one of each group from the range by moving
+ * the remaining elements to the front. The elements after the returned iterator are valid but unspecified.
+ *
+ * @param Range      - The range of elements to examine.
+ * @param Predicate  - The equivalence relation predicate between the projected elements.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator that points to the new end of the range.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CEquivalenceRelation<TInvokeResult<Proj, TRangeReference<R>>, TInvokeResult<Proj, TRangeReference<R>>> Pred =
+		TConditional<CEqualityComparable<TInvokeResult<Proj, TRangeReference<R>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+	requires (NAMESPACE_PRIVATE::CPermutable<TRangeIterator<R>> && CBorrowedRange<R>)
+constexpr TRangeIterator<R> Unique(R&& Range, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto Iter = Ranges::Begin(Range);
+	auto Sent = Ranges::End  (Range);
+
+	if (Iter == Sent) return Iter;
+
+	auto Result = Iter;
+
+	for (++Iter; Iter != Sent; ++Iter)
+	{
+		if (!Invoke(Predicate, Invoke(Projection, *Result), Invoke(Projection, *Iter)))
+		{
+			if (++Result != Iter) *Result = MoveTemp(*Iter);
+		}
+	}
+
+	return ++Result;
+}
+
+/**
+ * Removes the consecutive equivalent elements except the first one of each group from the range by moving
+ * the remaining elements to the front. The elements after the returned iterator are valid but unspecified.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The equivalence relation predicate between the projected elements.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator that points to the new end of the range.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CEquivalenceRelation<TInvokeResult<Proj, TIteratorReference<I>>, TInvokeResult<Proj, TIteratorReference<I>>> Pred =
+		TConditional<CEqualityComparable<TInvokeResult<Proj, TIteratorReference<I>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+	requires (NAMESPACE_PRIVATE::CPermutable<I>)
+FORCEINLINE constexpr I Unique(I First, S Last, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::Unique(Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Reorders the elements of the range so that the elements that satisfy the predicate precede the elements that do not.
+ * The relative order of the elements is not preserved.
+ *
+ * @param Range      - The range of elements to reorder.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator that points to the first element of the second group.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TRangeReference<R>>> Pred>
+	requires (NAMESPACE_PRIVATE::CPermutable<TRangeIterator<R>> && CBorrowedRange<R>)
+constexpr TRangeIterator<R> Partition(R&& Range, Pred Predicate, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto First = Ranges::Begin(Range);
+
+	// The bidirectional ranges swap the misplaced pairs from both ends, which moves each misplaced element once.
+	if constexpr (CBidirectionalRange<R> && CSameAs<TRangeIterator<R>, TRangeSentinel<R>>)
+	{
+		auto Last = Ranges::End(Range);
+
+		while (true)
+		{
+			while (true)
+			{
+				if (First == Last) return First;
+
+				if (!Invoke(Predicate, Invoke(Projection, *First))) break;
+
+				++First;
+			}
+
+			do
+			{
+				if (First == --Last) return First;
+			}
+			while (!Invoke(Predicate, Invoke(Projection, *Last)));
+
+			NAMESPACE_PRIVATE::IterSwap(First, Last);
+
+			++First;
+		}
+	}
+
+	else
+	{
+		auto Sent = Ranges::End(Range);
+
+		for (; First != Sent; ++First)
+		{
+			if (!Invoke(Predicate, Invoke(Projection, *First))) break;
+		}
+
+		if (First == Sent) return First;
+
+		for (auto Iter = Algorithms::Next(First); Iter != Sent; ++Iter)
+		{
+			if (Invoke(Predicate, Invoke(Projection, *Iter)))
+			{
+				NAMESPACE_PRIVATE::IterSwap(First, Iter);
+
+				++First;
+			}
+		}
+
+		return First;
+	}
+}
+
+/**
+ * Reorders the elements of the range so that the elements that satisfy the predicate precede the elements that do not.
+ * The relative order of the elements is not preserved.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator that points to the first element of the second group.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TIteratorReference<I>>> Pred>
+	requires (NAMESPACE_PRIVATE::CPermutable<I>)
+FORCEINLINE constexpr I Partition(I First, S Last, Pred Predicate, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::Partition(Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Rotates the elements of the range to the left so that the element at 'Middle' becomes the first element.
+ * The contiguous trivially copyable elements are moved by their object representations
+ * if the smaller part fits in a small buffer on the stack, otherwise the elements are swapped block by block.
+ *
+ * @param First  - The iterator of the range.
+ * @param Middle - The iterator of the element that becomes the first element.
+ * @param Last   - The sentinel of the range.
+ *
+ * @return The iterator that points to the new position of the original first element.
+ */
+template <CForwardIterator I, CSentinelFor<I> S> requires (NAMESPACE_PRIVATE::CPermutable<I>)
+constexpr I Rotate(I First, I Middle, S Last)
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Middle <= 0 && Middle - Last <= 0, TEXT("Illegal range iterator. Please check First <= Middle <= Last."));
+	}
+
+	I End = Algorithms::Next(Middle, Last);
+
+	if (First  == Middle) return End;
+	if (Middle == End)    return First;
+
+	if constexpr (CContiguousIterator<I> && CTriviallyCopyable<TIteratorElement<I>> && !CConst<TRemoveReference<TIteratorReference<I>>>)
+	{
+		using FElementType = TIteratorElement<I>;
+
+		const size_t LeftNum  = Middle - First;
+		const size_t RightNum = End - Middle;
+
+		const size_t BufferNum = LeftNum < RightNum ? LeftNum : RightNum;
+
+		if (!IsConstantEvaluated() && BufferNum * sizeof(FElementType) <= NAMESPACE_PRIVATE::RotateBufferSize)
+		{
+			alignas(FElementType) uint8 Buffer[NAMESPACE_PRIVATE::RotateBufferSize];
+
+			FElementType* Pointer = ToAddress(First);
+
+			if (LeftNum <= RightNum)
+			{
+				Memory::Memcpy (Buffer, Pointer, LeftNum * sizeof(FElementType));
+				Memory::Memmove(Pointer, Pointer + LeftNum, RightNum * sizeof(FElementType));
+				Memory::Memcpy (Pointer + RightNum, Buffer, LeftNum * sizeof(FElementType));
+			}
+
+			else
+			{
+				Memory::Memcpy (Buffer, Pointer + LeftNum, RightNum * sizeof(FElementType));
+				Memory::Memmove(Pointer + RightNum, Pointer, LeftNum * sizeof(FElementType));
+				Memory::Memcpy (Pointer, Buffer, RightNum * sizeof(FElementType));
+			}
+
+			return First + RightNum;
+		}
+	}
+
+	I Result = First;
+
+	bool bResultFound = false;
+
+	// Swaps the left part with the following elements block by block, and then rotates the rest in the same way.
+	while (First != Middle && Middle != End)
+	{
+		I NextMiddle = First;
+
+		for (I Iter = Middle; Iter != End; ++First, ++Iter)
+		{
+			if (First == NextMiddle) NextMiddle = Iter;
+
+			NAMESPACE_PRIVATE::IterSwap(First, Iter);
+		}
+
+		if (!bResultFound)
+		{
+			Result = First;
+
+			bResultFound = true;
+		}
+
+		Middle = NextMiddle;
+	}
+
+	return Result;
+}
+
+/**
+ * Rotates the elements of the range to the left so that the element at 'Middle' becomes the first element.
+ * The contiguous trivially copyable elements are moved by their object representations
+ * if the smaller part fits in a small buffer on the stack, otherwise the elements are swapped block by block.
+ *
+ * @param Range  - The range of elements to rotate.
+ * @param Middle - The iterator of the element that becomes the first element.
+ *
+ * @return The iterator that points to the new position of the original first element.
+ */
+template <CForwardRange R> requires (NAMESPACE_PRIVATE::CPermutable<TRangeIterator<R>> && CBorrowedRange<R>)
+FORCEINLINE constexpr TRangeIterator<R> Rotate(R&& Range, TRangeIterator<R> Middle)
+{
+	return Algorithms::Rotate(Ranges::Begin(Range), MoveTemp(Middle), Ranges::End(Range));
+}
+
+NAMESPACE_END(Algorithms)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
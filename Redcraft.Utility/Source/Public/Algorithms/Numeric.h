@@ -0,0 +1,848 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Invoke.h"
+#include "Templates/ReferenceWrapper.h"
+#include "Templates/Optional.h"
+#include "Iterators/Utility.h"
+#include "Iterators/Sentinel.h"
+#include "Iterators/BasicIterator.h"
+#include "Ranges/Utility.h"
+#include "Ranges/View.h"
+#include "Algorithms/Basic.h"
+#include "Algorithms/ExecutionPolicy.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+/** The default projection of the numeric algorithms, which is a named type so that the vectorized versions can be selected. */
+struct FNumericIdentity
+{
+	template <typename T>
+	NODISCARD FORCEINLINE constexpr T&& operator()(T&& A) const { return Forward<T>(A); }
+};
+
+/** The default reduction of the numeric algorithms, which is a named type so that the vectorized versions can be selected. */
+struct FNumericPlus
+{
+	template <typename LHS, typename RHS>
+	NODISCARD FORCEINLINE constexpr auto operator()(LHS&& A, RHS&& B) const { return Forward<LHS>(A) + Forward<RHS>(B); }
+};
+
+/** The default transformation of the binary TransformReduce(), which is a named type so that the vectorized versions can be selected. */
+struct FNumericMultiplies
+{
+	template <typename LHS, typename RHS>
+	NODISCARD FORCEINLINE constexpr auto operator()(LHS&& A, RHS&& B) const { return Forward<LHS>(A) * Forward<RHS>(B); }
+};
+
+/** The default operation of AdjacentDifference(). */
+struct FNumericMinus
+{
+	template <typename LHS, typename RHS>
+	NODISCARD FORCEINLINE constexpr auto operator()(LHS&& A, RHS&& B) const { return Forward<LHS>(A) - Forward<RHS>(B); }
+};
+
+/**
+ * A concept specifies the elements of the iterator can be summed by the vectorized version,
+ * which holds for the contiguous arithmetic elements of the result type with the default projection and reduction.
+ */
+template <typename I, typename T, typename Proj, typename Op>
+concept CNumericVectorizable = CContiguousIterator<I>
+	&& CArithmetic<T> && !CSameAs<T, bool> && CSameAs<TIteratorElement<I>, T>
+	&& CSameAs<TRemoveCVRef<TUnwrapRefDecay<Proj>>, FNumericIdentity>
+	&& CSameAs<TRemoveCVRef<TUnwrapRefDecay<Op>>, FNumericPlus>;
+
+/** The ranges not longer than this are summed by the independent lanes, and the longer ranges are split in half. */
+constexpr size_t NumericPairwiseBlockSize = 128;
+constexpr size_t NumericLaneNum           = 8;
+
+/**
+ * Sums the elements by the pairwise summation, whose rounding error grows with O(log N) instead of O(N) for the floating-point types.
+ * The independent lanes of the blocks have no dependency on each other, so they can be pipelined and vectorized by the compiler.
+ */
+template <typename T>
+NODISCARD T NumericSum(const T* Data, size_t Num)
+{
+	if (Num > NumericPairwiseBlockSize)
+	{
+		const size_t Half = Num / 2;
+
+		return NumericSum(Data, Half) + NumericSum(Data + Half, Num - Half);
+	}
+
+	T Lanes[NumericLaneNum] = { };
+
+	size_t Index = 0;
+
+	for (; Index + NumericLaneNum <= Num; Index += NumericLaneNum)
+	{
+		for (size_t Lane = 0; Lane != NumericLaneNum; ++Lane) Lanes[Lane] += Data[Index + Lane];
+	}
+
+	for (; Index != Num; ++Index) Lanes[Index % NumericLaneNum] += Data[Index];
+
+	return ((Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3])) + ((Lanes[4] + Lanes[5]) + (Lanes[6] + Lanes[7]));
+}
+
+/** Sums the products of the elements by the pairwise summation, see NumericSum(). */
+template <typename T>
+NODISCARD T NumericDot(const T* LHS, const T* RHS, size_t Num)
+{
+	if (Num > NumericPairwiseBlockSize)
+	{
+		const size_t Half = Num / 2;
+
+		return NumericDot(LHS, RHS, Half) + NumericDot(LHS + Half, RHS + Half, Num - Half);
+	}
+
+	T Lanes[NumericLaneNum] = { };
+
+	size_t Index = 0;
+
+	for (; Index + NumericLaneNum <= Num; Index += NumericLaneNum)
+	{
+		for (size_t Lane = 0; Lane != NumericLaneNum; ++Lane) Lanes[Lane] += LHS[Index + Lane] * RHS[Index + Lane];
+	}
+
+	for (; Index != Num; ++Index) Lanes[Index % NumericLaneNum] += LHS[Index] * RHS[Index];
+
+	return ((Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3])) + ((Lanes[4] + Lanes[5]) + (Lanes[6] + Lanes[7]));
+}
+
+NAMESPACE_PRIVATE_END
+
+NAMESPACE_BEGIN(Algorithms)
+
+/**
+ * Reduces the range by the operation, which may be applied in any order, so the operation should be associative and commutative.
+ * The contiguous arithmetic elements are summed by the pairwise summation with the default operation and projection,
+ * which is more accurate and faster for the floating-point types.
+ *
+ * @param Range      - The range of elements to reduce.
+ * @param Init       - The initial value of the reduction.
+ * @param Operation  - The binary operation to reduce the projected elements.
+ * @param Projection - The projection to apply to the elements before reducing.
+ *
+ * @return The result of the reduction, or the initial value if the range is empty.
+ */
+template <CInputRange R, CMovable T,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<T, TInvokeResult<Proj, TRangeReference<R>>> Op =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CAssignableFrom<T&, TInvokeResult<Op, T, TInvokeResult<Proj, TRangeReference<R>>>>)
+NODISCARD constexpr T Reduce(R&& Range, T Init, Op Operation = { }, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	if constexpr (CSizedRange<R&> && NAMESPACE_PRIVATE::CNumericVectorizable<TRangeIterator<R>, T, Proj, Op>)
+	{
+		if (!IsConstantEvaluated()) return Init + NAMESPACE_PRIVATE::NumericSum(ToAddress(Ranges::Begin(Range)), Ranges::Num(Range));
+	}
+
+	auto Iter = Ranges::Begin(Range);
+	auto Sent = Ranges::End  (Range);
+
+	for (; Iter != Sent; ++Iter)
+	{
+		Init = Invoke(Operation, MoveTemp(Init), Invoke(Projection, *Iter));
+	}
+
+	return Init;
+}
+
+/**
+ * Reduces the range by the operation, which may be applied in any order, so the operation should be associative and commutative.
+ * The contiguous arithmetic elements are summed by the pairwise summation with the default operation and projection,
+ * which is more accurate and faster for the floating-point types.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Init       - The initial value of the reduction.
+ * @param Operation  - The binary operation to reduce the projected elements.
+ * @param Projection - The projection to apply to the elements before reducing.
+ *
+ * @return The result of the reduction, or the initial value if the range is empty.
+ */
+template <CInputIterator I, CSentinelFor<I> S, CMovable T,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<T, TInvokeResult<Proj, TIteratorReference<I>>> Op =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CAssignableFrom<T&, TInvokeResult<Op, T, TInvokeResult<Proj, TIteratorReference<I>>>>)
+NODISCARD FORCEINLINE constexpr T Reduce(I First, S Last, T Init, Op Operation = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::Reduce(Ranges::View(MoveTemp(First), Last), MoveTemp(Init), Ref(Operation), Ref(Projection));
+}
+
+/**
+ * Reduces the range by the operation with the execution policy, which may be applied in any order,
+ * so the operation should be associative and commutative. The parallel policies reduce the chunks of the range
+ * on the worker pool and reduce the results of the chunks in order.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range of elements to reduce.
+ * @param Init       - The initial value of the reduction.
+ * @param Operation  - The binary operation to reduce the projected elements.
+ * @param Projection - The projection to apply to the elements before reducing.
+ *
+ * @return The result of the reduction, or the initial value if the range is empty.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R, CMovable T,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<T, TInvokeResult<Proj, TRangeReference<R>>> Op =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CSizedRange<R&> && CAssignableFrom<T&, TInvokeResult<Op, T, TInvokeResult<Proj, TRangeReference<R>>>>
+		&& CConstructibleFrom<T, TInvokeResult<Proj, TRangeReference<R>>> && CRegularInvocable<Op, T, T> && CAssignableFrom<T&, TInvokeResult<Op, T, T>>)
+NODISCARD T Reduce(E&&, R&& Range, T Init, Op Operation = { }, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::Reduce(Forward<R>(Range), MoveTemp(Init), Ref(Operation), Ref(Projection));
+
+	else
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+
+		const size_t Num      = Ranges::Num(Range);
+		const size_t ChunkNum = NAMESPACE_PRIVATE::ParallelChunkNum(Num);
+
+		if (ChunkNum == 1) return Algorithms::Reduce(Forward<R>(Range), MoveTemp(Init), Ref(Operation), Ref(Projection));
+
+		auto First = Ranges::Begin(Range);
+
+		TOptional<T> Partials[NAMESPACE_PRIVATE::ParallelMaxChunkNum];
+
+		Execution::ParallelFor(ChunkNum, [&](size_t Chunk)
+		{
+			const size_t ChunkFirst = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk);
+			const size_t ChunkLast  = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+			Partials[Chunk].Emplace(Algorithms::Reduce(Ranges::View(First + (ChunkFirst + 1), First + ChunkLast),
+				T(Invoke(Projection, *(First + ChunkFirst))), Ref(Operation), Ref(Projection)));
+		});
+
+		for (size_t Chunk = 0; Chunk != ChunkNum; ++Chunk)
+		{
+			Init = Invoke(Operation, MoveTemp(Init), MoveTemp(*Partials[Chunk]));
+		}
+
+		return Init;
+	}
+}
+
+/**
+ * Reduces the range by the operation with the execution policy, which may be applied in any order,
+ * so the operation should be associative and commutative. The parallel policies reduce the chunks of the range
+ * on the worker pool and reduce the results of the chunks in order.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Init       - The initial value of the reduction.
+ * @param Operation  - The binary operation to reduce the projected elements.
+ * @param Projection - The projection to apply to the elements before reducing.
+ *
+ * @return The result of the reduction, or the initial value if the range is empty.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S, CMovable T,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<T, TInvokeResult<Proj, TIteratorReference<I>>> Op =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CAssignableFrom<T&, TInvokeResult<Op, T, TInvokeResult<Proj, TIteratorReference<I>>>>
+		&& CConstructibleFrom<T, TInvokeResult<Proj, TIteratorReference<I>>> && CRegularInvocable<Op, T, T> && CAssignableFrom<T&, TInvokeResult<Op, T, T>>)
+NODISCARD FORCEINLINE T Reduce(E&& Policy, I First, S Last, T Init, Op Operation = { }, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::Reduce(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), MoveTemp(Init), Ref(Operation), Ref(Projection));
+}
+
+/**
+ * Transforms each pair of the elements of the two ranges and reduces the results, which stops at the end of the shorter range.
+ * The operations may be applied in any order, so the reduction should be associative and commutative. The unary version is
+ * Reduce() with the transformation as the projection. The contiguous arithmetic elements are computed as the dot product
+ * by the pairwise summation with the default operations.
+ *
+ * @param LHS       - The left hand side range of elements.
+ * @param RHS       - The right hand side range of elements.
+ * @param Init      - The initial value of the reduction.
+ * @param Reduction - The binary operation to reduce the transformed elements.
+ * @param Transform - The binary operation to transform each pair of the elements.
+ *
+ * @return The result of the reduction, or the initial value if any range is empty.
+ */
+template <CInputRange R1, CInputRange R2, CMovable T,
+	CRegularInvocable<TRangeReference<R1>, TRangeReference<R2>> TransformOp =
+		NAMESPACE_PRIVATE::FNumericMultiplies,
+	CRegularInvocable<T, TInvokeResult<TransformOp, TRangeReference<R1>, TRangeReference<R2>>> ReduceOp =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CAssignableFrom<T&, TInvokeResult<ReduceOp, T, TInvokeResult<TransformOp, TRangeReference<R1>, TRangeReference<R2>>>>)
+NODISCARD constexpr T TransformReduce(R1&& LHS, R2&& RHS, T Init, ReduceOp Reduction = { }, TransformOp Transform = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(LHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(LHS)."));
+	}
+
+	if constexpr (CSizedRange<R2&>)
+	{
+		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
+	}
+
+	if constexpr (CSizedRange<R1&> && CSizedRange<R2&>
+		&& NAMESPACE_PRIVATE::CNumericVectorizable<TRangeIterator<R1>, T, NAMESPACE_PRIVATE::FNumericIdentity, ReduceOp>
+		&& NAMESPACE_PRIVATE::CNumericVectorizable<TRangeIterator<R2>, T, NAMESPACE_PRIVATE::FNumericIdentity, ReduceOp>
+		&& CSameAs<TRemoveCVRef<TUnwrapRefDecay<TransformOp>>, NAMESPACE_PRIVATE::FNumericMultiplies>)
+	{
+		if (!IsConstantEvaluated())
+		{
+			const size_t Num = Ranges::Num(LHS) < Ranges::Num(RHS) ? Ranges::Num(LHS) : Ranges::Num(RHS);
+
+			return Init + NAMESPACE_PRIVATE::NumericDot(ToAddress(Ranges::Begin(LHS)), ToAddress(Ranges::Begin(RHS)), Num);
+		}
+	}
+
+	auto IterA = Ranges::Begin(LHS);
+	auto SentA = Ranges::End  (LHS);
+
+	auto IterB = Ranges::Begin(RHS);
+	auto SentB = Ranges::End  (RHS);
+
+	for (; IterA != SentA && IterB != SentB; ++IterA, ++IterB)
+	{
+		Init = Invoke(Reduction, MoveTemp(Init), Invoke(Transform, *IterA, *IterB));
+	}
+
+	return Init;
+}
+
+/**
+ * Transforms each pair of the elements of the two ranges and reduces the results, which stops at the end of the shorter range.
+ * The operations may be applied in any order, so the reduction should be associative and commutative. The unary version is
+ * Reduce() with the transformation as the projection. The contiguous arithmetic elements are computed as the dot product
+ * by the pairwise summation with the default operations.
+ *
+ * @param LHSFirst  - The iterator of the left hand side range.
+ * @param LHSLast   - The sentinel of the left hand side range.
+ * @param RHSFirst  - The iterator of the right hand side range.
+ * @param RHSLast   - The sentinel of the right hand side range.
+ * @param Init      - The initial value of the reduction.
+ * @param Reduction - The binary operation to reduce the transformed elements.
+ * @param Transform - The binary operation to transform each pair of the elements.
+ *
+ * @return The result of the reduction, or the initial value if any range is empty.
+ */
+template <CInputIterator I1, CSentinelFor<I1> S1, CInputIterator I2, CSentinelFor<I2> S2, CMovable T,
+	CRegularInvocable<TIteratorReference<I1>, TIteratorReference<I2>> TransformOp =
+		NAMESPACE_PRIVATE::FNumericMultiplies,
+	CRegularInvocable<T, TInvokeResult<TransformOp, TIteratorReference<I1>, TIteratorReference<I2>>> ReduceOp =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CAssignableFrom<T&, TInvokeResult<ReduceOp, T, TInvokeResult<TransformOp, TIteratorReference<I1>, TIteratorReference<I2>>>>)
+NODISCARD FORCEINLINE constexpr T TransformReduce(I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast, T Init, ReduceOp Reduction = { }, TransformOp Transform = { })
+{
+	if constexpr (CSizedSentinelFor<S1, I1>)
+	{
+		checkf(LHSFirst - LHSLast <= 0, TEXT("Illegal range iterator. Please check LHSFirst <= LHSLast."));
+	}
+
+	if constexpr (CSizedSentinelFor<S2, I2>)
+	{
+		checkf(RHSFirst - RHSLast <= 0, TEXT("Illegal range iterator. Please check RHSFirst <= RHSLast."));
+	}
+
+	return Algorithms::TransformReduce(
+		Ranges::View(MoveTemp(LHSFirst), LHSLast),
+		Ranges::View(MoveTemp(RHSFirst), RHSLast),
+		MoveTemp(Init), Ref(Reduction), Ref(Transform));
+}
+
+/**
+ * Transforms each pair of the elements of the two ranges and reduces the results with the execution policy,
+ * which stops at the end of the shorter range. The operations may be applied in any order, so the reduction should be
+ * associative and commutative. The parallel policies reduce the chunks of the ranges on the worker pool
+ * and reduce the results of the chunks in order.
+ *
+ * @param Policy    - The execution policy to use.
+ * @param LHS       - The left hand side range of elements.
+ * @param RHS       - The right hand side range of elements.
+ * @param Init      - The initial value of the reduction.
+ * @param Reduction - The binary operation to reduce the transformed elements.
+ * @param Transform - The binary operation to transform each pair of the elements.
+ *
+ * @return The result of the reduction, or the initial value if any range is empty.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R1, CRandomAccessRange R2, CMovable T,
+	CRegularInvocable<TRangeReference<R1>, TRangeReference<R2>> TransformOp =
+		NAMESPACE_PRIVATE::FNumericMultiplies,
+	CRegularInvocable<T, TInvokeResult<TransformOp, TRangeReference<R1>, TRangeReference<R2>>> ReduceOp =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CSizedRange<R1&> && CSizedRange<R2&>
+		&& CAssignableFrom<T&, TInvokeResult<ReduceOp, T, TInvokeResult<TransformOp, TRangeReference<R1>, TRangeReference<R2>>>>
+		&& CConstructibleFrom<T, TInvokeResult<TransformOp, TRangeReference<R1>, TRangeReference<R2>>>
+		&& CRegularInvocable<ReduceOp, T, T> && CAssignableFrom<T&, TInvokeResult<ReduceOp, T, T>>)
+NODISCARD T TransformReduce(E&&, R1&& LHS, R2&& RHS, T Init, ReduceOp Reduction = { }, TransformOp Transform = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>)
+	{
+		return Algorithms::TransformReduce(Forward<R1>(LHS), Forward<R2>(RHS), MoveTemp(Init), Ref(Reduction), Ref(Transform));
+	}
+
+	else
+	{
+		checkf(Algorithms::Distance(LHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(LHS)."));
+		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
+
+		const size_t Num      = Ranges::Num(LHS) < Ranges::Num(RHS) ? Ranges::Num(LHS) : Ranges::Num(RHS);
+		const size_t ChunkNum = NAMESPACE_PRIVATE::ParallelChunkNum(Num);
+
+		if (ChunkNum == 1) return Algorithms::TransformReduce(Forward<R1>(LHS), Forward<R2>(RHS), MoveTemp(Init), Ref(Reduction), Ref(Transform));
+
+		auto FirstA = Ranges::Begin(LHS);
+		auto FirstB = Ranges::Begin(RHS);
+
+		TOptional<T> Partials[NAMESPACE_PRIVATE::ParallelMaxChunkNum];
+
+		Execution::ParallelFor(ChunkNum, [&](size_t Chunk)
+		{
+			const size_t ChunkFirst = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk);
+			const size_t ChunkLast  = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+			Partials[Chunk].Emplace(Algorithms::TransformReduce(
+				Ranges::View(FirstA + (ChunkFirst + 1), FirstA + ChunkLast),
+				Ranges::View(FirstB + (ChunkFirst + 1), FirstB + ChunkLast),
+				T(Invoke(Transform, *(FirstA + ChunkFirst), *(FirstB + ChunkFirst))), Ref(Reduction), Ref(Transform)));
+		});
+
+		for (size_t Chunk = 0; Chunk != ChunkNum; ++Chunk)
+		{
+			Init = Invoke(Reduction, MoveTemp(Init), MoveTemp(*Partials[Chunk]));
+		}
+
+		return Init;
+	}
+}
+
+/**
+ * Computes the inclusive prefix sums of the range into the output range, the N-th output is the sum of the first N + 1 elements.
+ * The input and output ranges may be the same range. If the output range is insufficient, return directly.
+ *
+ * @param Input      - The range of elements to scan.
+ * @param Output     - The output range to write the result.
+ * @param Operation  - The associative binary operation to sum the projected elements.
+ * @param Projection - The projection to apply to the elements before summing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CRange R2,
+	CRegularInvocable<TRangeReference<R1>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TInvokeResult<Proj, TRangeReference<R1>>> Op =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (COutputRange<R2, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&> && CBorrowedRange<R2>
+		&& CConstructibleFrom<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TInvokeResult<Proj, TRangeReference<R1>>>
+		&& CAssignableFrom<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&,
+			TInvokeResult<Op, TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TInvokeResult<Proj, TRangeReference<R1>>>>)
+constexpr TRangeIterator<R2> InclusiveScan(R1&& Input, R2&& Output, Op Operation = { }, Proj Projection = { })
+{
+	using FValueType = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>;
+
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(Input) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+	}
+
+	auto Iter = Ranges::Begin(Input);
+	auto Sent = Ranges::End  (Input);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	if (Iter == Sent || OutIter == OutSent) return OutIter;
+
+	FValueType Sum(Invoke(Projection, *Iter));
+
+	*OutIter++ = AsConst(Sum);
+
+	for (++Iter; Iter != Sent; ++Iter)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		Sum = Invoke(Operation, MoveTemp(Sum), Invoke(Projection, *Iter));
+
+		*OutIter++ = AsConst(Sum);
+	}
+
+	return OutIter;
+}
+
+/**
+ * Computes the inclusive prefix sums of the range into the output range with the execution policy.
+ * The parallel policies reduce the chunks of the range on the worker pool, and then scan the chunks on the worker pool
+ * from the sums of the previous chunks, so the operation is applied in the different grouping. The input and output ranges
+ * may be the same range. If the output range is insufficient, only the elements that fit are scanned.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Input      - The range of elements to scan.
+ * @param Output     - The output range to write the result.
+ * @param Operation  - The associative binary operation to sum the projected elements.
+ * @param Projection - The projection to apply to the elements before summing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R1, CRandomAccessRange R2,
+	CRegularInvocable<TRangeReference<R1>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TInvokeResult<Proj, TRangeReference<R1>>> Op =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CSizedRange<R1&> && CSizedRange<R2&>
+		&& COutputRange<R2, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&> && CBorrowedRange<R2>
+		&& CConstructibleFrom<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TInvokeResult<Proj, TRangeReference<R1>>>
+		&& CAssignableFrom<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&,
+			TInvokeResult<Op, TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TInvokeResult<Proj, TRangeReference<R1>>>>
+		&& CRegularInvocable<Op, TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>>)
+TRangeIterator<R2> InclusiveScan(E&&, R1&& Input, R2&& Output, Op Operation = { }, Proj Projection = { })
+{
+	using FValueType = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>;
+
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::InclusiveScan(Forward<R1>(Input), Forward<R2>(Output), Ref(Operation), Ref(Projection));
+
+	else
+	{
+		checkf(Algorithms::Distance(Input)  >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+		checkf(Algorithms::Distance(Output) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Output)."));
+
+		const size_t Num      = Ranges::Num(Input) < Ranges::Num(Output) ? Ranges::Num(Input) : Ranges::Num(Output);
+		const size_t ChunkNum = NAMESPACE_PRIVATE::ParallelChunkNum(Num);
+
+		if (ChunkNum == 1) return Algorithms::InclusiveScan(Forward<R1>(Input), Forward<R2>(Output), Ref(Operation), Ref(Projection));
+
+		auto First    = Ranges::Begin(Input);
+		auto OutFirst = Ranges::Begin(Output);
+
+		TOptional<FValueType> Partials[NAMESPACE_PRIVATE::ParallelMaxChunkNum];
+
+		// The last chunk is not needed by the other chunks.
+		Execution::ParallelFor(ChunkNum - 1, [&](size_t Chunk)
+		{
+			const size_t ChunkFirst = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk);
+			const size_t ChunkLast  = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+			Partials[Chunk].Emplace(Algorithms::Reduce(Ranges::View(First + (ChunkFirst + 1), First + ChunkLast),
+				FValueType(Invoke(Projection, *(First + ChunkFirst))), Ref(Operation), Ref(Projection)));
+		});
+
+		for (size_t Chunk = 1; Chunk < ChunkNum - 1; ++Chunk)
+		{
+			*Partials[Chunk] = Invoke(Operation, FValueType(*Partials[Chunk - 1]), MoveTemp(*Partials[Chunk]));
+		}
+
+		Execution::ParallelFor(ChunkNum, [&](size_t Chunk)
+		{
+			const size_t ChunkFirst = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk);
+			const size_t ChunkLast  = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+			size_t Index = ChunkFirst;
+
+			FValueType Sum = Chunk == 0
+				? FValueType(Invoke(Projection, *(First + Index++)))
+				: FValueType(Invoke(Operation, MoveTemp(*Partials[Chunk - 1]), Invoke(Projection, *(First + Index++))));
+
+			*(OutFirst + ChunkFirst) = AsConst(Sum);
+
+			for (; Index != ChunkLast; ++Index)
+			{
+				Sum = Invoke(Operation, MoveTemp(Sum), Invoke(Projection, *(First + Index)));
+
+				*(OutFirst + Index) = AsConst(Sum);
+			}
+		});
+
+		return OutFirst + Num;
+	}
+}
+
+/**
+ * Computes the exclusive prefix sums of the range into the output range, the N-th output is the sum of the initial value
+ * and the first N elements. The input and output ranges may be the same range. If the output range is insufficient, return directly.
+ *
+ * @param Input      - The range of elements to scan.
+ * @param Output     - The output range to write the result.
+ * @param Init       - The initial value of the sums.
+ * @param Operation  - The associative binary operation to sum the projected elements.
+ * @param Projection - The projection to apply to the elements before summing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CRange R2, CMovable T,
+	CRegularInvocable<TRangeReference<R1>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<const T&, TInvokeResult<Proj, TRangeReference<R1>>> Op =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (COutputRange<R2, T> && CBorrowedRange<R2> && CConstructibleFrom<T, TInvokeResult<Op, const T&, TInvokeResult<Proj, TRangeReference<R1>>>>)
+constexpr TRangeIterator<R2> ExclusiveScan(R1&& Input, R2&& Output, T Init, Op Operation = { }, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(Input) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+	}
+
+	auto Iter = Ranges::Begin(Input);
+	auto Sent = Ranges::End  (Input);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	for (; Iter != Sent; ++Iter)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		// The element must be read before the output is written, since they may be the same object.
+		T Next(Invoke(Operation, AsConst(Init), Invoke(Projection, *Iter)));
+
+		*OutIter++ = MoveTemp(Init);
+
+		Init = MoveTemp(Next);
+	}
+
+	return OutIter;
+}
+
+/**
+ * Computes the exclusive prefix sums of the range into the output range with the execution policy.
+ * The parallel policies reduce the chunks of the range on the worker pool, and then scan the chunks on the worker pool
+ * from the sums of the previous chunks, so the operation is applied in the different grouping. The input and output ranges
+ * may be the same range. If the output range is insufficient, only the elements that fit are scanned.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Input      - The range of elements to scan.
+ * @param Output     - The output range to write the result.
+ * @param Init       - The initial value of the sums.
+ * @param Operation  - The associative binary operation to sum the projected elements.
+ * @param Projection - The projection to apply to the elements before summing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R1, CRandomAccessRange R2, CMovable T,
+	CRegularInvocable<TRangeReference<R1>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<const T&, TInvokeResult<Proj, TRangeReference<R1>>> Op =
+		NAMESPACE_PRIVATE::FNumericPlus>
+	requires (CSizedRange<R1&> && CSizedRange<R2&> && COutputRange<R2, T> && CBorrowedRange<R2>
+		&& CConstructibleFrom<T, TInvokeResult<Op, const T&, TInvokeResult<Proj, TRangeReference<R1>>>>
+		&& CConstructibleFrom<T, TInvokeResult<Proj, TRangeReference<R1>>>
+		&& CRegularInvocable<Op, T, T> && CAssignableFrom<T&, TInvokeResult<Op, T, T>>
+		&& CAssignableFrom<T&, TInvokeResult<Op, T, TInvokeResult<Proj, TRangeReference<R1>>>>)
+TRangeIterator<R2> ExclusiveScan(E&&, R1&& Input, R2&& Output, T Init, Op Operation = { }, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::ExclusiveScan(Forward<R1>(Input), Forward<R2>(Output), MoveTemp(Init), Ref(Operation), Ref(Projection));
+
+	else
+	{
+		checkf(Algorithms::Distance(Input)  >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+		checkf(Algorithms::Distance(Output) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Output)."));
+
+		const size_t Num      = Ranges::Num(Input) < Ranges::Num(Output) ? Ranges::Num(Input) : Ranges::Num(Output);
+		const size_t ChunkNum = NAMESPACE_PRIVATE::ParallelChunkNum(Num);
+
+		if (ChunkNum == 1) return Algorithms::ExclusiveScan(Forward<R1>(Input), Forward<R2>(Output), MoveTemp(Init), Ref(Operation), Ref(Projection));
+
+		auto First    = Ranges::Begin(Input);
+		auto OutFirst = Ranges::Begin(Output);
+
+		TOptional<T> Partials[NAMESPACE_PRIVATE::ParallelMaxChunkNum];
+
+		// The last chunk is not needed by the other chunks, and the first chunk starts from the initial value.
+		Execution::ParallelFor(ChunkNum - 1, [&](size_t Chunk)
+		{
+			const size_t ChunkFirst = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk);
+			const size_t ChunkLast  = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+			Partials[Chunk + 1].Emplace(Algorithms::Reduce(Ranges::View(First + (ChunkFirst + 1), First + ChunkLast),
+				T(Invoke(Projection, *(First + ChunkFirst))), Ref(Operation), Ref(Projection)));
+		});
+
+		Partials[0].Emplace(MoveTemp(Init));
+
+		for (size_t Chunk = 1; Chunk < ChunkNum; ++Chunk)
+		{
+			*Partials[Chunk] = Invoke(Operation, T(*Partials[Chunk - 1]), MoveTemp(*Partials[Chunk]));
+		}
+
+		Execution::ParallelFor(ChunkNum, [&](size_t Chunk)
+		{
+			const size_t ChunkFirst = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk);
+			const size_t ChunkLast  = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+			T Sum = MoveTemp(*Partials[Chunk]);
+
+			for (size_t Index = ChunkFirst; Index != ChunkLast; ++Index)
+			{
+				T Next(Invoke(Operation, AsConst(Sum), Invoke(Projection, *(First + Index))));
+
+				*(OutFirst + Index) = MoveTemp(Sum);
+
+				Sum = MoveTemp(Next);
+			}
+		});
+
+		return OutFirst + Num;
+	}
+}
+
+/**
+ * Computes the differences between the adjacent elements of the range into the output range, the first output is
+ * the first element and the N-th output is the operation of the N-th and the (N - 1)-th elements. The input and output
+ * ranges may be the same range. If the output range is insufficient, return directly.
+ *
+ * @param Input      - The range of elements to examine.
+ * @param Output     - The output range to write the result.
+ * @param Operation  - The binary operation of the current and the previous projected elements.
+ * @param Projection - The projection to apply to the elements before computing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CRange R2,
+	CRegularInvocable<TRangeReference<R1>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&> Op =
+		NAMESPACE_PRIVATE::FNumericMinus>
+	requires (COutputRange<R2, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&> && CBorrowedRange<R2>
+		&& COutputRange<R2, TInvokeResult<Op, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&>>
+		&& CConstructibleFrom<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TInvokeResult<Proj, TRangeReference<R1>>>
+		&& CMovable<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>>)
+constexpr TRangeIterator<R2> AdjacentDifference(R1&& Input, R2&& Output, Op Operation = { }, Proj Projection = { })
+{
+	using FValueType = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>;
+
+	if constexpr (CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(Input) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+	}
+
+	auto Iter = Ranges::Begin(Input);
+	auto Sent = Ranges::End  (Input);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	if (Iter == Sent || OutIter == OutSent) return OutIter;
+
+	FValueType Previous(Invoke(Projection, *Iter));
+
+	*OutIter++ = AsConst(Previous);
+
+	for (++Iter; Iter != Sent; ++Iter)
+	{
+		if (OutIter == OutSent) UNLIKELY return OutIter;
+
+		FValueType Current(Invoke(Projection, *Iter));
+
+		*OutIter++ = Invoke(Operation, AsConst(Current), AsConst(Previous));
+
+		Previous = MoveTemp(Current);
+	}
+
+	return OutIter;
+}
+
+/**
+ * Computes the differences between the adjacent elements of the range into the output range with the execution policy.
+ * The parallel policies compute the chunks of the range on the worker pool, and the elements before the chunks are read
+ * in advance, so the input and output ranges may be the same range. If the output range is insufficient,
+ * only the elements that fit are computed.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Input      - The range of elements to examine.
+ * @param Output     - The output range to write the result.
+ * @param Operation  - The binary operation of the current and the previous projected elements.
+ * @param Projection - The projection to apply to the elements before computing.
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R1, CRandomAccessRange R2,
+	CRegularInvocable<TRangeReference<R1>> Proj =
+		NAMESPACE_PRIVATE::FNumericIdentity,
+	CRegularInvocable<const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&> Op =
+		NAMESPACE_PRIVATE::FNumericMinus>
+	requires (CSizedRange<R1&> && CSizedRange<R2&>
+		&& COutputRange<R2, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&> && CBorrowedRange<R2>
+		&& COutputRange<R2, TInvokeResult<Op, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&, const TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>&>>
+		&& CConstructibleFrom<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>, TInvokeResult<Proj, TRangeReference<R1>>>
+		&& CMovable<TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>>)
+TRangeIterator<R2> AdjacentDifference(E&&, R1&& Input, R2&& Output, Op Operation = { }, Proj Projection = { })
+{
+	using FValueType = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R1>>>;
+
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::AdjacentDifference(Forward<R1>(Input), Forward<R2>(Output), Ref(Operation), Ref(Projection));
+
+	else
+	{
+		checkf(Algorithms::Distance(Input)  >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+		checkf(Algorithms::Distance(Output) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Output)."));
+
+		const size_t Num      = Ranges::Num(Input) < Ranges::Num(Output) ? Ranges::Num(Input) : Ranges::Num(Output);
+		const size_t ChunkNum = NAMESPACE_PRIVATE::ParallelChunkNum(Num);
+
+		if (ChunkNum == 1) return Algorithms::AdjacentDifference(Forward<R1>(Input), Forward<R2>(Output), Ref(Operation), Ref(Projection));
+
+		auto First    = Ranges::Begin(Input);
+		auto OutFirst = Ranges::Begin(Output);
+
+		TOptional<FValueType> Previous[NAMESPACE_PRIVATE::ParallelMaxChunkNum];
+
+		for (size_t Chunk = 1; Chunk != ChunkNum; ++Chunk)
+		{
+			Previous[Chunk].Emplace(Invoke(Projection, *(First + (NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk) - 1))));
+		}
+
+		Execution::ParallelFor(ChunkNum, [&](size_t Chunk)
+		{
+			const size_t ChunkFirst = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk);
+			const size_t ChunkLast  = NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+			size_t Index = ChunkFirst;
+
+			if (Chunk == 0)
+			{
+				Previous[0].Emplace(Invoke(Projection, *(First + Index)));
+
+				*(OutFirst + Index++) = AsConst(*Previous[0]);
+			}
+
+			FValueType Last = MoveTemp(*Previous[Chunk]);
+
+			for (; Index != ChunkLast; ++Index)
+			{
+				FValueType Current(Invoke(Projection, *(First + Index)));
+
+				*(OutFirst + Index) = Invoke(Operation, AsConst(Current), AsConst(Last));
+
+				Last = MoveTemp(Current);
+			}
+		});
+
+		return OutFirst + Num;
+	}
+}
+
+NAMESPACE_END(Algorithms)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
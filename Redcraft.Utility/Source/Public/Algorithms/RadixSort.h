@@ -0,0 +1,392 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Invoke.h"
+#include "Templates/ReferenceWrapper.h"
+#include "Iterators/Utility.h"
+#include "Iterators/Sentinel.h"
+#include "Iterators/BasicIterator.h"
+#include "Ranges/Utility.h"
+#include "Ranges/View.h"
+#include "Algorithms/Basic.h"
+#include "Algorithms/Sort.h"
+#include "Memory/Allocators.h"
+#include "Memory/MemoryOperator.h"
+#include "Numerics/Bit.h"
+#include "Strings/StringView.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+/** A concept specifies the key type can be ordered by its bytes after being transformed to an unsigned integer. */
+template <typename T>
+concept CRadixSortKey = CIntegral<T> || CEnum<T> || (CFloatingPoint<T> && (sizeof(T) == 4 || sizeof(T) == 8));
+
+/** A concept specifies the elements of the iterator can be radix sorted by the projected keys. */
+template <typename I, typename Proj>
+concept CRadixSortable = CSortable<I, Proj>
+	&& (CRadixSortKey<TRemoveCVRef<TInvokeResult<Proj, TIteratorElement<I>&>>>
+	|| CTStringView<TRemoveCVRef<TInvokeResult<Proj, TIteratorElement<I>&>>>);
+
+constexpr ptrdiff RadixSortInsertionThreshold = 64;
+constexpr ptrdiff RadixSortStringThreshold    = 32;
+
+/** Transforms the key to an unsigned integer whose order is the same as the order of the key. */
+template <CRadixSortKey T>
+NODISCARD FORCEINLINE constexpr auto RadixKey(T Value)
+{
+	if constexpr (CEnum<T>) return RadixKey(static_cast<TUnderlyingType<T>>(Value));
+
+	else if constexpr (CSameAs<T, bool>) return static_cast<uint8>(Value);
+
+	else if constexpr (CIntegral<T>)
+	{
+		using FUnsigned = TMakeUnsigned<T>;
+
+		if constexpr (CSigned<T>) return static_cast<FUnsigned>(static_cast<FUnsigned>(Value) ^ (static_cast<FUnsigned>(1) << (sizeof(T) * 8 - 1)));
+
+		else return static_cast<FUnsigned>(Value);
+	}
+
+	else
+	{
+		// Flip all bits of the negative numbers and only the sign bit of the positive numbers,
+		// so that the negative numbers come first and their order is reversed.
+		using FUnsigned = TConditional<sizeof(T) == 4, uint32, uint64>;
+
+		const FUnsigned Bits    = Math::BitCast<FUnsigned>(Value);
+		const FUnsigned SignBit = static_cast<FUnsigned>(1) << (sizeof(T) * 8 - 1);
+
+		return static_cast<FUnsigned>(Bits & SignBit ? ~Bits : Bits | SignBit);
+	}
+}
+
+/** Transforms the character to an unsigned integer whose order is the same as the order of the character. */
+template <CCharType T>
+NODISCARD FORCEINLINE constexpr auto RadixChar(T Char)
+{
+	using FUnsigned = TMakeUnsigned<T>;
+
+	if constexpr (CSigned<T>) return static_cast<FUnsigned>(static_cast<FUnsigned>(Char) ^ (static_cast<FUnsigned>(1) << (sizeof(T) * 8 - 1)));
+
+	else return static_cast<FUnsigned>(Char);
+}
+
+/** Moves the elements from the source to the destination, in the stable order of the digit of the keys. */
+template <typename I, typename J, typename F>
+FORCEINLINE void RadixScatter(I Source, J Destination, ptrdiff Num, size_t(& Offsets)[256], uint Shift, F KeyOf)
+{
+	for (ptrdiff Index = 0; Index != Num; ++Index)
+	{
+		const size_t Digit = static_cast<size_t>(KeyOf(*(Source + Index)) >> Shift) & 0xFF;
+
+		*(Destination + Offsets[Digit]++) = MoveTemp(*(Source + Index));
+	}
+}
+
+/**
+ * Sorts the elements by the least significant digit radix sort with 8-bit digits.
+ * The buffer must hold 'Num' constructed elements, and 'bInBuffer' indicates whether the elements to sort are in the buffer.
+ * The sorted elements are always put back to the range.
+ */
+template <typename I, typename T, typename F>
+void LSDRadixSort(I First, T* Buffer, ptrdiff Num, bool bInBuffer, F KeyOf)
+{
+	using FKeyType = decltype(KeyOf(*First));
+
+	constexpr size_t NumPasses = sizeof(FKeyType);
+
+	size_t Counts[NumPasses][256] = { };
+
+	// Count all digits in a single pass over the elements.
+	for (ptrdiff Index = 0; Index != Num; ++Index)
+	{
+		const FKeyType Key = bInBuffer ? KeyOf(Buffer[Index]) : KeyOf(*(First + Index));
+
+		for (size_t Pass = 0; Pass != NumPasses; ++Pass)
+		{
+			++Counts[Pass][static_cast<size_t>(Key >> Pass * 8) & 0xFF];
+		}
+	}
+
+	for (size_t Pass = 0; Pass != NumPasses; ++Pass)
+	{
+		const FKeyType Key = bInBuffer ? KeyOf(Buffer[0]) : KeyOf(*First);
+
+		// Skip the pass if all elements have the same digit.
+		if (Counts[Pass][static_cast<size_t>(Key >> Pass * 8) & 0xFF] == static_cast<size_t>(Num)) continue;
+
+		size_t Offsets[256];
+
+		for (size_t Digit = 0, Offset = 0; Digit != 256; ++Digit)
+		{
+			Offsets[Digit] = Offset;
+
+			Offset += Counts[Pass][Digit];
+		}
+
+		if (bInBuffer) RadixScatter(Buffer, First,  Num, Offsets, static_cast<uint>(Pass * 8), KeyOf);
+		else           RadixScatter(First,  Buffer, Num, Offsets, static_cast<uint>(Pass * 8), KeyOf);
+
+		bInBuffer = !bInBuffer;
+	}
+
+	if (bInBuffer)
+	{
+		for (ptrdiff Index = 0; Index != Num; ++Index) *(First + Index) = MoveTemp(Buffer[Index]);
+	}
+}
+
+/** @return The digit of the string key at the byte position, where 0 means the end of the string. */
+template <typename T>
+NODISCARD FORCEINLINE size_t RadixStringDigit(TStringView<T> Key, size_t Depth)
+{
+	const size_t CharIndex = Depth / sizeof(T);
+
+	if (CharIndex >= Key.Num()) return 0;
+
+	const size_t Shift = (sizeof(T) - 1 - Depth % sizeof(T)) * 8;
+
+	return (static_cast<size_t>(RadixChar(Key[CharIndex]) >> Shift) & 0xFF) + 1;
+}
+
+/** Compares the string keys from the character at the byte position, assuming that the characters before it are equal. */
+template <typename T>
+NODISCARD FORCEINLINE bool RadixStringLess(TStringView<T> LHS, TStringView<T> RHS, size_t Depth)
+{
+	for (size_t Index = Depth / sizeof(T); Index < LHS.Num() && Index < RHS.Num(); ++Index)
+	{
+		if (LHS[Index] != RHS[Index]) return RadixChar(LHS[Index]) < RadixChar(RHS[Index]);
+	}
+
+	return LHS.Num() < RHS.Num();
+}
+
+/**
+ * Sorts the elements by the most significant digit radix sort of the string keys with 8-bit digits.
+ * The buffer must hold 'Num' constructed elements, which are used as the temporary storage of the scatter.
+ */
+template <typename I, typename T, typename F>
+void MSDRadixSort(I First, T* Buffer, ptrdiff Num, size_t Depth, F KeyOf)
+{
+	while (true)
+	{
+		if (Num <= RadixSortStringThreshold)
+		{
+			NAMESPACE_PRIVATE::InsertionSort(First, First + Num, [&KeyOf, Depth](auto&& A, auto&& B) { return RadixStringLess(KeyOf(A), KeyOf(B), Depth); });
+
+			return;
+		}
+
+		size_t Counts[257] = { };
+
+		for (ptrdiff Index = 0; Index != Num; ++Index) ++Counts[RadixStringDigit(KeyOf(*(First + Index)), Depth)];
+
+		if (Counts[0] == static_cast<size_t>(Num)) return;
+
+		// Go to the next digit directly if all elements have the same digit.
+		if (Counts[RadixStringDigit(KeyOf(*First), Depth)] == static_cast<size_t>(Num))
+		{
+			++Depth;
+
+			continue;
+		}
+
+		size_t Offsets[257];
+
+		for (size_t Digit = 0, Offset = 0; Digit != 257; ++Digit)
+		{
+			Offsets[Digit] = Offset;
+
+			Offset += Counts[Digit];
+		}
+
+		for (ptrdiff Index = 0; Index != Num; ++Index)
+		{
+			Buffer[Offsets[RadixStringDigit(KeyOf(*(First + Index)), Depth)]++] = MoveTemp(*(First + Index));
+		}
+
+		for (ptrdiff Index = 0; Index != Num; ++Index) *(First + Index) = MoveTemp(Buffer[Index]);
+
+		// Recurse into the buckets except the largest one, which is sorted by the loop, to limit the recursion depth to O(log N).
+		size_t Largest = 1;
+
+		for (size_t Digit = 2; Digit != 257; ++Digit)
+		{
+			if (Counts[Digit] > Counts[Largest]) Largest = Digit;
+		}
+
+		for (size_t Digit = 1; Digit != 257; ++Digit)
+		{
+			if (Digit == Largest || Counts[Digit] <= 1) continue;
+
+			const ptrdiff Offset = static_cast<ptrdiff>(Offsets[Digit] - Counts[Digit]);
+
+			MSDRadixSort(First + Offset, Buffer + Offset, static_cast<ptrdiff>(Counts[Digit]), Depth + 1, KeyOf);
+		}
+
+		const ptrdiff Offset = static_cast<ptrdiff>(Offsets[Largest] - Counts[Largest]);
+
+		First  += Offset;
+		Buffer += Offset;
+		Num     = static_cast<ptrdiff>(Counts[Largest]);
+
+		++Depth;
+	}
+}
+
+/** Sorts the elements with the buffer of 'Num' constructed elements, which may hold the elements to sort if 'bInBuffer' is true. */
+template <typename I, typename T, typename Proj>
+void RadixSort(I First, T* Buffer, ptrdiff Num, bool bInBuffer, Proj& Projection)
+{
+	using FKeyType = TRemoveCVRef<TInvokeResult<Proj, TIteratorElement<I>&>>;
+
+	if constexpr (CTStringView<FKeyType>)
+	{
+		auto KeyOf = [&Projection]<typename U>(U& A) -> FKeyType { return Invoke(Projection, A); };
+
+		if (bInBuffer)
+		{
+			for (ptrdiff Index = 0; Index != Num; ++Index) *(First + Index) = MoveTemp(Buffer[Index]);
+		}
+
+		NAMESPACE_PRIVATE::MSDRadixSort(First, Buffer, Num, 0, KeyOf);
+	}
+	else
+	{
+		auto KeyOf = [&Projection]<typename U>(U& A) { return NAMESPACE_PRIVATE::RadixKey(static_cast<FKeyType>(Invoke(Projection, A))); };
+
+		NAMESPACE_PRIVATE::LSDRadixSort(First, Buffer, Num, bInBuffer, KeyOf);
+	}
+}
+
+NAMESPACE_PRIVATE_END
+
+NAMESPACE_BEGIN(Algorithms)
+
+/**
+ * Sorts the elements in the range in ascending order of the keys by the radix sort. The order of equal elements is preserved.
+ * The keys can be integral, enumeration or floating-point values, which are sorted by the least significant digit radix sort in O(N),
+ * or string views, which are sorted lexicographically by the most significant digit radix sort. The negative zero is ordered before
+ * the positive zero, and the NaNs are ordered by their bits. A temporary buffer of N elements is allocated by the allocator.
+ *
+ * @param Range      - The range to sort.
+ * @param Projection - The projection to apply to the elements to get the keys.
+ */
+template <typename Allocator = FHeapAllocator, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); })>
+	requires (NAMESPACE_PRIVATE::CRadixSortable<TRangeIterator<R>, Proj> && CAllocator<Allocator, TRangeElement<R>>)
+void RadixSort(R&& Range, Proj Projection = { })
+{
+	using FElementType = TRangeElement<R>;
+
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto First = Ranges::Begin(Range);
+	auto Last  = Algorithms::Next(First, Ranges::End(Range));
+
+	const ptrdiff Num = Last - First;
+
+	using FKeyType = TRemoveCVRef<TInvokeResult<Proj, FElementType&>>;
+
+	if constexpr (!CTStringView<FKeyType>)
+	{
+		if (Num <= NAMESPACE_PRIVATE::RadixSortInsertionThreshold)
+		{
+			NAMESPACE_PRIVATE::InsertionSort(First, Last, [&Projection](auto&& LHS, auto&& RHS)
+			{
+				return NAMESPACE_PRIVATE::RadixKey(static_cast<FKeyType>(Invoke(Projection, LHS)))
+					 < NAMESPACE_PRIVATE::RadixKey(static_cast<FKeyType>(Invoke(Projection, RHS)));
+			});
+
+			return;
+		}
+	}
+
+	if (Num <= 1) return;
+
+	typename Allocator::template TForElementType<FElementType> AllocatorInstance;
+
+	FElementType* Buffer = AllocatorInstance.Allocate(AllocatorInstance.CalculateSlackReserve(Num));
+
+	for (ptrdiff Index = 0; Index != Num; ++Index) new (Buffer + Index) FElementType(MoveTemp(*(First + Index)));
+
+	NAMESPACE_PRIVATE::RadixSort(First, Buffer, Num, true, Projection);
+
+	Memory::Destruct(Buffer, Num);
+
+	AllocatorInstance.Deallocate(Buffer);
+}
+
+/**
+ * Sorts the elements in the range in ascending order of the keys by the radix sort. The order of equal elements is preserved.
+ * The keys can be integral, enumeration or floating-point values, which are sorted by the least significant digit radix sort in O(N),
+ * or string views, which are sorted lexicographically by the most significant digit radix sort. The negative zero is ordered before
+ * the positive zero, and the NaNs are ordered by their bits. A temporary buffer of N elements is allocated by the allocator.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Projection - The projection to apply to the elements to get the keys.
+ */
+template <typename Allocator = FHeapAllocator, CRandomAccessIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); })>
+	requires (NAMESPACE_PRIVATE::CRadixSortable<I, Proj> && CAllocator<Allocator, TIteratorElement<I>>)
+FORCEINLINE void RadixSort(I First, S Last, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	Algorithms::RadixSort<Allocator>(Ranges::View(MoveTemp(First), Last), Ref(Projection));
+}
+
+/**
+ * Sorts the elements in the range in ascending order of the keys by the radix sort, using the given buffer as the temporary storage.
+ * The buffer must be a contiguous range of at least as many elements as the range, and its elements are unspecified after sorting.
+ * This is useful to sort many batches without allocating a temporary buffer each time.
+ *
+ * @param Range      - The range to sort.
+ * @param Buffer     - The temporary storage of the elements.
+ * @param Projection - The projection to apply to the elements to get the keys.
+ */
+template <CRandomAccessRange R, CContiguousRange B,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); })>
+	requires (NAMESPACE_PRIVATE::CRadixSortable<TRangeIterator<R>, Proj> && CSizedRange<B&>
+		&& CSameAs<TRangeReference<B>, TRangeElement<R>&>)
+void RadixSort(R&& Range, B&& Buffer, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto First = Ranges::Begin(Range);
+	auto Last  = Algorithms::Next(First, Ranges::End(Range));
+
+	const ptrdiff Num = Last - First;
+
+	checkf(Num <= static_cast<ptrdiff>(Ranges::Num(Buffer)), TEXT("The buffer is too small. Please check Ranges::Num(Buffer)."));
+
+	if (Num <= 1) return;
+
+	NAMESPACE_PRIVATE::RadixSort(First, Ranges::GetData(Buffer), Num, false, Projection);
+}
+
+NAMESPACE_END(Algorithms)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
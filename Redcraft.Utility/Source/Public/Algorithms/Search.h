@@ -14,12 +14,265 @@
 #include "Ranges/Utility.h"
 #include "Ranges/View.h"
 #include "Algorithms/Basic.h"
+#include "Algorithms/ExecutionPolicy.h"
+#include "Memory/Memory.h"
+#include "Numerics/Bit.h"
 #include "Miscellaneous/AssertionMacros.h"
 
+#if PLATFORM_HAS_AVX2
+#	include <immintrin.h>
+#elif PLATFORM_HAS_SSE2
+#	include <emmintrin.h>
+#endif
+
 NAMESPACE_REDCRAFT_BEGIN
 NAMESPACE_MODULE_BEGIN(Redcraft)
 NAMESPACE_MODULE_BEGIN(Utility)
 
+NAMESPACE_PRIVATE_BEGIN
+
+/** The default projection of the value search algorithms, which is a named type so that the vectorized versions can be selected. */
+struct FSearchIdentity
+{
+	template <typename T>
+	NODISCARD FORCEINLINE constexpr T&& operator()(T&& A) const { return Forward<T>(A); }
+};
+
+/** The default predicate of the value search algorithms, which is a named type so that the vectorized versions can be selected. */
+struct FSearchEqualTo
+{
+	template <typename LHS, typename RHS>
+	NODISCARD FORCEINLINE constexpr bool operator()(const LHS& A, const RHS& B) const { return A == B; }
+};
+
+/**
+ * A concept specifies the elements of the iterator can be compared by their object representations,
+ * which holds for the contiguous integral elements with the default projection and predicate.
+ */
+template <typename I, typename Proj, typename Pred>
+concept CSearchVectorizable = CContiguousIterator<I>
+	&& CIntegral<TIteratorElement<I>> && !CSameAs<TIteratorElement<I>, bool>
+	&& CSameAs<TRemoveCVRef<TUnwrapRefDecay<Proj>>, FSearchIdentity>
+	&& CSameAs<TRemoveCVRef<TUnwrapRefDecay<Pred>>, FSearchEqualTo>;
+
+template <typename T>
+using TSearchWord = TConditional<sizeof(T) == 1, uint8, TConditional<sizeof(T) == 2, uint16, TConditional<sizeof(T) == 4, uint32, uint64>>>;
+
+/** The counting lanes are flushed after this number of blocks, before the 8-bit lanes overflow. */
+constexpr size_t SearchCountFlushInterval = 255;
+
+#if PLATFORM_HAS_AVX2
+
+template <typename T> FORCEINLINE __m256i SearchBroadcast256(T Value) { if constexpr (sizeof(T) == 1) return _mm256_set1_epi8(static_cast<int8>(Value)); else if constexpr (sizeof(T) == 2) return _mm256_set1_epi16(static_cast<int16>(Value)); else if constexpr (sizeof(T) == 4) return _mm256_set1_epi32(static_cast<int32>(Value)); else return _mm256_set1_epi64x(static_cast<int64>(Value)); }
+template <typename T> FORCEINLINE __m256i SearchCompare(__m256i LHS, __m256i RHS) { if constexpr (sizeof(T) == 1) return _mm256_cmpeq_epi8(LHS, RHS); else if constexpr (sizeof(T) == 2) return _mm256_cmpeq_epi16(LHS, RHS); else if constexpr (sizeof(T) == 4) return _mm256_cmpeq_epi32(LHS, RHS); else return _mm256_cmpeq_epi64(LHS, RHS); }
+template <typename T> FORCEINLINE __m256i SearchSubtract(__m256i LHS, __m256i RHS) { if constexpr (sizeof(T) == 1) return _mm256_sub_epi8(LHS, RHS); else if constexpr (sizeof(T) == 2) return _mm256_sub_epi16(LHS, RHS); else if constexpr (sizeof(T) == 4) return _mm256_sub_epi32(LHS, RHS); else return _mm256_sub_epi64(LHS, RHS); }
+
+#endif
+
+#if PLATFORM_HAS_SSE2
+
+template <typename T> FORCEINLINE __m128i SearchBroadcast128(T Value) { if constexpr (sizeof(T) == 1) return _mm_set1_epi8(static_cast<int8>(Value)); else if constexpr (sizeof(T) == 2) return _mm_set1_epi16(static_cast<int16>(Value)); else if constexpr (sizeof(T) == 4) return _mm_set1_epi32(static_cast<int32>(Value)); else return _mm_set1_epi64x(static_cast<int64>(Value)); }
+template <typename T> FORCEINLINE __m128i SearchSubtract(__m128i LHS, __m128i RHS) { if constexpr (sizeof(T) == 1) return _mm_sub_epi8(LHS, RHS); else if constexpr (sizeof(T) == 2) return _mm_sub_epi16(LHS, RHS); else if constexpr (sizeof(T) == 4) return _mm_sub_epi32(LHS, RHS); else return _mm_sub_epi64(LHS, RHS); }
+
+template <typename T>
+FORCEINLINE __m128i SearchCompare(__m128i LHS, __m128i RHS)
+{
+	if constexpr (sizeof(T) == 1) return _mm_cmpeq_epi8 (LHS, RHS);
+	if constexpr (sizeof(T) == 2) return _mm_cmpeq_epi16(LHS, RHS);
+	if constexpr (sizeof(T) == 4) return _mm_cmpeq_epi32(LHS, RHS);
+
+	// SSE2 has no 64-bit comparison, so the 64-bit lanes are equal if both of their 32-bit halves are equal.
+	if constexpr (sizeof(T) == 8)
+	{
+		const __m128i Result = _mm_cmpeq_epi32(LHS, RHS);
+
+		return _mm_and_si128(Result, _mm_shuffle_epi32(Result, _MM_SHUFFLE(2, 3, 0, 1)));
+	}
+}
+
+#endif
+
+/** @return The index of the first element that equals the value, or 'Num' if not found. */
+template <typename T>
+NODISCARD size_t VectorizedFind(const T* Data, size_t Num, T Value)
+{
+	if constexpr (sizeof(T) == 1)
+	{
+		const void* Result = Memory::Memchr(Data, static_cast<uint8>(Value), Num);
+
+		return Result != nullptr ? static_cast<const T*>(Result) - Data : Num;
+	}
+
+	else
+	{
+		size_t Index = 0;
+
+#		if PLATFORM_HAS_AVX2
+		{
+			constexpr size_t Lanes = sizeof(__m256i) / sizeof(T);
+
+			const __m256i Target = SearchBroadcast256(Value);
+
+			for (; Index + Lanes <= Num; Index += Lanes)
+			{
+				const __m256i Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Index));
+
+				const uint32 Mask = static_cast<uint32>(_mm256_movemask_epi8(SearchCompare<T>(Block, Target)));
+
+				if (Mask != 0) return Index + Math::CountRightZero(Mask) / sizeof(T);
+			}
+		}
+#		endif
+
+#		if PLATFORM_HAS_SSE2
+		{
+			constexpr size_t Lanes = sizeof(__m128i) / sizeof(T);
+
+			const __m128i Target = SearchBroadcast128(Value);
+
+			for (; Index + Lanes <= Num; Index += Lanes)
+			{
+				const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Index));
+
+				const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(SearchCompare<T>(Block, Target)));
+
+				if (Mask != 0) return Index + Math::CountRightZero(Mask) / sizeof(T);
+			}
+		}
+#		endif
+
+		for (; Index != Num; ++Index)
+		{
+			if (Data[Index] == Value) return Index;
+		}
+
+		return Num;
+	}
+}
+
+/** @return The number of elements that equal the value. */
+template <typename T>
+NODISCARD size_t VectorizedCount(const T* Data, size_t Num, T Value)
+{
+	size_t Index  = 0;
+	size_t Result = 0;
+
+	// The matched lanes are all ones, so subtracting the masks from the counters increments them.
+	auto Flush = []<typename U>(const U& Counter)
+	{
+		TSearchWord<T> Counts[sizeof(U) / sizeof(T)];
+
+		Memory::Memcpy(Counts, &Counter, sizeof(U));
+
+		size_t Sum = 0;
+
+		for (TSearchWord<T> Count : Counts) Sum += Count;
+
+		return Sum;
+	};
+
+#	if PLATFORM_HAS_AVX2
+	{
+		constexpr size_t Lanes = sizeof(__m256i) / sizeof(T);
+
+		const __m256i Target = SearchBroadcast256(Value);
+
+		while (Index + Lanes <= Num)
+		{
+			__m256i Counter = _mm256_setzero_si256();
+
+			for (size_t Step = 0; Step != SearchCountFlushInterval && Index + Lanes <= Num; ++Step, Index += Lanes)
+			{
+				const __m256i Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Index));
+
+				Counter = SearchSubtract<T>(Counter, SearchCompare<T>(Block, Target));
+			}
+
+			Result += Flush(Counter);
+		}
+	}
+#	endif
+
+#	if PLATFORM_HAS_SSE2
+	{
+		constexpr size_t Lanes = sizeof(__m128i) / sizeof(T);
+
+		const __m128i Target = SearchBroadcast128(Value);
+
+		while (Index + Lanes <= Num)
+		{
+			__m128i Counter = _mm_setzero_si128();
+
+			for (size_t Step = 0; Step != SearchCountFlushInterval && Index + Lanes <= Num; ++Step, Index += Lanes)
+			{
+				const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Index));
+
+				Counter = SearchSubtract<T>(Counter, SearchCompare<T>(Block, Target));
+			}
+
+			Result += Flush(Counter);
+		}
+	}
+#	endif
+
+	for (; Index != Num; ++Index)
+	{
+		if (Data[Index] == Value) ++Result;
+	}
+
+	return Result;
+}
+
+/** @return The index of the first pair of elements that are not equal, or 'Num' if not found. */
+template <typename T>
+NODISCARD size_t VectorizedMismatch(const T* LHS, const T* RHS, size_t Num)
+{
+	// The integral elements are equal if and only if all of their bytes are equal, so the bytes are compared regardless of the element size.
+	size_t Index = 0;
+
+	const size_t Count = Num * sizeof(T);
+
+	const uint8* BytesLHS = reinterpret_cast<const uint8*>(LHS);
+	const uint8* BytesRHS = reinterpret_cast<const uint8*>(RHS);
+
+#	if PLATFORM_HAS_AVX2
+	{
+		for (; Index + sizeof(__m256i) <= Count; Index += sizeof(__m256i))
+		{
+			const __m256i BlockLHS = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(BytesLHS + Index));
+			const __m256i BlockRHS = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(BytesRHS + Index));
+
+			const uint32 Mask = ~static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(BlockLHS, BlockRHS)));
+
+			if (Mask != 0) return (Index + Math::CountRightZero(Mask)) / sizeof(T);
+		}
+	}
+#	endif
+
+#	if PLATFORM_HAS_SSE2
+	{
+		for (; Index + sizeof(__m128i) <= Count; Index += sizeof(__m128i))
+		{
+			const __m128i BlockLHS = _mm_loadu_si128(reinterpret_cast<const __m128i*>(BytesLHS + Index));
+			const __m128i BlockRHS = _mm_loadu_si128(reinterpret_cast<const __m128i*>(BytesRHS + Index));
+
+			const uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(BlockLHS, BlockRHS))) ^ 0xFFFF;
+
+			if (Mask != 0) return (Index + Math::CountRightZero(Mask)) / sizeof(T);
+		}
+	}
+#	endif
+
+	for (Index /= sizeof(T); Index != Num; ++Index)
+	{
+		if (LHS[Index] != RHS[Index]) return Index;
+	}
+
+	return Num;
+}
+
+NAMESPACE_PRIVATE_END
+
 NAMESPACE_BEGIN(Algorithms)
 
 /**
@@ -208,11 +461,11 @@ NODISCARD FORCEINLINE constexpr bool NoneOf(I First, S Last, Pred Predicate, Pro
  */
 template <CInputRange R,
 	CRegularInvocable<TRangeReference<R>> Proj =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
 	CEquivalenceRelation<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 NODISCARD FORCEINLINE constexpr bool Contains(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
 {
 	if constexpr (CSizedRange<R&>)
@@ -220,6 +473,11 @@ NODISCARD FORCEINLINE constexpr bool Contains(R&& Range, const T& Value, Pred Pr
 		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
 	}
 
+	if constexpr (CSizedRange<R&> && CSameAs<TRangeElement<R>, T> && NAMESPACE_PRIVATE::CSearchVectorizable<TRangeIterator<R>, Proj, Pred>)
+	{
+		if (!IsConstantEvaluated()) return NAMESPACE_PRIVATE::VectorizedFind(ToAddress(Ranges::Begin(Range)), Ranges::Num(Range), Value) != Ranges::Num(Range);
+	}
+
 	auto Iter = Ranges::Begin(Range);
 	auto Sent = Ranges::End  (Range);
 
@@ -247,11 +505,11 @@ NODISCARD FORCEINLINE constexpr bool Contains(R&& Range, const T& Value, Pred Pr
  */
 template <CInputIterator I, CSentinelFor<I> S,
 	CRegularInvocable<TIteratorReference<I>> Proj =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
 	CEquivalenceRelation<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 NODISCARD FORCEINLINE constexpr bool Contains(I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
 {
 	if constexpr (CSizedSentinelFor<S, I>)
@@ -371,11 +629,11 @@ NODISCARD FORCEINLINE constexpr bool Contains(I1 HaystackFirst, S1 HaystackLast,
  */
 template <CInputRange R,
 	CRegularInvocable<TRangeReference<R>> Proj =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
 	CEquivalenceRelation<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 	requires (CBorrowedRange<R>)
 NODISCARD constexpr TRangeIterator<R> Find(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
 {
@@ -384,6 +642,11 @@ NODISCARD constexpr TRangeIterator<R> Find(R&& Range, const T& Value, Pred Predi
 		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
 	}
 
+	if constexpr (CSizedRange<R&> && CSameAs<TRangeElement<R>, T> && NAMESPACE_PRIVATE::CSearchVectorizable<TRangeIterator<R>, Proj, Pred>)
+	{
+		if (!IsConstantEvaluated()) return Ranges::Begin(Range) + NAMESPACE_PRIVATE::VectorizedFind(ToAddress(Ranges::Begin(Range)), Ranges::Num(Range), Value);
+	}
+
 	auto Iter = Ranges::Begin(Range);
 	auto Sent = Ranges::End  (Range);
 
@@ -411,11 +674,11 @@ NODISCARD constexpr TRangeIterator<R> Find(R&& Range, const T& Value, Pred Predi
  */
 template <CInputIterator I, CSentinelFor<I> S,
 	CRegularInvocable<TIteratorReference<I>> Proj =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
 	CEquivalenceRelation<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 NODISCARD FORCEINLINE constexpr I Find(I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
 {
 	if constexpr (CSizedSentinelFor<S, I>)
@@ -1275,11 +1538,11 @@ NODISCARD FORCEINLINE constexpr I FindAdjacent(I First, S Last, Pred Predicate =
  */
 template <CInputRange R,
 	CRegularInvocable<TRangeReference<R>> Proj =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
 	CEquivalenceRelation<TInvokeResult<Proj, TRangeReference<R>>, T> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 NODISCARD constexpr size_t Count(R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
 {
 	if constexpr (CSizedRange<R&>)
@@ -1287,6 +1550,11 @@ NODISCARD constexpr size_t Count(R&& Range, const T& Value, Pred Predicate = { }
 		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
 	}
 
+	if constexpr (CSizedRange<R&> && CSameAs<TRangeElement<R>, T> && NAMESPACE_PRIVATE::CSearchVectorizable<TRangeIterator<R>, Proj, Pred>)
+	{
+		if (!IsConstantEvaluated()) return NAMESPACE_PRIVATE::VectorizedCount(ToAddress(Ranges::Begin(Range)), Ranges::Num(Range), Value);
+	}
+
 	auto Iter = Ranges::Begin(Range);
 	auto Sent = Ranges::End  (Range);
 
@@ -1316,11 +1584,11 @@ NODISCARD constexpr size_t Count(R&& Range, const T& Value, Pred Predicate = { }
  */
 template <CInputIterator I, CSentinelFor<I> S,
 	CRegularInvocable<TIteratorReference<I>> Proj =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
 	CEquivalenceRelation<TInvokeResult<Proj, TIteratorReference<I>>, T> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 NODISCARD FORCEINLINE constexpr size_t Count(I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
 {
 	if constexpr (CSizedSentinelFor<S, I>)
@@ -1404,12 +1672,12 @@ NODISCARD FORCEINLINE constexpr size_t CountIf(I First, S Last, Pred Predicate,
  */
 template <CInputRange R1, CInputRange R2,
 	CRegularInvocable<TRangeReference<R1>> Proj1 =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CRegularInvocable<TRangeReference<R2>> Proj2 =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CEquivalenceRelation<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 	requires (CBorrowedRange<R1> && CBorrowedRange<R2>)
 NODISCARD constexpr TTuple<TRangeIterator<R1>, TRangeIterator<R2>> Mismatch(R1&& LHS, R2&& RHS,
 	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
@@ -1424,6 +1692,20 @@ NODISCARD constexpr TTuple<TRangeIterator<R1>, TRangeIterator<R2>> Mismatch(R1&&
 		checkf(Algorithms::Distance(RHS) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(RHS)."));
 	}
 
+	if constexpr (CSizedRange<R1&> && CSizedRange<R2&> && CSameAs<TRangeElement<R1>, TRangeElement<R2>>
+		&& NAMESPACE_PRIVATE::CSearchVectorizable<TRangeIterator<R1>, Proj1, Pred>
+		&& NAMESPACE_PRIVATE::CSearchVectorizable<TRangeIterator<R2>, Proj2, Pred>)
+	{
+		if (!IsConstantEvaluated())
+		{
+			const size_t Num = Ranges::Num(LHS) < Ranges::Num(RHS) ? Ranges::Num(LHS) : Ranges::Num(RHS);
+
+			const size_t Index = NAMESPACE_PRIVATE::VectorizedMismatch(ToAddress(Ranges::Begin(LHS)), ToAddress(Ranges::Begin(RHS)), Num);
+
+			return { Ranges::Begin(LHS) + Index, Ranges::Begin(RHS) + Index };
+		}
+	}
+
 	auto IterA = Ranges::Begin(LHS);
 	auto SentA = Ranges::End  (LHS);
 
@@ -1459,12 +1741,12 @@ NODISCARD constexpr TTuple<TRangeIterator<R1>, TRangeIterator<R2>> Mismatch(R1&&
  */
 template <CInputIterator I1, CSentinelFor<I1> S1, CInputIterator I2, CSentinelFor<I2> S2,
 	CRegularInvocable<TIteratorReference<I1>> Proj1 =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CRegularInvocable<TIteratorReference<I2>> Proj2 =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CEquivalenceRelation<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 NODISCARD FORCEINLINE constexpr TTuple<I1, I2> Mismatch(I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast,
 	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
 {
@@ -1497,12 +1779,12 @@ NODISCARD FORCEINLINE constexpr TTuple<I1, I2> Mismatch(I1 LHSFirst, S1 LHSLast,
  */
 template <CInputRange R1, CInputRange R2,
 	CRegularInvocable<TRangeReference<R1>> Proj1 =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CRegularInvocable<TRangeReference<R2>> Proj2 =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CEquivalenceRelation<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 NODISCARD FORCEINLINE constexpr bool Equal(R1&& LHS, R2&& RHS, Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
 {
 	if constexpr (CSizedRange<R1&>)
@@ -1523,6 +1805,13 @@ NODISCARD FORCEINLINE constexpr bool Equal(R1&& LHS, R2&& RHS, Pred Predicate =
 		}
 	}
 
+	if constexpr (CSizedRange<R1&> && CSizedRange<R2&> && CSameAs<TRangeElement<R1>, TRangeElement<R2>>
+		&& NAMESPACE_PRIVATE::CSearchVectorizable<TRangeIterator<R1>, Proj1, Pred>
+		&& NAMESPACE_PRIVATE::CSearchVectorizable<TRangeIterator<R2>, Proj2, Pred>)
+	{
+		if (!IsConstantEvaluated()) return Memory::Memcmp(ToAddress(Ranges::Begin(LHS)), ToAddress(Ranges::Begin(RHS)), Ranges::Num(LHS) * sizeof(TRangeElement<R1>)) == 0;
+	}
+
 	auto FirstA = Ranges::Begin(LHS);
 	auto SentA  = Ranges::End  (LHS);
 
@@ -1551,12 +1840,12 @@ NODISCARD FORCEINLINE constexpr bool Equal(R1&& LHS, R2&& RHS, Pred Predicate =
  */
 template <CInputIterator I1, CSentinelFor<I1> S1, CInputIterator I2, CSentinelFor<I2> S2,
 	CRegularInvocable<TIteratorReference<I1>> Proj1 =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CRegularInvocable<TIteratorReference<I2>> Proj2 =
-		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+		NAMESPACE_PRIVATE::FSearchIdentity,
 	CEquivalenceRelation<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
 		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
-			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A == B; }), void>>
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
 NODISCARD FORCEINLINE constexpr bool Equal(I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast,
 	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
 {
@@ -1748,6 +2037,642 @@ NODISCARD FORCEINLINE constexpr bool EndsWith(I1 First, S1 Last, I2 SuffixFirst,
 		Ref(Predicate), Ref(Projection), Ref(SuffixProjection));
 }
 
+/**
+ * Checks if all elements in the range satisfy the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and stop once any element does not satisfy the predicate.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to check.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return true if all elements satisfy the predicate, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TRangeReference<R>>> Pred>
+	requires (CSizedRange<R&>)
+NODISCARD bool AllOf(E&&, R&& Range, Pred Predicate, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::AllOf(Forward<R>(Range), Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		auto First = Ranges::Begin(Range);
+
+		const size_t Num = Ranges::Num(Range);
+
+		return NAMESPACE_PRIVATE::ParallelFindIndex(Num, [&](size_t Index) { return !Invoke(Predicate, Invoke(Projection, *(First + Index))); }) == Num;
+	}
+}
+
+/**
+ * Checks if all elements in the range satisfy the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and stop once any element does not satisfy the predicate.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return true if all elements satisfy the predicate, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TIteratorReference<I>>> Pred>
+NODISCARD FORCEINLINE bool AllOf(E&& Policy, I First, S Last, Pred Predicate, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::AllOf(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Checks if any elements in the range satisfy the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and stop once any element satisfies the predicate.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to check.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return true if any elements satisfy the predicate, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TRangeReference<R>>> Pred>
+	requires (CSizedRange<R&>)
+NODISCARD bool AnyOf(E&&, R&& Range, Pred Predicate, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::AnyOf(Forward<R>(Range), Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		auto First = Ranges::Begin(Range);
+
+		const size_t Num = Ranges::Num(Range);
+
+		return NAMESPACE_PRIVATE::ParallelFindIndex(Num, [&](size_t Index) { return Invoke(Predicate, Invoke(Projection, *(First + Index))); }) != Num;
+	}
+}
+
+/**
+ * Checks if any elements in the range satisfy the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and stop once any element satisfies the predicate.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return true if any elements satisfy the predicate, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TIteratorReference<I>>> Pred>
+NODISCARD FORCEINLINE bool AnyOf(E&& Policy, I First, S Last, Pred Predicate, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::AnyOf(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Checks if no elements in the range satisfy the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and stop once any element satisfies the predicate.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to check.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return true if no elements satisfy the predicate, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TRangeReference<R>>> Pred>
+	requires (CSizedRange<R&>)
+NODISCARD FORCEINLINE bool NoneOf(E&& Policy, R&& Range, Pred Predicate, Proj Projection = { })
+{
+	return !Algorithms::AnyOf(Forward<E>(Policy), Forward<R>(Range), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Checks if no elements in the range satisfy the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and stop once any element satisfies the predicate.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return true if no elements satisfy the predicate, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TIteratorReference<I>>> Pred>
+NODISCARD FORCEINLINE bool NoneOf(E&& Policy, I First, S Last, Pred Predicate, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return !Algorithms::AnyOf(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Checks if the range contains the given element, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and stop once the element is found.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to check.
+ * @param Value      - The value to check.
+ * @param Predicate  - The equivalence relation predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return true if the range contains the value, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CEquivalenceRelation<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+	requires (CSizedRange<R&>)
+NODISCARD FORCEINLINE bool Contains(E&& Policy, R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::Contains(Forward<R>(Range), Value, Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		auto ValuePredicate = [&Predicate, &Value]<typename U>(U&& A) { return Invoke(Predicate, Forward<U>(A), Value); };
+
+		return Algorithms::AnyOf(Forward<E>(Policy), Forward<R>(Range), ValuePredicate, Ref(Projection));
+	}
+}
+
+/**
+ * Checks if the range contains the given element, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and stop once the element is found.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Value      - The value to check.
+ * @param Predicate  - The equivalence relation predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return true if the range contains the value, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
+	CEquivalenceRelation<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+NODISCARD FORCEINLINE bool Contains(E&& Policy, I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::Contains(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Value, Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Finds the first element in the range that satisfies the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and the chunks after the found element stop early.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to check.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator to the first element that satisfies the predicate, or the end iterator if not found.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TRangeReference<R>>> Pred>
+	requires (CSizedRange<R&> && CBorrowedRange<R>)
+NODISCARD TRangeIterator<R> FindIf(E&&, R&& Range, Pred Predicate, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::FindIf(Forward<R>(Range), Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		auto First = Ranges::Begin(Range);
+
+		const size_t Num = Ranges::Num(Range);
+
+		return First + NAMESPACE_PRIVATE::ParallelFindIndex(Num, [&](size_t Index) { return Invoke(Predicate, Invoke(Projection, *(First + Index))); });
+	}
+}
+
+/**
+ * Finds the first element in the range that satisfies the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and the chunks after the found element stop early.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator to the first element that satisfies the predicate, or the end iterator if not found.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TIteratorReference<I>>> Pred>
+NODISCARD FORCEINLINE I FindIf(E&& Policy, I First, S Last, Pred Predicate, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::FindIf(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Finds the first element in the range that equals the given value, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and the chunks after the found element stop early.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to check.
+ * @param Value      - The value to check.
+ * @param Predicate  - The equivalence relation predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator to the first element that equals the value, or the end iterator if not found.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CEquivalenceRelation<TInvokeResult<Proj, TRangeReference<R>>, const T&> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+	requires (CSizedRange<R&> && CBorrowedRange<R>)
+NODISCARD FORCEINLINE TRangeIterator<R> Find(E&& Policy, R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::Find(Forward<R>(Range), Value, Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		auto ValuePredicate = [&Predicate, &Value]<typename U>(U&& A) { return Invoke(Predicate, Forward<U>(A), Value); };
+
+		return Algorithms::FindIf(Forward<E>(Policy), Forward<R>(Range), ValuePredicate, Ref(Projection));
+	}
+}
+
+/**
+ * Finds the first element in the range that equals the given value, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and the chunks after the found element stop early.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Value      - The value to check.
+ * @param Predicate  - The equivalence relation predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator to the first element that equals the value, or the end iterator if not found.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
+	CEquivalenceRelation<TInvokeResult<Proj, TIteratorReference<I>>, const T&> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+NODISCARD FORCEINLINE I Find(E&& Policy, I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::Find(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Value, Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Finds the first element in the range that does not satisfy the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and the chunks after the found element stop early.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to check.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator to the first element that does not satisfy the predicate, or the end iterator if not found.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TRangeReference<R>>> Pred>
+	requires (CSizedRange<R&> && CBorrowedRange<R>)
+NODISCARD FORCEINLINE TRangeIterator<R> FindIfNot(E&& Policy, R&& Range, Pred Predicate, Proj Projection = { })
+{
+	auto NotPredicate = [&Predicate]<typename T>(T&& A) { return !Invoke(Predicate, Forward<T>(A)); };
+
+	return Algorithms::FindIf(Forward<E>(Policy), Forward<R>(Range), NotPredicate, Ref(Projection));
+}
+
+/**
+ * Finds the first element in the range that does not satisfy the predicate, with the execution policy.
+ * The parallel policies check the chunks of the range on the worker pool, and the chunks after the found element stop early.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The iterator to the first element that does not satisfy the predicate, or the end iterator if not found.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TIteratorReference<I>>> Pred>
+NODISCARD FORCEINLINE I FindIfNot(E&& Policy, I First, S Last, Pred Predicate, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::FindIfNot(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Counts the number of elements in the range that satisfies the predicate, with the execution policy.
+ * The parallel policies count the chunks of the range on the worker pool and sum the results.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range of elements to examine.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The number of elements that satisfies the predicate.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TRangeReference<R>>> Pred>
+	requires (CSizedRange<R&>)
+NODISCARD size_t CountIf(E&&, R&& Range, Pred Predicate, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::CountIf(Forward<R>(Range), Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		auto First = Ranges::Begin(Range);
+
+		return NAMESPACE_PRIVATE::ParallelCountIndex(Ranges::Num(Range), [&](size_t Index) { return Invoke(Predicate, Invoke(Projection, *(First + Index))); });
+	}
+}
+
+/**
+ * Counts the number of elements in the range that satisfies the predicate, with the execution policy.
+ * The parallel policies count the chunks of the range on the worker pool and sum the results.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The unary predicate to satisfy.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The number of elements that satisfies the predicate.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CPredicate<TInvokeResult<Proj, TIteratorReference<I>>> Pred>
+NODISCARD FORCEINLINE size_t CountIf(E&& Policy, I First, S Last, Pred Predicate, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::CountIf(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Counts the number of elements in the range that equals the given value, with the execution policy.
+ * The parallel policies count the chunks of the range on the worker pool and sum the results.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range of elements to examine.
+ * @param Value      - The value to search for.
+ * @param Predicate  - The equivalence relation predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The number of elements that equals the value.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TRangeReference<R>>>,
+	CEquivalenceRelation<TInvokeResult<Proj, TRangeReference<R>>, T> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TRangeReference<R>>, const T&>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+	requires (CSizedRange<R&>)
+NODISCARD FORCEINLINE size_t Count(E&& Policy, R&& Range, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) return Algorithms::Count(Forward<R>(Range), Value, Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		auto ValuePredicate = [&Predicate, &Value]<typename U>(U&& A) { return Invoke(Predicate, Forward<U>(A), Value); };
+
+		return Algorithms::CountIf(Forward<E>(Policy), Forward<R>(Range), ValuePredicate, Ref(Projection));
+	}
+}
+
+/**
+ * Counts the number of elements in the range that equals the given value, with the execution policy.
+ * The parallel policies count the chunks of the range on the worker pool and sum the results.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Value      - The value to search for.
+ * @param Predicate  - The equivalence relation predicate between the projected elements and the value.
+ * @param Projection - The projection to apply to the elements before checking.
+ *
+ * @return The number of elements that equals the value.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CReferenceable T = TRemoveCVRef<TInvokeResult<Proj, TIteratorReference<I>>>,
+	CEquivalenceRelation<TInvokeResult<Proj, TIteratorReference<I>>, T> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj, TIteratorReference<I>>, const T&>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+NODISCARD FORCEINLINE size_t Count(E&& Policy, I First, S Last, const T& Value, Pred Predicate = { }, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	return Algorithms::Count(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Value, Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Finds the first mismatch between two ranges, with the execution policy.
+ * The parallel policies compare the chunks of the ranges on the worker pool, and the chunks after the mismatch stop early.
+ *
+ * @param Policy        - The execution policy to use.
+ * @param LHS           - The left hand side range of the elements to compare.
+ * @param RHS           - The right hand side range of the elements to compare.
+ * @param Predicate     - The equivalence relation predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before checking.
+ * @param RHSProjection - The projection to apply to the right hand side elements before checking.
+ *
+ * @return The pair of iterators to the first mismatched elements, or the pair of end iterators if not found.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R1, CRandomAccessRange R2,
+	CRegularInvocable<TRangeReference<R1>> Proj1 =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CRegularInvocable<TRangeReference<R2>> Proj2 =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CEquivalenceRelation<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+	requires (CSizedRange<R1&> && CSizedRange<R2&> && CBorrowedRange<R1> && CBorrowedRange<R2>)
+NODISCARD TTuple<TRangeIterator<R1>, TRangeIterator<R2>> Mismatch(E&&, R1&& LHS, R2&& RHS,
+	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>)
+	{
+		return Algorithms::Mismatch(Forward<R1>(LHS), Forward<R2>(RHS), Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+	}
+	else
+	{
+		auto FirstA = Ranges::Begin(LHS);
+		auto FirstB = Ranges::Begin(RHS);
+
+		const size_t Num = Ranges::Num(LHS) < Ranges::Num(RHS) ? Ranges::Num(LHS) : Ranges::Num(RHS);
+
+		const size_t Index = NAMESPACE_PRIVATE::ParallelFindIndex(Num, [&](size_t Index)
+		{
+			return !Invoke(Predicate, Invoke(LHSProjection, *(FirstA + Index)), Invoke(RHSProjection, *(FirstB + Index)));
+		});
+
+		return { FirstA + Index, FirstB + Index };
+	}
+}
+
+/**
+ * Finds the first mismatch between two ranges, with the execution policy.
+ * The parallel policies compare the chunks of the ranges on the worker pool, and the chunks after the mismatch stop early.
+ *
+ * @param Policy        - The execution policy to use.
+ * @param LHSFirst      - The iterator of the left hand side range.
+ * @param LHSLast       - The sentinel of the left hand side range.
+ * @param RHSFirst      - The iterator of the right hand side range.
+ * @param RHSLast       - The sentinel of the right hand side range.
+ * @param Predicate     - The equivalence relation predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before checking.
+ * @param RHSProjection - The projection to apply to the right hand side elements before checking.
+ *
+ * @return The pair of iterators to the first mismatched elements, or the pair of end iterators if not found.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I1, CSizedSentinelFor<I1> S1, CRandomAccessIterator I2, CSizedSentinelFor<I2> S2,
+	CRegularInvocable<TIteratorReference<I1>> Proj1 =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CRegularInvocable<TIteratorReference<I2>> Proj2 =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CEquivalenceRelation<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+NODISCARD FORCEINLINE TTuple<I1, I2> Mismatch(E&& Policy, I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast,
+	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	checkf(LHSFirst - LHSLast <= 0, TEXT("Illegal range iterator. Please check LHSFirst <= LHSLast."));
+	checkf(RHSFirst - RHSLast <= 0, TEXT("Illegal range iterator. Please check RHSFirst <= RHSLast."));
+
+	return Algorithms::Mismatch(Forward<E>(Policy),
+		Ranges::View(MoveTemp(LHSFirst), LHSLast),
+		Ranges::View(MoveTemp(RHSFirst), RHSLast),
+		Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+}
+
+/**
+ * Checks if two ranges are equal, with the execution policy.
+ * The parallel policies compare the chunks of the ranges on the worker pool, and stop once any elements are not equal.
+ *
+ * @param Policy        - The execution policy to use.
+ * @param LHS           - The left hand side range of the elements to compare.
+ * @param RHS           - The right hand side range of the elements to compare.
+ * @param Predicate     - The equivalence relation predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before checking.
+ * @param RHSProjection - The projection to apply to the right hand side elements before checking.
+ *
+ * @return true if the ranges are equal, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R1, CRandomAccessRange R2,
+	CRegularInvocable<TRangeReference<R1>> Proj1 =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CRegularInvocable<TRangeReference<R2>> Proj2 =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CEquivalenceRelation<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj1, TRangeReference<R1>>, TInvokeResult<Proj2, TRangeReference<R2>>>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+	requires (CSizedRange<R1&> && CSizedRange<R2&>)
+NODISCARD bool Equal(E&&, R1&& LHS, R2&& RHS, Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>)
+	{
+		return Algorithms::Equal(Forward<R1>(LHS), Forward<R2>(RHS), Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+	}
+	else
+	{
+		if (Ranges::Num(LHS) != Ranges::Num(RHS)) return false;
+
+		auto FirstA = Ranges::Begin(LHS);
+		auto FirstB = Ranges::Begin(RHS);
+
+		const size_t Num = Ranges::Num(LHS);
+
+		return NAMESPACE_PRIVATE::ParallelFindIndex(Num, [&](size_t Index)
+		{
+			return !Invoke(Predicate, Invoke(LHSProjection, *(FirstA + Index)), Invoke(RHSProjection, *(FirstB + Index)));
+		}) == Num;
+	}
+}
+
+/**
+ * Checks if two ranges are equal, with the execution policy.
+ * The parallel policies compare the chunks of the ranges on the worker pool, and stop once any elements are not equal.
+ *
+ * @param Policy        - The execution policy to use.
+ * @param LHSFirst      - The iterator of the left hand side range.
+ * @param LHSLast       - The sentinel of the left hand side range.
+ * @param RHSFirst      - The iterator of the right hand side range.
+ * @param RHSLast       - The sentinel of the right hand side range.
+ * @param Predicate     - The equivalence relation predicate between the projected elements.
+ * @param LHSProjection - The projection to apply to the left hand side elements before checking.
+ * @param RHSProjection - The projection to apply to the right hand side elements before checking.
+ *
+ * @return true if the ranges are equal, false otherwise.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I1, CSizedSentinelFor<I1> S1, CRandomAccessIterator I2, CSizedSentinelFor<I2> S2,
+	CRegularInvocable<TIteratorReference<I1>> Proj1 =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CRegularInvocable<TIteratorReference<I2>> Proj2 =
+		NAMESPACE_PRIVATE::FSearchIdentity,
+	CEquivalenceRelation<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>> Pred =
+		TConditional<CWeaklyEqualityComparable<TInvokeResult<Proj1, TIteratorReference<I1>>, TInvokeResult<Proj2, TIteratorReference<I2>>>,
+			NAMESPACE_PRIVATE::FSearchEqualTo, void>>
+NODISCARD FORCEINLINE bool Equal(E&& Policy, I1 LHSFirst, S1 LHSLast, I2 RHSFirst, S2 RHSLast,
+	Pred Predicate = { }, Proj1 LHSProjection = { }, Proj2 RHSProjection = { })
+{
+	checkf(LHSFirst - LHSLast <= 0, TEXT("Illegal range iterator. Please check LHSFirst <= LHSLast."));
+	checkf(RHSFirst - RHSLast <= 0, TEXT("Illegal range iterator. Please check RHSFirst <= RHSLast."));
+
+	return Algorithms::Equal(Forward<E>(Policy),
+		Ranges::View(MoveTemp(LHSFirst), LHSLast),
+		Ranges::View(MoveTemp(RHSFirst), RHSLast),
+		Ref(Predicate), Ref(LHSProjection), Ref(RHSProjection));
+}
+
 NAMESPACE_END(Algorithms)
 
 NAMESPACE_MODULE_END(Utility)
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Iterators/Utility.h"
+#include "Iterators/Sentinel.h"
+#include "Iterators/BasicIterator.h"
+#include "Ranges/Utility.h"
+#include "Ranges/View.h"
+#include "Algorithms/Basic.h"
+#include "Algorithms/Mutation.h"
+#include "Numerics/Math.h"
+#include "Numerics/Random.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+/** @return The generated random number within the range of (0, 1), which is never zero so its logarithm is finite. */
+template <typename G>
+NODISCARD FORCEINLINE double RandOpenUnit(G& Engine)
+{
+	double Result;
+
+	do Result = Math::Rand(Engine, 1.0);
+	while (Result == 0.0);
+
+	return Result;
+}
+
+NAMESPACE_PRIVATE_END
+
+NAMESPACE_BEGIN(Algorithms)
+
+/**
+ * Reorders the elements of the range so that each permutation has the same probability, by the Fisher-Yates algorithm.
+ * The random indices are generated by the engine without division, so the shuffling is dominated by the element swaps.
+ *
+ * @param Range  - The range of elements to shuffle.
+ * @param Engine - The random number engine to use, such as the engine returned by Math::ThreadEngine().
+ *
+ * @return The iterator that points to the end of the range.
+ */
+template <CRandomAccessRange R, typename G>
+	requires (CBorrowedRange<R> && CUniformRandomBitGenerator<TRemoveReference<G>> && NAMESPACE_PRIVATE::CPermutable<TRangeIterator<R>>)
+constexpr TRangeIterator<R> Shuffle(R&& Range, G&& Engine)
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto First = Ranges::Begin(Range);
+
+	const size_t Num = Algorithms::Distance(Range);
+
+	for (size_t Index = Num; Index > 1; --Index)
+	{
+		const size_t Target = Math::Rand(Engine, Index);
+
+		if (Target != Index - 1) NAMESPACE_PRIVATE::IterSwap(First + (Index - 1), First + Target);
+	}
+
+	return First + Num;
+}
+
+/**
+ * Reorders the elements of the range so that each permutation has the same probability, by the Fisher-Yates algorithm.
+ * The random indices are generated by the engine without division, so the shuffling is dominated by the element swaps.
+ *
+ * @param First  - The iterator of the range.
+ * @param Last   - The sentinel of the range.
+ * @param Engine - The random number engine to use, such as the engine returned by Math::ThreadEngine().
+ *
+ * @return The iterator that points to the end of the range.
+ */
+template <CRandomAccessIterator I, CSentinelFor<I> S, typename G>
+	requires (CUniformRandomBitGenerator<TRemoveReference<G>> && NAMESPACE_PRIVATE::CPermutable<I>)
+FORCEINLINE constexpr I Shuffle(I First, S Last, G&& Engine)
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::Shuffle(Ranges::View(MoveTemp(First), Last), Engine);
+}
+
+/**
+ * Selects the random elements from the input range and writes them to the output range, so that each subset
+ * of the size 'Count' has the same probability. If the input range is a sized forward range, the elements are selected
+ * by the selection sampling in a single pass which keeps their relative order. Otherwise, the elements are selected
+ * by the reservoir sampling with geometric skips, which generates the random numbers only for the selected elements,
+ * and the order of the selected elements is unspecified. If the output range is insufficient, return directly.
+ *
+ * @param Input  - The range of elements to select from.
+ * @param Output - The output range to write the result, which must be a random access range for the reservoir sampling.
+ * @param Count  - The number of elements to select. If it is greater than the size of the input, all elements are selected.
+ * @param Engine - The random number engine to use, such as the engine returned by Math::ThreadEngine().
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputRange R1, CRange R2, typename G>
+	requires (COutputRange<R2, TRangeReference<R1>> && CBorrowedRange<R2> && CUniformRandomBitGenerator<TRemoveReference<G>>
+		&& ((CForwardRange<R1> && CSizedRange<R1&>) || CRandomAccessRange<R2>))
+constexpr TRangeIterator<R2> Sample(R1&& Input, R2&& Output, size_t Count, G&& Engine)
+{
+	auto Iter = Ranges::Begin(Input);
+	auto Sent = Ranges::End  (Input);
+
+	auto OutIter = Ranges::Begin(Output);
+	auto OutSent = Ranges::End  (Output);
+
+	if constexpr (CForwardRange<R1> && CSizedRange<R1&>)
+	{
+		checkf(Algorithms::Distance(Input) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Input)."));
+
+		size_t Remaining = Ranges::Num(Input);
+
+		for (; Count != 0 && Iter != Sent; ++Iter, --Remaining)
+		{
+			if (Math::Rand(Engine, Remaining) >= Count) continue;
+
+			if (OutIter == OutSent) UNLIKELY return OutIter;
+
+			*OutIter++ = *Iter;
+
+			--Count;
+		}
+
+		return OutIter;
+	}
+
+	else
+	{
+		if constexpr (CSizedRange<R2&>)
+		{
+			if (Count > Ranges::Num(Output)) Count = Ranges::Num(Output);
+		}
+
+		size_t Num = 0;
+
+		for (; Num != Count; ++Num, ++Iter)
+		{
+			if (Iter == Sent) return OutIter + Num;
+
+			OutIter[Num] = *Iter;
+		}
+
+		if (Count == 0) return OutIter;
+
+		// The largest of the random keys in the reservoir, whose logarithm is updated for each replacement.
+		double LogWeight = Math::Log(NAMESPACE_PRIVATE::RandOpenUnit(Engine)) / static_cast<double>(Count);
+
+		while (true)
+		{
+			const double Skip = Math::Floor(Math::Log(NAMESPACE_PRIVATE::RandOpenUnit(Engine)) / Math::Log1Plus(-Math::Exp(LogWeight)));
+
+			if (!(Skip < static_cast<double>(TNumericLimits<ptrdiff>::Max()))) break;
+
+			Iter = Algorithms::Next(MoveTemp(Iter), static_cast<ptrdiff>(Skip), Sent);
+
+			if (Iter == Sent) break;
+
+			OutIter[Math::Rand(Engine, Count)] = *Iter;
+
+			++Iter;
+
+			LogWeight += Math::Log(NAMESPACE_PRIVATE::RandOpenUnit(Engine)) / static_cast<double>(Count);
+		}
+
+		return OutIter + Count;
+	}
+}
+
+/**
+ * Selects the random elements from the input range and writes them to the output range, so that each subset
+ * of the size 'Count' has the same probability. If the input range is a sized forward range, the elements are selected
+ * by the selection sampling in a single pass which keeps their relative order. Otherwise, the elements are selected
+ * by the reservoir sampling with geometric skips, which generates the random numbers only for the selected elements,
+ * and the order of the selected elements is unspecified. If the output range is insufficient, return directly.
+ *
+ * @param First  - The iterator of the input range.
+ * @param Last   - The sentinel of the input range.
+ * @param Output - The output range to write the result, which must be a random access range for the reservoir sampling.
+ * @param Count  - The number of elements to select. If it is greater than the size of the input, all elements are selected.
+ * @param Engine - The random number engine to use, such as the engine returned by Math::ThreadEngine().
+ *
+ * @return The iterator that points to the next position of the output.
+ */
+template <CInputIterator I, CSentinelFor<I> S, CRange R, typename G>
+	requires (COutputRange<R, TIteratorReference<I>> && CBorrowedRange<R> && CUniformRandomBitGenerator<TRemoveReference<G>>
+		&& ((CForwardIterator<I> && CSizedSentinelFor<S, I>) || CRandomAccessRange<R>))
+FORCEINLINE constexpr TRangeIterator<R> Sample(I First, S Last, R&& Output, size_t Count, G&& Engine)
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::Sample(Ranges::View(MoveTemp(First), Last), Forward<R>(Output), Count, Engine);
+}
+
+NAMESPACE_END(Algorithms)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
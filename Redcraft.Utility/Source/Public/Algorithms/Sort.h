@@ -0,0 +1,1033 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Invoke.h"
+#include "Templates/ReferenceWrapper.h"
+#include "Templates/Tuple.h"
+#include "Iterators/Utility.h"
+#include "Iterators/Sentinel.h"
+#include "Iterators/BasicIterator.h"
+#include "Ranges/Utility.h"
+#include "Ranges/View.h"
+#include "Algorithms/Basic.h"
+#include "Algorithms/ExecutionPolicy.h"
+#include "Memory/Memory.h"
+#include "Memory/MemoryOperator.h"
+#include "Numerics/Bit.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+/**
+ * A concept specifies the elements of the iterator can be reordered in place and compared after projection.
+ * The projection must also accept the element lvalue, since the sorting algorithms move some elements out to temporaries.
+ */
+template <typename I, typename Proj>
+concept CSortable = CRandomAccessIterator<I> && CMovable<TIteratorElement<I>>
+	&& CConstructibleFrom<TIteratorElement<I>, TIteratorRValueReference<I>>
+	&& CIndirectlyWritable<I, TIteratorElement<I>>
+	&& CRegularInvocable<Proj, TIteratorElement<I>&>;
+
+constexpr ptrdiff SortInsertionThreshold = 24;
+constexpr ptrdiff SortNintherThreshold   = 128;
+constexpr ptrdiff SortPartialInsertLimit = 8;
+constexpr ptrdiff StableSortChunkSize    = 32;
+
+template <typename I, typename F>
+constexpr void InsertionSort(I First, I Last, F Less)
+{
+	if (First == Last) return;
+
+	for (I Iter = First + 1; Iter != Last; ++Iter)
+	{
+		if (!Less(*Iter, *(Iter - 1))) continue;
+
+		TIteratorElement<I> Temp = MoveTemp(*Iter);
+
+		I Hole = Iter;
+
+		do
+		{
+			*Hole = MoveTemp(*(Hole - 1));
+
+			--Hole;
+		}
+		while (Hole != First && Less(Temp, *(Hole - 1)));
+
+		*Hole = MoveTemp(Temp);
+	}
+}
+
+/** Sorts the range by insertion, assuming that there is an element not greater than any element of the range before 'First'. */
+template <typename I, typename F>
+constexpr void UnguardedInsertionSort(I First, I Last, F Less)
+{
+	if (First == Last) return;
+
+	for (I Iter = First + 1; Iter != Last; ++Iter)
+	{
+		if (!Less(*Iter, *(Iter - 1))) continue;
+
+		TIteratorElement<I> Temp = MoveTemp(*Iter);
+
+		I Hole = Iter;
+
+		do
+		{
+			*Hole = MoveTemp(*(Hole - 1));
+
+			--Hole;
+		}
+		while (Less(Temp, *(Hole - 1)));
+
+		*Hole = MoveTemp(Temp);
+	}
+}
+
+/** Tries to sort the range by insertion, and gives up if more than a few elements have to be moved. @return true if the range is sorted. */
+template <typename I, typename F>
+constexpr bool PartialInsertionSort(I First, I Last, F Less)
+{
+	if (First == Last) return true;
+
+	ptrdiff Moves = 0;
+
+	for (I Iter = First + 1; Iter != Last; ++Iter)
+	{
+		if (!Less(*Iter, *(Iter - 1))) continue;
+
+		TIteratorElement<I> Temp = MoveTemp(*Iter);
+
+		I Hole = Iter;
+
+		do
+		{
+			*Hole = MoveTemp(*(Hole - 1));
+
+			--Hole;
+		}
+		while (Hole != First && Less(Temp, *(Hole - 1)));
+
+		*Hole = MoveTemp(Temp);
+
+		Moves += Iter - Hole;
+
+		if (Moves > SortPartialInsertLimit) return false;
+	}
+
+	return true;
+}
+
+/** Sorts the three elements so that *A <= *B <= *C. */
+template <typename I, typename F>
+FORCEINLINE constexpr void Sort3(I A, I B, I C, F Less)
+{
+	if (Less(*B, *A)) IterSwap(A, B);
+	if (Less(*C, *B)) IterSwap(B, C);
+	if (Less(*B, *A)) IterSwap(A, B);
+}
+
+template <typename I, typename F>
+constexpr void SiftDown(I First, ptrdiff Index, ptrdiff Num, F Less)
+{
+	TIteratorElement<I> Temp = MoveTemp(*(First + Index));
+
+	while (true)
+	{
+		ptrdiff Child = Index * 2 + 1;
+
+		if (Child >= Num) break;
+
+		if (Child + 1 < Num && Less(*(First + Child), *(First + (Child + 1)))) ++Child;
+
+		if (!Less(Temp, *(First + Child))) break;
+
+		*(First + Index) = MoveTemp(*(First + Child));
+
+		Index = Child;
+	}
+
+	*(First + Index) = MoveTemp(Temp);
+}
+
+template <typename I, typename F>
+constexpr void MakeHeap(I First, ptrdiff Num, F Less)
+{
+	for (ptrdiff Index = Num / 2 - 1; Index >= 0; --Index) SiftDown(First, Index, Num, Less);
+}
+
+template <typename I, typename F>
+constexpr void SortHeap(I First, ptrdiff Num, F Less)
+{
+	for (ptrdiff Index = Num - 1; Index > 0; --Index)
+	{
+		IterSwap(First, First + Index);
+
+		SiftDown(First, 0, Index, Less);
+	}
+}
+
+template <typename I, typename F>
+constexpr void PartialSort(I First, I Middle, I Last, F Less)
+{
+	if (First == Middle) return;
+
+	const ptrdiff Num = Middle - First;
+
+	MakeHeap(First, Num, Less);
+
+	for (I Iter = Middle; Iter != Last; ++Iter)
+	{
+		if (Less(*Iter, *First))
+		{
+			IterSwap(Iter, First);
+
+			SiftDown(First, 0, Num, Less);
+		}
+	}
+
+	SortHeap(First, Num, Less);
+}
+
+/**
+ * Partitions the range around the pivot *First, the elements equal to the pivot go to the right.
+ * There must be an element not less than the pivot at the end of the range.
+ *
+ * @return The position of the pivot and whether the range was already partitioned.
+ */
+template <typename I, typename F>
+constexpr TTuple<I, bool> PartitionRight(I First, I Last, F Less)
+{
+	TIteratorElement<I> Pivot = MoveTemp(*First);
+
+	I Left  = First;
+	I Right = Last;
+
+	while (Less(*++Left, Pivot));
+
+	if (Left - 1 == First) while (Left < Right && !Less(*--Right, Pivot));
+	else while (!Less(*--Right, Pivot));
+
+	const bool bAlreadyPartitioned = Left >= Right;
+
+	while (Left < Right)
+	{
+		IterSwap(Left, Right);
+
+		while (Less(*++Left, Pivot));
+		while (!Less(*--Right, Pivot));
+	}
+
+	I PivotPosition = Left - 1;
+
+	*First = MoveTemp(*PivotPosition);
+
+	*PivotPosition = MoveTemp(Pivot);
+
+	return TTuple<I, bool>(PivotPosition, bAlreadyPartitioned);
+}
+
+/**
+ * Partitions the range around the pivot *First, the elements equal to the pivot go to the left.
+ * This is used when the pivot equals the element before the range, so that all elements equal to it are finished at once.
+ *
+ * @return The position of the pivot.
+ */
+template <typename I, typename F>
+constexpr I PartitionLeft(I First, I Last, F Less)
+{
+	TIteratorElement<I> Pivot = MoveTemp(*First);
+
+	I Left  = First;
+	I Right = Last;
+
+	while (Less(Pivot, *--Right));
+
+	if (Right + 1 == Last) while (Left < Right && !Less(Pivot, *++Left));
+	else while (!Less(Pivot, *++Left));
+
+	while (Left < Right)
+	{
+		IterSwap(Left, Right);
+
+		while (Less(Pivot, *--Right));
+		while (!Less(Pivot, *++Left));
+	}
+
+	*First = MoveTemp(*Right);
+
+	*Right = MoveTemp(Pivot);
+
+	return Right;
+}
+
+template <typename I, typename F>
+constexpr void PatternDefeatingQuickSort(I First, I Last, F Less, uint BadAllowed, bool bLeftmost)
+{
+	while (true)
+	{
+		const ptrdiff Num = Last - First;
+
+		if (Num < SortInsertionThreshold)
+		{
+			if (bLeftmost) InsertionSort(First, Last, Less);
+
+			else UnguardedInsertionSort(First, Last, Less);
+
+			return;
+		}
+
+		const ptrdiff Half = Num / 2;
+
+		// Choose the median of three or the pseudo median of nine as the pivot and move it to the first position.
+		if (Num > SortNintherThreshold)
+		{
+			Sort3(First,              First + Half,       Last - 1,           Less);
+			Sort3(First + 1,          First + (Half - 1), Last - 2,           Less);
+			Sort3(First + 2,          First + (Half + 1), Last - 3,           Less);
+			Sort3(First + (Half - 1), First + Half,       First + (Half + 1), Less);
+
+			IterSwap(First, First + Half);
+		}
+		else Sort3(First + Half, First, Last - 1, Less);
+
+		// If the pivot equals the element before the range, which is the pivot of the parent partition,
+		// all elements equal to the pivot are put to the left and need no more sorting.
+		if (!bLeftmost && !Less(*(First - 1), *First))
+		{
+			First = PartitionLeft(First, Last, Less) + 1;
+
+			continue;
+		}
+
+		auto [PivotPosition, bAlreadyPartitioned] = PartitionRight(First, Last, Less);
+
+		const ptrdiff NumLeft  = PivotPosition - First;
+		const ptrdiff NumRight = Last - (PivotPosition + 1);
+
+		if (NumLeft < Num / 8 || NumRight < Num / 8)
+		{
+			// Fall back to the heap sort if there are too many bad partitions, which guarantees O(N log N) in the worst case.
+			if (--BadAllowed == 0)
+			{
+				MakeHeap(First, Num, Less);
+				SortHeap(First, Num, Less);
+
+				return;
+			}
+
+			// Shuffle some elements to break the patterns that cause the bad partitions.
+			if (NumLeft >= SortInsertionThreshold)
+			{
+				IterSwap(First,             First + NumLeft / 4);
+				IterSwap(PivotPosition - 1, PivotPosition - NumLeft / 4);
+
+				if (NumLeft > SortNintherThreshold)
+				{
+					IterSwap(First + 1,         First + (NumLeft / 4 + 1));
+					IterSwap(First + 2,         First + (NumLeft / 4 + 2));
+					IterSwap(PivotPosition - 2, PivotPosition - (NumLeft / 4 + 1));
+					IterSwap(PivotPosition - 3, PivotPosition - (NumLeft / 4 + 2));
+				}
+			}
+
+			if (NumRight >= SortInsertionThreshold)
+			{
+				IterSwap(PivotPosition + 1, PivotPosition + (NumRight / 4 + 1));
+				IterSwap(Last - 1,          Last - NumRight / 4);
+
+				if (NumRight > SortNintherThreshold)
+				{
+					IterSwap(PivotPosition + 2, PivotPosition + (NumRight / 4 + 2));
+					IterSwap(PivotPosition + 3, PivotPosition + (NumRight / 4 + 3));
+					IterSwap(Last - 2,          Last - (NumRight / 4 + 1));
+					IterSwap(Last - 3,          Last - (NumRight / 4 + 2));
+				}
+			}
+		}
+
+		// If the range was already partitioned, it is likely to be sorted, so try the insertion sort that gives up quickly.
+		else if (bAlreadyPartitioned && PartialInsertionSort(First, PivotPosition, Less) && PartialInsertionSort(PivotPosition + 1, Last, Less)) return;
+
+		PatternDefeatingQuickSort(First, PivotPosition, Less, BadAllowed, bLeftmost);
+
+		First     = PivotPosition + 1;
+		bLeftmost = false;
+	}
+}
+
+template <typename I, typename F>
+constexpr void NthElement(I First, I Nth, I Last, F Less)
+{
+	uint DepthAllowed = Math::BitWidth(static_cast<size_t>(Last - First)) * 2;
+
+	while (Last - First > SortInsertionThreshold)
+	{
+		// Fall back to the heap selection if the partitions are too bad, which guarantees O(N log N) in the worst case.
+		if (DepthAllowed-- == 0)
+		{
+			NAMESPACE_PRIVATE::PartialSort(First, Nth + 1, Last, Less);
+
+			return;
+		}
+
+		Sort3(First + (Last - First) / 2, First, Last - 1, Less);
+
+		I PivotPosition = PartitionRight(First, Last, Less).template GetValue<0>();
+
+		if (PivotPosition == Nth) return;
+
+		if (Nth < PivotPosition) Last = PivotPosition;
+
+		else First = PivotPosition + 1;
+	}
+
+	InsertionSort(First, Last, Less);
+}
+
+/** Merges the sorted ranges [LHS, LHS + LHSNum) and [RHS, RHS + RHSNum) into the destination by moving, the left elements go first if equal. */
+template <typename I, typename J, typename F>
+void MergeMove(I LHS, ptrdiff LHSNum, I RHS, ptrdiff RHSNum, J Destination, F Less)
+{
+	ptrdiff Left  = 0;
+	ptrdiff Right = 0;
+
+	// If the ranges are already in order, they are moved as a whole without comparing.
+	if (LHSNum != 0 && RHSNum != 0 && Less(*RHS, *(LHS + (LHSNum - 1))))
+	{
+		while (Left != LHSNum && Right != RHSNum)
+		{
+			if (Less(*(RHS + Right), *(LHS + Left))) *Destination++ = MoveTemp(*(RHS + Right++));
+
+			else *Destination++ = MoveTemp(*(LHS + Left++));
+		}
+	}
+
+	for (; Left  != LHSNum; ++Left)  *Destination++ = MoveTemp(*(LHS + Left));
+	for (; Right != RHSNum; ++Right) *Destination++ = MoveTemp(*(RHS + Right));
+}
+
+/** Merges the sorted ranges [Source, Source + Middle) and [Source + Middle, Source + Num) into the destination by moving. */
+template <typename I, typename J, typename F>
+FORCEINLINE void MergeMove(I Source, ptrdiff Middle, ptrdiff Num, J Destination, F Less)
+{
+	MergeMove(Source, Middle, Source + Middle, Num - Middle, Destination, Less);
+}
+
+template <typename I, typename F>
+void StableSort(I First, I Last, F Less)
+{
+	using FElementType = TIteratorElement<I>;
+
+	const ptrdiff Num = Last - First;
+
+	if (Num <= StableSortChunkSize)
+	{
+		InsertionSort(First, Last, Less);
+
+		return;
+	}
+
+	for (ptrdiff Index = 0; Index < Num; Index += StableSortChunkSize)
+	{
+		InsertionSort(First + Index, First + (Index + StableSortChunkSize < Num ? Index + StableSortChunkSize : Num), Less);
+	}
+
+	FElementType* Buffer = static_cast<FElementType*>(Memory::Malloc(Num * sizeof(FElementType), alignof(FElementType)));
+
+	for (ptrdiff Index = 0; Index != Num; ++Index) new (Buffer + Index) FElementType(MoveTemp(*(First + Index)));
+
+	// The elements are moved back and forth between the range and the buffer, merging the runs of doubled width in each pass.
+	bool bInBuffer = true;
+
+	for (ptrdiff Width = StableSortChunkSize; Width < Num; Width *= 2)
+	{
+		for (ptrdiff Index = 0; Index < Num; Index += Width * 2)
+		{
+			const ptrdiff Middle = Index + Width     < Num ? Width     : Num - Index;
+			const ptrdiff Count  = Index + Width * 2 < Num ? Width * 2 : Num - Index;
+
+			if (bInBuffer) MergeMove(Buffer + Index, Middle, Count, First  + Index, Less);
+			else           MergeMove(First  + Index, Middle, Count, Buffer + Index, Less);
+		}
+
+		bInBuffer = !bInBuffer;
+	}
+
+	if (bInBuffer)
+	{
+		for (ptrdiff Index = 0; Index != Num; ++Index) *(First + Index) = MoveTemp(Buffer[Index]);
+	}
+
+	Memory::Destruct(Buffer, Num);
+
+	Memory::Free(Buffer);
+}
+
+/**
+ * Finds the number of the left elements in the first 'Index' elements of the stable merge of the sorted ranges,
+ * which is the merge path partition that splits a merge into the independent parts.
+ */
+template <typename I, typename F>
+ptrdiff MergeSplit(I LHS, ptrdiff LHSNum, I RHS, ptrdiff RHSNum, ptrdiff Index, F Less)
+{
+	ptrdiff Low  = Index > RHSNum ? Index - RHSNum : 0;
+	ptrdiff High = Index < LHSNum ? Index : LHSNum;
+
+	// The left element goes before the right element 'Index - Middle - 1' if they are equal, which holds for a prefix of the candidates.
+	while (Low < High)
+	{
+		const ptrdiff Middle = Low + (High - Low) / 2;
+
+		if (!Less(*(RHS + (Index - Middle - 1)), *(LHS + Middle))) Low = Middle + 1;
+
+		else High = Middle;
+	}
+
+	return Low;
+}
+
+/**
+ * Sorts the range in parallel by sorting the chunks with the given function and merging them in rounds, each merge is
+ * split into the same number of independent parts by MergeSplit(). The chunks and the parts depend only on the number
+ * of elements, and the merges are stable, so the result is the same as the sequential stable sort of the chunk sorter.
+ */
+template <typename I, typename F, typename G>
+void ParallelMergeSort(I First, I Last, F Less, G SortChunk)
+{
+	using FElementType = TIteratorElement<I>;
+
+	const size_t Num = static_cast<size_t>(Last - First);
+
+	const size_t ChunkNum = ParallelChunkNum(Num);
+
+	Execution::ParallelFor(ChunkNum, [First, Num, ChunkNum, &SortChunk](size_t Chunk)
+	{
+		SortChunk(First + ParallelChunkBegin(Num, ChunkNum, Chunk), First + ParallelChunkBegin(Num, ChunkNum, Chunk + 1));
+	});
+
+	if (ChunkNum == 1) return;
+
+	FElementType* Buffer = static_cast<FElementType*>(Memory::Malloc(Num * sizeof(FElementType), alignof(FElementType)));
+
+	Execution::ParallelFor(ChunkNum, [First, Buffer, Num, ChunkNum](size_t Chunk)
+	{
+		const size_t Begin = ParallelChunkBegin(Num, ChunkNum, Chunk);
+		const size_t End   = ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+		for (size_t Index = Begin; Index != End; ++Index) new (Buffer + Index) FElementType(MoveTemp(*(First + Index)));
+	});
+
+	bool bInBuffer = true;
+
+	for (size_t Width = 1; Width < ChunkNum; Width *= 2)
+	{
+		// Each pair of the runs covers at most 2 * Width chunks, and it is merged by the same number of parts.
+		Execution::ParallelFor(ChunkNum, [First, Buffer, Num, ChunkNum, Width, bInBuffer, &Less](size_t Chunk)
+		{
+			const size_t PairFirst = Chunk / (Width * 2) * (Width * 2);
+			const size_t PairLast  = PairFirst + Width * 2 < ChunkNum ? PairFirst + Width * 2 : ChunkNum;
+			const size_t PairMid   = PairFirst + Width     < ChunkNum ? PairFirst + Width     : ChunkNum;
+
+			const ptrdiff Begin  = ParallelChunkBegin(Num, ChunkNum, PairFirst);
+			const ptrdiff Middle = ParallelChunkBegin(Num, ChunkNum, PairMid);
+			const ptrdiff End    = ParallelChunkBegin(Num, ChunkNum, PairLast);
+
+			const ptrdiff LHSNum = Middle - Begin;
+			const ptrdiff RHSNum = End - Middle;
+
+			const ptrdiff PartNum   = PairLast - PairFirst;
+			const ptrdiff PartIndex = Chunk - PairFirst;
+
+			const ptrdiff PartBegin = (End - Begin) * PartIndex       / PartNum;
+			const ptrdiff PartEnd   = (End - Begin) * (PartIndex + 1) / PartNum;
+
+			auto MergePart = [&](auto Source, auto Destination)
+			{
+				const ptrdiff LeftBegin = MergeSplit(Source + Begin, LHSNum, Source + Middle, RHSNum, PartBegin, Less);
+				const ptrdiff LeftEnd   = MergeSplit(Source + Begin, LHSNum, Source + Middle, RHSNum, PartEnd,   Less);
+
+				MergeMove(Source + (Begin + LeftBegin), LeftEnd - LeftBegin,
+					Source + (Middle + (PartBegin - LeftBegin)), (PartEnd - LeftEnd) - (PartBegin - LeftBegin),
+					Destination + (Begin + PartBegin), Less);
+			};
+
+			if (bInBuffer) MergePart(Buffer, First);
+			else           MergePart(First, Buffer);
+		});
+
+		bInBuffer = !bInBuffer;
+	}
+
+	Execution::ParallelFor(ChunkNum, [First, Buffer, Num, ChunkNum, bInBuffer](size_t Chunk)
+	{
+		const size_t Begin = ParallelChunkBegin(Num, ChunkNum, Chunk);
+		const size_t End   = ParallelChunkBegin(Num, ChunkNum, Chunk + 1);
+
+		if (bInBuffer)
+		{
+			for (size_t Index = Begin; Index != End; ++Index) *(First + Index) = MoveTemp(Buffer[Index]);
+		}
+
+		Memory::Destruct(Buffer + Begin, End - Begin);
+	});
+
+	Memory::Free(Buffer);
+}
+
+NAMESPACE_PRIVATE_END
+
+NAMESPACE_BEGIN(Algorithms)
+
+/**
+ * Checks if the elements in the range are sorted in ascending order.
+ *
+ * @param Range      - The range to check.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return true if the elements are sorted, false otherwise.
+ */
+template <CForwardRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, TInvokeResult<Proj, TRangeReference<R>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD constexpr bool IsSorted(R&& Range, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto Iter = Ranges::Begin(Range);
+	auto Sent = Ranges::End  (Range);
+
+	if (Iter == Sent) return true;
+
+	for (auto Next = Algorithms::Next(Iter); Next != Sent; ++Iter, ++Next)
+	{
+		if (Invoke(Predicate, Invoke(Projection, *Next), Invoke(Projection, *Iter))) return false;
+	}
+
+	return true;
+}
+
+/**
+ * Checks if the elements in the range are sorted in ascending order.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ *
+ * @return true if the elements are sorted, false otherwise.
+ */
+template <CForwardIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, TInvokeResult<Proj, TIteratorReference<I>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+NODISCARD FORCEINLINE constexpr bool IsSorted(I First, S Last, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	return Algorithms::IsSorted(Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Sorts the elements in the range in ascending order. The order of equal elements is not guaranteed to be preserved.
+ * The pattern-defeating quicksort is used, which runs in O(N log N) in the worst case and in O(N) for sorted or reversed ranges.
+ *
+ * @param Range      - The range to sort.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, TInvokeResult<Proj, TRangeReference<R>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<TRangeIterator<R>, Proj>)
+constexpr void Sort(R&& Range, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto First = Ranges::Begin(Range);
+	auto Last  = Algorithms::Next(First, Ranges::End(Range));
+
+	auto Less = [&Predicate, &Projection]<typename T, typename U>(T&& A, U&& B) -> bool
+	{
+		return Invoke(Predicate, Invoke(Projection, Forward<T>(A)), Invoke(Projection, Forward<U>(B)));
+	};
+
+	if (First == Last) return;
+
+	NAMESPACE_PRIVATE::PatternDefeatingQuickSort(First, Last, Less, Math::BitWidth(static_cast<size_t>(Last - First)), true);
+}
+
+/**
+ * Sorts the elements in the range in ascending order. The order of equal elements is not guaranteed to be preserved.
+ * The pattern-defeating quicksort is used, which runs in O(N log N) in the worst case and in O(N) for sorted or reversed ranges.
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CRandomAccessIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, TInvokeResult<Proj, TIteratorReference<I>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<I, Proj>)
+FORCEINLINE constexpr void Sort(I First, S Last, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	Algorithms::Sort(Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Sorts the elements in the range in ascending order. The order of equal elements is preserved.
+ * The bottom-up merge sort is used, which runs in O(N log N) and allocates a buffer of N elements by Memory::Malloc().
+ *
+ * @param Range      - The range to sort.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, TInvokeResult<Proj, TRangeReference<R>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<TRangeIterator<R>, Proj>)
+void StableSort(R&& Range, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto First = Ranges::Begin(Range);
+	auto Last  = Algorithms::Next(First, Ranges::End(Range));
+
+	auto Less = [&Predicate, &Projection]<typename T, typename U>(T&& A, U&& B) -> bool
+	{
+		return Invoke(Predicate, Invoke(Projection, Forward<T>(A)), Invoke(Projection, Forward<U>(B)));
+	};
+
+	NAMESPACE_PRIVATE::StableSort(First, Last, Less);
+}
+
+/**
+ * Sorts the elements in the range in ascending order. The order of equal elements is preserved.
+ * The bottom-up merge sort is used, which runs in O(N log N) and allocates a buffer of N elements by Memory::Malloc().
+ *
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CRandomAccessIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, TInvokeResult<Proj, TIteratorReference<I>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<I, Proj>)
+FORCEINLINE void StableSort(I First, S Last, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	Algorithms::StableSort(Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Sorts the elements in the range in ascending order with the execution policy. The order of equal elements is not guaranteed to be preserved.
+ * The parallel policies sort the chunks of the range by the pattern-defeating quicksort on the worker pool and merge them in parallel,
+ * which allocates a buffer of N elements by Memory::Malloc(). The chunks depend only on the number of elements, so the result is deterministic.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to sort.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, TInvokeResult<Proj, TRangeReference<R>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CSizedRange<R&> && NAMESPACE_PRIVATE::CSortable<TRangeIterator<R>, Proj>)
+void Sort(E&&, R&& Range, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) Algorithms::Sort(Forward<R>(Range), Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+
+		auto First = Ranges::Begin(Range);
+		auto Last  = First + Ranges::Num(Range);
+
+		auto Less = [&Predicate, &Projection]<typename T, typename U>(T&& A, U&& B) -> bool
+		{
+			return Invoke(Predicate, Invoke(Projection, Forward<T>(A)), Invoke(Projection, Forward<U>(B)));
+		};
+
+		NAMESPACE_PRIVATE::ParallelMergeSort(First, Last, Less, [&Less](auto ChunkFirst, auto ChunkLast)
+		{
+			if (ChunkFirst == ChunkLast) return;
+
+			NAMESPACE_PRIVATE::PatternDefeatingQuickSort(ChunkFirst, ChunkLast, Less, Math::BitWidth(static_cast<size_t>(ChunkLast - ChunkFirst)), true);
+		});
+	}
+}
+
+/**
+ * Sorts the elements in the range in ascending order with the execution policy. The order of equal elements is not guaranteed to be preserved.
+ * The parallel policies sort the chunks of the range by the pattern-defeating quicksort on the worker pool and merge them in parallel,
+ * which allocates a buffer of N elements by Memory::Malloc(). The chunks depend only on the number of elements, so the result is deterministic.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, TInvokeResult<Proj, TIteratorReference<I>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<I, Proj>)
+FORCEINLINE void Sort(E&& Policy, I First, S Last, Pred Predicate = { }, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	Algorithms::Sort(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Sorts the elements in the range in ascending order with the execution policy. The order of equal elements is preserved.
+ * The parallel policies sort the chunks of the range by the merge sort on the worker pool and merge them in parallel,
+ * which allocates a buffer of N elements by Memory::Malloc(). The result is the same as the sequential version.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param Range      - The range to sort.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CExecutionPolicy E, CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, TInvokeResult<Proj, TRangeReference<R>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (CSizedRange<R&> && NAMESPACE_PRIVATE::CSortable<TRangeIterator<R>, Proj>)
+void StableSort(E&&, R&& Range, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (!NAMESPACE_PRIVATE::CParallelPolicy<E>) Algorithms::StableSort(Forward<R>(Range), Ref(Predicate), Ref(Projection));
+
+	else
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+
+		auto First = Ranges::Begin(Range);
+		auto Last  = First + Ranges::Num(Range);
+
+		auto Less = [&Predicate, &Projection]<typename T, typename U>(T&& A, U&& B) -> bool
+		{
+			return Invoke(Predicate, Invoke(Projection, Forward<T>(A)), Invoke(Projection, Forward<U>(B)));
+		};
+
+		NAMESPACE_PRIVATE::ParallelMergeSort(First, Last, Less, [&Less](auto ChunkFirst, auto ChunkLast)
+		{
+			NAMESPACE_PRIVATE::StableSort(ChunkFirst, ChunkLast, Less);
+		});
+	}
+}
+
+/**
+ * Sorts the elements in the range in ascending order with the execution policy. The order of equal elements is preserved.
+ * The parallel policies sort the chunks of the range by the merge sort on the worker pool and merge them in parallel,
+ * which allocates a buffer of N elements by Memory::Malloc(). The result is the same as the sequential version.
+ *
+ * @param Policy     - The execution policy to use.
+ * @param First      - The iterator of the range.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CExecutionPolicy E, CRandomAccessIterator I, CSizedSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, TInvokeResult<Proj, TIteratorReference<I>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<I, Proj>)
+FORCEINLINE void StableSort(E&& Policy, I First, S Last, Pred Predicate = { }, Proj Projection = { })
+{
+	checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+
+	Algorithms::StableSort(Forward<E>(Policy), Ranges::View(MoveTemp(First), Last), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Rearranges the elements so that the range [Begin, 'Middle') contains the smallest elements of the range in ascending order.
+ * The order of the remaining elements is unspecified. The heap selection is used, which runs in O(N log M).
+ *
+ * @param Range      - The range to sort partially.
+ * @param Middle     - The iterator of the end of the sorted part.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, TInvokeResult<Proj, TRangeReference<R>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<TRangeIterator<R>, Proj>)
+constexpr void PartialSort(R&& Range, TRangeIterator<R> Middle, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto First = Ranges::Begin(Range);
+	auto Last  = Algorithms::Next(First, Ranges::End(Range));
+
+	checkf(First <= Middle && Middle <= Last, TEXT("Illegal iterator. Please check Middle."));
+
+	auto Less = [&Predicate, &Projection]<typename T, typename U>(T&& A, U&& B) -> bool
+	{
+		return Invoke(Predicate, Invoke(Projection, Forward<T>(A)), Invoke(Projection, Forward<U>(B)));
+	};
+
+	NAMESPACE_PRIVATE::PartialSort(First, Middle, Last, Less);
+}
+
+/**
+ * Rearranges the elements so that the range ['First', 'Middle') contains the smallest elements of the range in ascending order.
+ * The order of the remaining elements is unspecified. The heap selection is used, which runs in O(N log M).
+ *
+ * @param First      - The iterator of the range.
+ * @param Middle     - The iterator of the end of the sorted part.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CRandomAccessIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, TInvokeResult<Proj, TIteratorReference<I>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<I, Proj>)
+FORCEINLINE constexpr void PartialSort(I First, I Middle, S Last, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	Algorithms::PartialSort(Ranges::View(MoveTemp(First), Last), MoveTemp(Middle), Ref(Predicate), Ref(Projection));
+}
+
+/**
+ * Rearranges the elements so that the element at 'Nth' is the one that would be there if the range were sorted,
+ * and no element before it is greater than any element after it. The introselect is used, which runs in O(N) on average.
+ *
+ * @param Range      - The range to rearrange.
+ * @param Nth        - The iterator of the element to select.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CRandomAccessRange R,
+	CRegularInvocable<TRangeReference<R>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TRangeReference<R>>, TInvokeResult<Proj, TRangeReference<R>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TRangeReference<R>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<TRangeIterator<R>, Proj>)
+constexpr void NthElement(R&& Range, TRangeIterator<R> Nth, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedRange<R&>)
+	{
+		checkf(Algorithms::Distance(Range) >= 0, TEXT("Illegal range. Please check Algorithms::Distance(Range)."));
+	}
+
+	auto First = Ranges::Begin(Range);
+	auto Last  = Algorithms::Next(First, Ranges::End(Range));
+
+	checkf(First <= Nth && Nth <= Last, TEXT("Illegal iterator. Please check Nth."));
+
+	if (Nth == Last) return;
+
+	auto Less = [&Predicate, &Projection]<typename T, typename U>(T&& A, U&& B) -> bool
+	{
+		return Invoke(Predicate, Invoke(Projection, Forward<T>(A)), Invoke(Projection, Forward<U>(B)));
+	};
+
+	NAMESPACE_PRIVATE::NthElement(First, Nth, Last, Less);
+}
+
+/**
+ * Rearranges the elements so that the element at 'Nth' is the one that would be there if the range were sorted,
+ * and no element before it is greater than any element after it. The introselect is used, which runs in O(N) on average.
+ *
+ * @param First      - The iterator of the range.
+ * @param Nth        - The iterator of the element to select.
+ * @param Last       - The sentinel of the range.
+ * @param Predicate  - The strict weak ordering predicate between the projected elements, which returns true if the first is less than the second.
+ * @param Projection - The projection to apply to the elements before comparing.
+ */
+template <CRandomAccessIterator I, CSentinelFor<I> S,
+	CRegularInvocable<TIteratorReference<I>> Proj =
+		decltype([]<typename T>(T&& A) -> T&& { return Forward<T>(A); }),
+	CStrictWeakOrder<TInvokeResult<Proj, TIteratorReference<I>>, TInvokeResult<Proj, TIteratorReference<I>>> Pred =
+		TConditional<CPartiallyOrdered<TInvokeResult<Proj, TIteratorReference<I>>>,
+			decltype([]<typename LHS, typename RHS>(const LHS& A, const RHS& B) { return A < B; }), void>>
+	requires (NAMESPACE_PRIVATE::CSortable<I, Proj>)
+FORCEINLINE constexpr void NthElement(I First, I Nth, S Last, Pred Predicate = { }, Proj Projection = { })
+{
+	if constexpr (CSizedSentinelFor<S, I>)
+	{
+		checkf(First - Last <= 0, TEXT("Illegal range iterator. Please check First <= Last."));
+	}
+
+	Algorithms::NthElement(Ranges::View(MoveTemp(First), Last), MoveTemp(Nth), Ref(Predicate), Ref(Projection));
+}
+
+NAMESPACE_END(Algorithms)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -12,6 +12,7 @@
 #include "Iterators/ReverseIterator.h"
 #include "Ranges/Utility.h"
 #include "Ranges/Factory.h"
+#include "Algorithms/Mutation.h"
 #include "Miscellaneous/Compare.h"
 #include "Miscellaneous/AssertionMacros.h"
 
@@ -654,6 +655,24 @@ public:
 		return FIterator(this, Impl.Pointer + EraseIndex);
 	}
 
+	/**
+	 * Removes all elements that satisfy the predicate in the container. Without changing the order of elements.
+	 * The remaining elements are compacted in a single pass, which is linear instead of erasing the elements one by one.
+	 *
+	 * @return The number of removed elements.
+	 */
+	template <CPredicate<T&> F> requires (CMovable<T>)
+	size_t RemoveAllIf(F Predicate, bool bAllowShrinking = true)
+	{
+		const FIterator NewEnd = Algorithms::RemoveIf(*this, MoveTemp(Predicate));
+
+		const size_t RemoveNum = End() - NewEnd;
+
+		StableErase(NewEnd, End(), bAllowShrinking);
+
+		return RemoveNum;
+	}
+
 	/** Removes the element at 'Iter' in the container. But it may change the order of elements. */
 	FORCEINLINE FIterator Erase(FConstIterator Iter, bool bAllowShrinking = true) requires (CMovable<T>)
 	{
@@ -957,14 +976,7 @@ public:
 	/** Overloads the GetTypeHash algorithm for TArray. */
 	NODISCARD friend FORCEINLINE size_t GetTypeHash(const TArray& A) requires (CHashable<T>)
 	{
-		size_t Result = 0;
-
-		for (FConstIterator Iter = A.Begin(); Iter != A.End(); ++Iter)
-		{
-			Result = HashCombine(Result, GetTypeHash(*Iter));
-		}
-
-		return Result;
+		return HashRange(A.GetData(), A.Num());
 	}
 
 	/** Overloads the Swap algorithm for TArray. */
@@ -277,14 +277,7 @@ public:
 	/** Overloads the GetTypeHash algorithm for TArrayView. */
 	NODISCARD friend FORCEINLINE constexpr size_t GetTypeHash(TArrayView A) requires (CHashable<FElementType>)
 	{
-		size_t Result = 0;
-
-		for (FIterator Iter = A.Begin(); Iter != A.End(); ++Iter)
-		{
-			Result = HashCombine(Result, GetTypeHash(*Iter));
-		}
-
-		return Result;
+		return HashRange(A.GetData(), A.Num());
 	}
 
 	ENABLE_RANGE_BASED_FOR_LOOP_SUPPORT
@@ -6,11 +6,14 @@
 #include "Templates/TypeHash.h"
 #include "Templates/Noncopyable.h"
 #include "Memory/Allocators.h"
+#include "Memory/BitwiseOperator.h"
 #include "Iterators/Utility.h"
 #include "Iterators/BasicIterator.h"
 #include "Iterators/Sentinel.h"
 #include "Iterators/ReverseIterator.h"
 #include "Ranges/Utility.h"
+#include "Ranges/View.h"
+#include "Numerics/Bit.h"
 #include "Miscellaneous/Compare.h"
 #include "Miscellaneous/AssertionMacros.h"
 
@@ -38,6 +41,8 @@ public:
 	class      FReference;
 	using FConstReference = bool;
 
+	class FSetBitIterator;
+
 	using      FIterator = TIteratorImpl<false>;
 	using FConstIterator = TIteratorImpl<true >;
 
@@ -296,28 +301,19 @@ public:
 
 		if (Num() <= InValue.Num())
 		{
-			for (size_t Index = 0; Index != NumBlocks(); ++Index)
-			{
-				Impl.Pointer[Index] &= InValue.Impl.Pointer[Index];
-			}
+			Memory::BitwiseAnd(Impl.Pointer, InValue.Impl.Pointer, NumBlocks());
 		}
 		else
 		{
 			const size_t LastBlock = InValue.NumBlocks() - 1;
 
-			for (size_t Index = 0; Index != LastBlock; ++Index)
-			{
-				Impl.Pointer[Index] &= InValue.Impl.Pointer[Index];
-			}
+			Memory::BitwiseAnd(Impl.Pointer, InValue.Impl.Pointer, LastBlock);
 
 			const FBlockType LastBlockBitmask = InValue.Num() % BlockWidth != 0 ? (1ull << InValue.Num() % BlockWidth) - 1 : -1;
 
 			Impl.Pointer[LastBlock] &= InValue.Impl.Pointer[LastBlock] & LastBlockBitmask;
 
-			for (size_t Index = LastBlock + 1; Index != NumBlocks(); ++Index)
-			{
-				Impl.Pointer[Index] = 0;
-			}
+			Memory::Memzero(Impl.Pointer + LastBlock + 1, (NumBlocks() - LastBlock - 1) * sizeof(FBlockType));
 		}
 
 		return *this;
@@ -334,19 +330,13 @@ public:
 
 		if (Num() <= InValue.Num())
 		{
-			for (size_t Index = 0; Index != NumBlocks(); ++Index)
-			{
-				Impl.Pointer[Index] |= InValue.Impl.Pointer[Index];
-			}
+			Memory::BitwiseOr(Impl.Pointer, InValue.Impl.Pointer, NumBlocks());
 		}
 		else
 		{
 			const size_t LastBlock = InValue.NumBlocks() - 1;
 
-			for (size_t Index = 0; Index != LastBlock; ++Index)
-			{
-				Impl.Pointer[Index] |= InValue.Impl.Pointer[Index];
-			}
+			Memory::BitwiseOr(Impl.Pointer, InValue.Impl.Pointer, LastBlock);
 
 			const FBlockType LastBlockBitmask = InValue.Num() % BlockWidth != 0 ? (1ull << InValue.Num() % BlockWidth) - 1 : -1;
 
@@ -367,19 +357,13 @@ public:
 
 		if (Num() <= InValue.Num())
 		{
-			for (size_t Index = 0; Index != NumBlocks(); ++Index)
-			{
-				Impl.Pointer[Index] ^= InValue.Impl.Pointer[Index];
-			}
+			Memory::BitwiseXor(Impl.Pointer, InValue.Impl.Pointer, NumBlocks());
 		}
 		else
 		{
 			const size_t LastBlock = InValue.NumBlocks() - 1;
 
-			for (size_t Index = 0; Index != LastBlock; ++Index)
-			{
-				Impl.Pointer[Index] ^= InValue.Impl.Pointer[Index];
-			}
+			Memory::BitwiseXor(Impl.Pointer, InValue.Impl.Pointer, LastBlock);
 
 			const FBlockType LastBlockBitmask = InValue.Num() % BlockWidth != 0 ? (1ull << InValue.Num() % BlockWidth) - 1 : -1;
 
@@ -389,6 +373,49 @@ public:
 		return *this;
 	}
 
+	/** Sets the bits to the result of binary AND on corresponding pairs of bits of *this and the complement of other, without materializing the complement. */
+	TBitset& AndNot(const TBitset& InValue)
+	{
+		if (&InValue == this) UNLIKELY return Set(false);
+
+		if (Num() == 0) return *this;
+
+		if (InValue.Num() == 0) return *this;
+
+		if (Num() <= InValue.Num())
+		{
+			Memory::BitwiseAndNot(Impl.Pointer, InValue.Impl.Pointer, NumBlocks());
+		}
+		else
+		{
+			const size_t LastBlock = InValue.NumBlocks() - 1;
+
+			Memory::BitwiseAndNot(Impl.Pointer, InValue.Impl.Pointer, LastBlock);
+
+			const FBlockType LastBlockBitmask = InValue.Num() % BlockWidth != 0 ? (1ull << InValue.Num() % BlockWidth) - 1 : -1;
+
+			Impl.Pointer[LastBlock] &= ~(InValue.Impl.Pointer[LastBlock] & LastBlockBitmask);
+		}
+
+		return *this;
+	}
+
+	/** @return The number of bits that are set to true in both *this and other, without materializing the result of binary AND. */
+	NODISCARD size_t AndCount(const TBitset& InValue) const
+	{
+		const size_t CommonNum = Num() < InValue.Num() ? Num() : InValue.Num();
+
+		if (CommonNum == 0) return 0;
+
+		const size_t LastBlock = (CommonNum + BlockWidth - 1) / BlockWidth - 1;
+
+		const FBlockType LastBlockBitmask = CommonNum % BlockWidth != 0 ? (1ull << CommonNum % BlockWidth) - 1 : -1;
+
+		const size_t Result = Memory::BitwiseAndCount(Impl.Pointer, InValue.Impl.Pointer, LastBlock);
+
+		return Result + Math::CountAllOne(static_cast<FBlockType>(Impl.Pointer[LastBlock] & InValue.Impl.Pointer[LastBlock] & LastBlockBitmask));
+	}
+
 	NODISCARD friend FORCEINLINE TBitset operator&(const TBitset& LHS, const TBitset& RHS) { return LHS.Num() < RHS.Num() ? TBitset(RHS) &= LHS : TBitset(LHS) &= RHS; }
 	NODISCARD friend FORCEINLINE TBitset operator|(const TBitset& LHS, const TBitset& RHS) { return LHS.Num() < RHS.Num() ? TBitset(RHS) |= LHS : TBitset(LHS) |= RHS; }
 	NODISCARD friend FORCEINLINE TBitset operator^(const TBitset& LHS, const TBitset& RHS) { return LHS.Num() < RHS.Num() ? TBitset(RHS) ^= LHS : TBitset(LHS) ^= RHS; }
@@ -398,10 +425,7 @@ public:
 	{
 		TBitset Result = *this;
 
-		for (size_t Index = 0; Index != NumBlocks(); ++Index)
-		{
-			Result.Impl.Pointer[Index] = ~Result.Impl.Pointer[Index];
-		}
+		Memory::BitwiseNot(Result.Impl.Pointer, NumBlocks());
 
 		return Result;
 	}
@@ -409,28 +433,9 @@ public:
 	/** Performs binary shift left. */
 	TBitset& operator<<=(size_t Offset)
 	{
-		const size_t Blockshift = Offset / BlockWidth;
-		const size_t Bitshift   = Offset % BlockWidth;
-
 		if (Num() == 0) return *this;
 
-		if (Blockshift != 0)
-		{
-			for (size_t Index = NumBlocks() - 1; Index != -1; --Index)
-			{
-				Impl.Pointer[Index] = Index >= Blockshift ? Impl.Pointer[Index - Blockshift] : 0;
-			}
-		}
-
-		if (Bitshift != 0)
-		{
-			for (size_t Index = NumBlocks() - 1; Index != 0; --Index)
-			{
-				Impl.Pointer[Index] = Impl.Pointer[Index] << Bitshift | Impl.Pointer[Index - 1] >> (BlockWidth - Bitshift);
-			}
-
-			Impl.Pointer[0] <<= Bitshift;
-		}
+		Memory::BitwiseShiftLeft(Impl.Pointer, NumBlocks(), Offset);
 
 		return *this;
 	}
@@ -438,9 +443,6 @@ public:
 	/** Performs binary shift right. */
 	TBitset& operator>>=(size_t Offset)
 	{
-		const size_t Blockshift = Offset / BlockWidth;
-		const size_t Bitshift   = Offset % BlockWidth;
-
 		if (Num() == 0) return *this;
 
 		if (Num() % BlockWidth != 0)
@@ -448,23 +450,7 @@ public:
 			Impl.Pointer[NumBlocks() - 1] &= (1ull << Num() % BlockWidth) - 1;
 		}
 
-		if (Blockshift != 0)
-		{
-			for (size_t Index = 0; Index != NumBlocks(); ++Index)
-			{
-				Impl.Pointer[Index] = Index < NumBlocks() - Blockshift ? Impl.Pointer[Index + Blockshift] : 0;
-			}
-		}
-
-		if (Bitshift != 0)
-		{
-			for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
-			{
-				Impl.Pointer[Index] = Impl.Pointer[Index] >> Bitshift | Impl.Pointer[Index + 1] << (BlockWidth - Bitshift);
-			}
-
-			Impl.Pointer[NumBlocks() - 1] >>= Bitshift;
-		}
+		Memory::BitwiseShiftRight(Impl.Pointer, NumBlocks(), Offset);
 
 		return *this;
 	}
@@ -477,10 +463,7 @@ public:
 	{
 		if (Num() == 0) return true;
 
-		for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
-		{
-			if (Impl.Pointer[Index] != -1) return false;
-		}
+		if (!Memory::IsAllOne(Impl.Pointer, NumBlocks() - 1)) return false;
 
 		const FBlockType LastBlockBitmask = Num() % BlockWidth != 0 ? (1ull << Num() % BlockWidth) - 1 : -1;
 
@@ -492,10 +475,7 @@ public:
 	{
 		if (Num() == 0) return false;
 
-		for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
-		{
-			if (Impl.Pointer[Index] != 0) return true;
-		}
+		if (!Memory::IsAllZero(Impl.Pointer, NumBlocks() - 1)) return true;
 
 		const FBlockType LastBlockBitmask = Num() % BlockWidth != 0 ? (1ull << Num() % BlockWidth) - 1 : -1;
 
@@ -512,57 +492,27 @@ public:
 
 		size_t Result = 0;
 
-		constexpr auto BlockCount = [](FBlockType Block)
-		{
-			static_assert(sizeof(FBlockType) <= sizeof(uint64), "The block width of TBitset is unexpected");
-
-			if constexpr (sizeof(FBlockType) == sizeof(uint8))
-			{
-				Block = (Block & 0x55ull) + ((Block >> 1) & 0x55ull);
-				Block = (Block & 0x33ull) + ((Block >> 2) & 0x33ull);
-				Block = (Block & 0x0Full) + ((Block >> 4) & 0x0Full);
-			}
-			else if constexpr (sizeof(FBlockType) == sizeof(uint16))
-			{
-				Block = (Block & 0x5555ull) + ((Block >>  1) & 0x5555ull);
-				Block = (Block & 0x3333ull) + ((Block >>  2) & 0x3333ull);
-				Block = (Block & 0x0F0Full) + ((Block >>  4) & 0x0F0Full);
-				Block = (Block & 0x00FFull) + ((Block >>  8) & 0x00FFull);
-			}
-			else if constexpr (sizeof(FBlockType) == sizeof(uint32))
-			{
-				Block = (Block & 0x55555555ull) + ((Block >>  1) & 0x55555555ull);
-				Block = (Block & 0x33333333ull) + ((Block >>  2) & 0x33333333ull);
-				Block = (Block & 0x0F0F0F0Full) + ((Block >>  4) & 0x0F0F0F0Full);
-				Block = (Block & 0x00FF00FFull) + ((Block >>  8) & 0x00FF00FFull);
-				Block = (Block & 0x0000FFFFull) + ((Block >> 16) & 0x0000FFFFull);
-			}
-			else if constexpr (sizeof(FBlockType) == sizeof(uint64))
-			{
-				Block = (Block & 0x5555555555555555ull) + ((Block >>  1) & 0x5555555555555555ull);
-				Block = (Block & 0x3333333333333333ull) + ((Block >>  2) & 0x3333333333333333ull);
-				Block = (Block & 0x0F0F0F0F0F0F0F0Full) + ((Block >>  4) & 0x0F0F0F0F0F0F0F0Full);
-				Block = (Block & 0x00FF00FF00FF00FFull) + ((Block >>  8) & 0x00FF00FF00FF00FFull);
-				Block = (Block & 0x0000FFFF0000FFFFull) + ((Block >> 16) & 0x0000FFFF0000FFFFull);
-				Block = (Block & 0x00000000FFFFFFFFull) + ((Block >> 32) & 0x00000000FFFFFFFFull);
-			}
-			else check_no_entry();
-
-			return Block;
-		};
-
 		for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
 		{
-			Result += BlockCount(Impl.Pointer[Index]);
+			Result += Math::CountAllOne(Impl.Pointer[Index]);
 		}
 
 		const FBlockType LastBlockBitmask = Num() % BlockWidth != 0 ? (1ull << Num() % BlockWidth) - 1 : -1;
 
-		Result += BlockCount(Impl.Pointer[NumBlocks() - 1] & LastBlockBitmask);
+		Result += Math::CountAllOne(static_cast<FBlockType>(Impl.Pointer[NumBlocks() - 1] & LastBlockBitmask));
 
 		return Result;
 	}
 
+	/** @return The index of the first bit that is set to true, or INDEX_NONE if there is no such bit. */
+	NODISCARD FORCEINLINE size_t FindFirstSet() const { return FindSetFrom(0); }
+
+	/** @return The index of the first bit after 'Index' that is set to true, or INDEX_NONE if there is no such bit. */
+	NODISCARD FORCEINLINE size_t FindNextSet(size_t Index) const { return Index < Num() ? FindSetFrom(Index + 1) : INDEX_NONE; }
+
+	/** @return The view of the indices of the bits that are set to true, in ascending order. */
+	NODISCARD FORCEINLINE auto SetBits() const { return Ranges::View(FSetBitIterator(this, FindFirstSet()), DefaultSentinel); }
+
 	/** Sets all bits to true. */
 	TBitset& Set(bool InValue = true)
 	{
@@ -574,10 +524,7 @@ public:
 	/** Flips all bits (like operator~, but in-place). */
 	TBitset& Flip()
 	{
-		for (size_t Index = 0; Index != NumBlocks(); ++Index)
-		{
-			Impl.Pointer[Index] = ~Impl.Pointer[Index];
-		}
+		Memory::BitwiseNot(Impl.Pointer, NumBlocks());
 
 		return *this;
 	}
@@ -906,6 +853,28 @@ private:
 	}
 	ALLOCATOR_WRAPPER_END(FAllocatorType, FBlockType, Impl)
 
+	NODISCARD size_t FindSetFrom(size_t Index) const
+	{
+		if (Index >= Num()) return INDEX_NONE;
+
+		const FBlockType LastBlockBitmask = Num() % BlockWidth != 0 ? (1ull << Num() % BlockWidth) - 1 : -1;
+
+		size_t BlockIndex = Index / BlockWidth;
+
+		FBlockType Block = Impl.Pointer[BlockIndex] & static_cast<FBlockType>(static_cast<FBlockType>(-1) << Index % BlockWidth);
+
+		while (true)
+		{
+			if (BlockIndex == NumBlocks() - 1) Block &= LastBlockBitmask;
+
+			if (Block != 0) return BlockIndex * BlockWidth + Math::CountRightZero(Block);
+
+			if (++BlockIndex == NumBlocks()) return INDEX_NONE;
+
+			Block = Impl.Pointer[BlockIndex];
+		}
+	}
+
 public:
 
 	class FReference final : private FSingleton
@@ -937,6 +906,46 @@ public:
 
 	};
 
+	/** The forward iterator over the indices of the bits that are set to true. */
+	class FSetBitIterator final
+	{
+	public:
+
+		using FElementType = size_t;
+
+		FORCEINLINE FSetBitIterator() = default;
+
+		FORCEINLINE FSetBitIterator(const FSetBitIterator&)            = default;
+		FORCEINLINE FSetBitIterator(FSetBitIterator&&)                 = default;
+		FORCEINLINE FSetBitIterator& operator=(const FSetBitIterator&) = default;
+		FORCEINLINE FSetBitIterator& operator=(FSetBitIterator&&)      = default;
+
+		NODISCARD friend FORCEINLINE bool operator==(const FSetBitIterator& LHS, const FSetBitIterator& RHS) { check(LHS.Owner == RHS.Owner); return LHS.BitIndex == RHS.BitIndex; }
+
+		NODISCARD FORCEINLINE bool operator==(FDefaultSentinel) const& { return BitIndex == INDEX_NONE; }
+
+		NODISCARD FORCEINLINE size_t operator*() const { checkf(BitIndex != INDEX_NONE, TEXT("Read access violation. Please check IsValidIterator().")); return BitIndex; }
+
+		FORCEINLINE FSetBitIterator& operator++() { BitIndex = Owner->FindNextSet(BitIndex); return *this; }
+
+		FORCEINLINE FSetBitIterator operator++(int) { FSetBitIterator Temp = *this; ++*this; return Temp; }
+
+	private:
+
+		const TBitset* Owner    = nullptr;
+		size_t         BitIndex = INDEX_NONE;
+
+		FORCEINLINE FSetBitIterator(const TBitset* InContainer, size_t InBitIndex)
+			: Owner(InContainer), BitIndex(InBitIndex)
+		{ }
+
+		friend TBitset;
+
+	};
+
+	static_assert(CForwardIterator<FSetBitIterator>);
+	static_assert(CSentinelFor<FDefaultSentinel, FSetBitIterator>);
+
 private:
 
 	template <bool bConst>
@@ -0,0 +1,1281 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/ScopeHelper.h"
+#include "Memory/MemoryOperator.h"
+#include "Memory/BitwiseOperator.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Bitset.h"
+#include "Iterators/Utility.h"
+#include "Iterators/Sentinel.h"
+#include "Ranges/View.h"
+#include "Numerics/Bit.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+/**
+ * The compressed set of 32-bit unsigned integers in the style of roaring bitmaps.
+ * The value domain is split into 65536-bit chunks, and each non-empty chunk is stored in the most suitable container:
+ * a sorted array of up to 4096 values, a 65536-bit bitmap, or a sorted list of runs that is produced by Optimize().
+ * Unlike TBitset, the memory cost is proportional to the number of values rather than to the largest value.
+ */
+class FCompressedBitset
+{
+public:
+
+	using FElementType = uint32;
+
+	class FSetBitIterator;
+
+	/** The number of values covered by one container. */
+	static constexpr size_t ChunkWidth = 65536;
+
+	/** The maximum number of values stored in an array container, beyond which a bitmap container is smaller. */
+	static constexpr size_t ArrayMaxNum = 4096;
+
+	/** Default constructor. Constructs an empty bitset. */
+	FORCEINLINE FCompressedBitset() = default;
+
+	/** Constructs the bitset with the values of the initializer list. */
+	FCompressedBitset(initializer_list<uint32> IL)
+	{
+		for (uint32 Value : IL) Add(Value);
+	}
+
+	/** Constructs the bitset with the indices of the bits of 'InValue' that are set to true. */
+	template <CUnsignedIntegral InBlockType, CAllocator<InBlockType> Allocator>
+	explicit FCompressedBitset(const TBitset<InBlockType, Allocator>& InValue)
+	{
+		using FBlockType = InBlockType;
+
+		constexpr size_t BlockWidth = sizeof(FBlockType) * 8;
+		constexpr size_t BlockRatio = 64 / BlockWidth;
+
+		checkf(InValue.Num() <= static_cast<size_t>(TNumericLimits<uint32>::Max()) + 1, TEXT("Illegal bitset size. Please check Num()."));
+
+		const size_t NumWords = (InValue.Num() + 63) / 64;
+
+		for (size_t Key = 0; Key * BitmapWords < NumWords; ++Key)
+		{
+			FContainer Container;
+
+			Container.Key  = static_cast<uint16>(Key);
+			Container.Type = EContainerType::Bitmap;
+
+			Container.Words.SetNum(BitmapWords);
+
+			for (size_t WordIndex = 0; WordIndex != BitmapWords; ++WordIndex)
+			{
+				const size_t GlobalIndex = Key * BitmapWords + WordIndex;
+
+				uint64 Word = 0;
+
+				if (GlobalIndex < NumWords)
+				{
+					for (size_t Index = 0; Index != BlockRatio && GlobalIndex * BlockRatio + Index < InValue.NumBlocks(); ++Index)
+					{
+						Word |= static_cast<uint64>(InValue.GetData()[GlobalIndex * BlockRatio + Index]) << Index * BlockWidth;
+					}
+
+					if (GlobalIndex == NumWords - 1 && InValue.Num() % 64 != 0) Word &= (1ull << InValue.Num() % 64) - 1;
+				}
+
+				Container.Words[WordIndex] = Word;
+				Container.Count += Math::CountAllOne(Word);
+			}
+
+			if (Container.Count == 0) continue;
+
+			Normalize(Container);
+
+			Containers.PushBack(MoveTemp(Container));
+		}
+	}
+
+	/** Copy constructor. Constructs the bitset with the copy of the values of 'InValue'. */
+	FORCEINLINE FCompressedBitset(const FCompressedBitset&) = default;
+
+	/** Move constructor. After the move, 'InValue' is guaranteed to be empty. */
+	FORCEINLINE FCompressedBitset(FCompressedBitset&&) = default;
+
+	/** Destructs the bitset. The storage is deallocated. */
+	FORCEINLINE ~FCompressedBitset() = default;
+
+	/** Copy assignment operator. Replaces the values with a copy of the values of 'InValue'. */
+	FORCEINLINE FCompressedBitset& operator=(const FCompressedBitset&) = default;
+
+	/** Move assignment operator. After the move, 'InValue' is guaranteed to be empty. */
+	FORCEINLINE FCompressedBitset& operator=(FCompressedBitset&&) = default;
+
+	/** Compares the values of two bitsets, regardless of the kind of containers they are stored in. */
+	NODISCARD friend bool operator==(const FCompressedBitset& LHS, const FCompressedBitset& RHS)
+	{
+		if (LHS.Containers.Num() != RHS.Containers.Num()) return false;
+
+		for (size_t Index = 0; Index != LHS.Containers.Num(); ++Index)
+		{
+			const FContainer& ContainerLHS = LHS.Containers[Index];
+			const FContainer& ContainerRHS = RHS.Containers[Index];
+
+			if (ContainerLHS.Key != ContainerRHS.Key || ContainerLHS.Count != ContainerRHS.Count) return false;
+
+			if (ContainerLHS.Type == ContainerRHS.Type)
+			{
+				if (ContainerLHS.Type == EContainerType::Bitmap ? ContainerLHS.Words != ContainerRHS.Words : ContainerLHS.Values != ContainerRHS.Values) return false;
+
+				continue;
+			}
+
+			FContainer ScratchLHS;
+			FContainer ScratchRHS;
+
+			const FContainer& BitmapLHS = AsBitmap(ContainerLHS, ScratchLHS);
+			const FContainer& BitmapRHS = AsBitmap(ContainerRHS, ScratchRHS);
+
+			if (BitmapLHS.Words != BitmapRHS.Words) return false;
+		}
+
+		return true;
+	}
+
+	/** Sets the values to the intersection of *this and other. */
+	FCompressedBitset& operator&=(const FCompressedBitset& InValue)
+	{
+		if (&InValue == this) UNLIKELY return *this;
+
+		return Apply(InValue, EOperation::And);
+	}
+
+	/** Sets the values to the union of *this and other. */
+	FCompressedBitset& operator|=(const FCompressedBitset& InValue)
+	{
+		if (&InValue == this) UNLIKELY return *this;
+
+		return Apply(InValue, EOperation::Or);
+	}
+
+	/** Sets the values to the symmetric difference of *this and other. */
+	FCompressedBitset& operator^=(const FCompressedBitset& InValue)
+	{
+		if (&InValue == this) UNLIKELY { Reset(); return *this; }
+
+		return Apply(InValue, EOperation::Xor);
+	}
+
+	/** Sets the values to the difference of *this and other, without materializing the complement of other. */
+	FCompressedBitset& AndNot(const FCompressedBitset& InValue)
+	{
+		if (&InValue == this) UNLIKELY { Reset(); return *this; }
+
+		return Apply(InValue, EOperation::AndNot);
+	}
+
+	/** @return The number of values in the intersection of *this and other, without materializing the intersection. */
+	NODISCARD size_t AndCount(const FCompressedBitset& InValue) const
+	{
+		size_t Result = 0;
+
+		size_t IndexLHS = 0;
+		size_t IndexRHS = 0;
+
+		while (IndexLHS != Containers.Num() && IndexRHS != InValue.Containers.Num())
+		{
+			const FContainer& ContainerLHS = Containers[IndexLHS];
+			const FContainer& ContainerRHS = InValue.Containers[IndexRHS];
+
+			if      (ContainerLHS.Key < ContainerRHS.Key) ++IndexLHS;
+			else if (ContainerLHS.Key > ContainerRHS.Key) ++IndexRHS;
+			else
+			{
+				Result += ContainerAndCount(ContainerLHS, ContainerRHS);
+
+				++IndexLHS;
+				++IndexRHS;
+			}
+		}
+
+		return Result;
+	}
+
+	NODISCARD friend FORCEINLINE FCompressedBitset operator&(const FCompressedBitset& LHS, const FCompressedBitset& RHS) { return FCompressedBitset(LHS) &= RHS; }
+	NODISCARD friend FORCEINLINE FCompressedBitset operator|(const FCompressedBitset& LHS, const FCompressedBitset& RHS) { return FCompressedBitset(LHS) |= RHS; }
+	NODISCARD friend FORCEINLINE FCompressedBitset operator^(const FCompressedBitset& LHS, const FCompressedBitset& RHS) { return FCompressedBitset(LHS) ^= RHS; }
+
+	/** Adds the value to the bitset. */
+	void Add(uint32 Value)
+	{
+		const uint16 Key = static_cast<uint16>(Value >> 16);
+		const uint16 Low = static_cast<uint16>(Value);
+
+		const size_t ContainerIndex = FindContainer(Key);
+
+		if (ContainerIndex == Containers.Num() || Containers[ContainerIndex].Key != Key)
+		{
+			FContainer Container;
+
+			Container.Key   = Key;
+			Container.Count = 1;
+
+			Container.Values.PushBack(Low);
+
+			Containers.Insert(Containers.Begin() + ContainerIndex, MoveTemp(Container));
+
+			return;
+		}
+
+		FContainer& Container = Containers[ContainerIndex];
+
+		if (Container.Type == EContainerType::Run)
+		{
+			if (ContainerContains(Container, Low)) return;
+
+			Expand(Container);
+		}
+
+		if (Container.Type == EContainerType::Array)
+		{
+			const size_t Index = LowerBound(Container.Values.GetData(), Container.Values.Num(), Low);
+
+			if (Index != Container.Values.Num() && Container.Values[Index] == Low) return;
+
+			if (Container.Count < ArrayMaxNum)
+			{
+				Container.Values.Insert(Container.Values.Begin() + Index, Low);
+
+				++Container.Count;
+
+				return;
+			}
+
+			ToBitmap(Container);
+		}
+
+		uint64& Word = Container.Words[Low / 64];
+
+		const uint64 Mask = 1ull << Low % 64;
+
+		if ((Word & Mask) == 0)
+		{
+			Word |= Mask;
+
+			++Container.Count;
+		}
+	}
+
+	/** Removes the value from the bitset. */
+	void Remove(uint32 Value)
+	{
+		const uint16 Key = static_cast<uint16>(Value >> 16);
+		const uint16 Low = static_cast<uint16>(Value);
+
+		const size_t ContainerIndex = FindContainer(Key);
+
+		if (ContainerIndex == Containers.Num() || Containers[ContainerIndex].Key != Key) return;
+
+		FContainer& Container = Containers[ContainerIndex];
+
+		if (!ContainerContains(Container, Low)) return;
+
+		Expand(Container);
+
+		if (Container.Type == EContainerType::Array)
+		{
+			Container.Values.StableErase(Container.Values.Begin() + LowerBound(Container.Values.GetData(), Container.Values.Num(), Low));
+		}
+		else Container.Words[Low / 64] &= ~(1ull << Low % 64);
+
+		--Container.Count;
+
+		if (Container.Count == 0) Containers.StableErase(Containers.Begin() + ContainerIndex);
+
+		else Normalize(Container);
+	}
+
+	/** @return true if the value is in the bitset, false otherwise. */
+	NODISCARD bool Contains(uint32 Value) const
+	{
+		const uint16 Key = static_cast<uint16>(Value >> 16);
+
+		const size_t ContainerIndex = FindContainer(Key);
+
+		if (ContainerIndex == Containers.Num() || Containers[ContainerIndex].Key != Key) return false;
+
+		return ContainerContains(Containers[ContainerIndex], static_cast<uint16>(Value));
+	}
+
+	/** @return The number of values in the bitset. */
+	NODISCARD size_t Count() const
+	{
+		size_t Result = 0;
+
+		for (const FContainer& Container : Containers) Result += Container.Count;
+
+		return Result;
+	}
+
+	/** @return true if the bitset is empty, false otherwise. */
+	NODISCARD FORCEINLINE bool IsEmpty() const { return Containers.IsEmpty(); }
+
+	/** @return The smallest value in the bitset, or INDEX_NONE if the bitset is empty. */
+	NODISCARD FORCEINLINE size_t FindFirstSet() const { size_t ContainerIndex = 0; return FindSetFrom(ContainerIndex, 0); }
+
+	/** @return The smallest value greater than 'Index' in the bitset, or INDEX_NONE if there is no such value. */
+	NODISCARD size_t FindNextSet(size_t Index) const
+	{
+		if (Index >= TNumericLimits<uint32>::Max()) return INDEX_NONE;
+
+		size_t ContainerIndex = FindContainer(static_cast<uint16>(Index >> 16));
+
+		return FindSetFrom(ContainerIndex, Index + 1);
+	}
+
+	/** @return The view of the values in the bitset in ascending order. */
+	NODISCARD FORCEINLINE auto SetBits() const
+	{
+		size_t ContainerIndex = 0;
+
+		const size_t Value = FindSetFrom(ContainerIndex, 0);
+
+		return Ranges::View(FSetBitIterator(this, ContainerIndex, Value), DefaultSentinel);
+	}
+
+	/**
+	 * Converts the containers to run containers wherever this makes them smaller, and back otherwise.
+	 * This is usually called once after a batch of modifications, since modifying a run container expands it first.
+	 */
+	void Optimize()
+	{
+		for (FContainer& Container : Containers)
+		{
+			const size_t NumRuns = ContainerNumRuns(Container);
+
+			const size_t RunBytes    = NumRuns * 2 * sizeof(uint16);
+			const size_t ExpandBytes = Container.Count <= ArrayMaxNum ? Container.Count * sizeof(uint16) : BitmapWords * sizeof(uint64);
+
+			if (RunBytes < ExpandBytes) ToRun(Container, NumRuns);
+
+			else Expand(Container);
+		}
+	}
+
+	/** @return The dense bitset that has the bits at the values set to true, whose size is the largest value plus one. */
+	template <typename InBitsetType = FBitset> requires (CUnsignedIntegral<typename InBitsetType::FBlockType>)
+	NODISCARD InBitsetType ToBitset() const
+	{
+		using FBlockType = typename InBitsetType::FBlockType;
+
+		constexpr size_t BlockWidth = sizeof(FBlockType) * 8;
+		constexpr size_t BlockRatio = 64 / BlockWidth;
+
+		const size_t Num = IsEmpty() ? 0 : (static_cast<size_t>(Containers.Back().Key) << 16) + ContainerLast(Containers.Back()) + 1;
+
+		InBitsetType Result(Num);
+
+		Result.Set(false);
+
+		for (const FContainer& Container : Containers)
+		{
+			const size_t Base = static_cast<size_t>(Container.Key) << 16;
+
+			if (Container.Type == EContainerType::Bitmap)
+			{
+				for (size_t WordIndex = 0; WordIndex != BitmapWords; ++WordIndex)
+				{
+					const uint64 Word = Container.Words[WordIndex];
+
+					if (Word == 0) continue;
+
+					for (size_t Index = 0; Index != BlockRatio; ++Index)
+					{
+						const size_t BlockIndex = (Base / 64 + WordIndex) * BlockRatio + Index;
+
+						if (BlockIndex < Result.NumBlocks()) Result.GetData()[BlockIndex] |= static_cast<FBlockType>(Word >> Index * BlockWidth);
+					}
+				}
+			}
+			else if (Container.Type == EContainerType::Array)
+			{
+				for (uint16 Value : Container.Values) Result[Base + Value] = true;
+			}
+			else
+			{
+				for (size_t Index = 0; Index != Container.Values.Num(); Index += 2)
+				{
+					for (size_t Value = Container.Values[Index]; Value <= static_cast<size_t>(Container.Values[Index] + Container.Values[Index + 1]); ++Value)
+					{
+						Result[Base + Value] = true;
+					}
+				}
+			}
+		}
+
+		return Result;
+	}
+
+	/**
+	 * Appends the compact little-endian byte representation of the bitset to 'Result',
+	 * which can be saved by FileSystem::SaveArrayToFile() and restored by Deserialize().
+	 */
+	void Serialize(TArray<uint8>& Result) const
+	{
+		size_t NumBytes = HeaderBytes + Containers.Num() * DescriptorBytes;
+
+		for (const FContainer& Container : Containers)
+		{
+			NumBytes += Container.Type == EContainerType::Bitmap ? BitmapWords * sizeof(uint64) : Container.Values.Num() * sizeof(uint16);
+		}
+
+		const size_t Offset = Result.Num();
+
+		Result.SetNum(Offset + NumBytes);
+
+		uint8* Pointer = Result.GetData() + Offset;
+
+		Store<uint32>(Pointer, SerialCookie);
+		Store<uint32>(Pointer, static_cast<uint32>(Containers.Num()));
+
+		for (const FContainer& Container : Containers)
+		{
+			Store<uint16>(Pointer, Container.Key);
+			Store<uint8 >(Pointer, static_cast<uint8>(Container.Type));
+			Store<uint8 >(Pointer, 0);
+
+			// The number of values of the array or bitmap container, or the number of runs of the run container.
+			Store<uint32>(Pointer, static_cast<uint32>(Container.Type == EContainerType::Run ? Container.Values.Num() / 2 : Container.Count));
+		}
+
+		for (const FContainer& Container : Containers)
+		{
+			if (Container.Type == EContainerType::Bitmap)
+			{
+				for (uint64 Word : Container.Words) Store<uint64>(Pointer, Word);
+			}
+			else for (uint16 Value : Container.Values) Store<uint16>(Pointer, Value);
+		}
+
+		check(Pointer == Result.GetData() + Result.Num());
+	}
+
+	/**
+	 * Replaces the values with those serialized in 'Data', e.g. the bytes loaded by FileSystem::LoadFileToArray().
+	 *
+	 * @return true if the data is well-formed, otherwise the bitset is empty and false is returned.
+	 */
+	bool Deserialize(TArrayView<const uint8> Data)
+	{
+		Reset();
+
+		auto ResetGuard = TScopeCallback([this] { Reset(); });
+
+		const uint8* Pointer = Data.GetData();
+		const uint8* End     = Data.GetData() + Data.Num();
+
+		if (Data.Num() < HeaderBytes) return false;
+
+		if (Load<uint32>(Pointer) != SerialCookie) return false;
+
+		const size_t NumContainers = Load<uint32>(Pointer);
+
+		if (static_cast<size_t>(End - Pointer) / DescriptorBytes < NumContainers) return false;
+
+		Containers.SetNum(NumContainers);
+
+		for (size_t ContainerIndex = 0; ContainerIndex != NumContainers; ++ContainerIndex)
+		{
+			FContainer& Container = Containers[ContainerIndex];
+
+			Container.Key = Load<uint16>(Pointer);
+
+			const uint8 Type = Load<uint8>(Pointer);
+
+			if (Load<uint8>(Pointer) != 0) return false;
+
+			Container.Count = Load<uint32>(Pointer);
+
+			if (ContainerIndex != 0 && Container.Key <= Containers[ContainerIndex - 1].Key) return false;
+
+			switch (Type)
+			{
+			case static_cast<uint8>(EContainerType::Array):  if (Container.Count == 0 || Container.Count > ChunkWidth)     return false; break;
+			case static_cast<uint8>(EContainerType::Bitmap): if (Container.Count == 0 || Container.Count > ChunkWidth)     return false; break;
+			case static_cast<uint8>(EContainerType::Run):    if (Container.Count == 0 || Container.Count > ChunkWidth / 2) return false; break;
+			default: return false;
+			}
+
+			Container.Type = static_cast<EContainerType>(Type);
+		}
+
+		for (FContainer& Container : Containers)
+		{
+			if (Container.Type == EContainerType::Bitmap)
+			{
+				if (static_cast<size_t>(End - Pointer) < BitmapWords * sizeof(uint64)) return false;
+
+				Container.Words.SetNum(BitmapWords);
+
+				size_t Count = 0;
+
+				for (uint64& Word : Container.Words)
+				{
+					Word = Load<uint64>(Pointer);
+
+					Count += Math::CountAllOne(Word);
+				}
+
+				if (Count != Container.Count) return false;
+			}
+			else
+			{
+				const size_t NumValues = Container.Type == EContainerType::Run ? Container.Count * 2 : Container.Count;
+
+				if (static_cast<size_t>(End - Pointer) / sizeof(uint16) < NumValues) return false;
+
+				Container.Values.SetNum(NumValues);
+
+				for (uint16& Value : Container.Values) Value = Load<uint16>(Pointer);
+
+				if (Container.Type == EContainerType::Array)
+				{
+					for (size_t Index = 1; Index < Container.Values.Num(); ++Index)
+					{
+						if (Container.Values[Index - 1] >= Container.Values[Index]) return false;
+					}
+				}
+				else
+				{
+					Container.Count = 0;
+
+					for (size_t Index = 0; Index != Container.Values.Num(); Index += 2)
+					{
+						const size_t First = Container.Values[Index];
+						const size_t Last  = First + Container.Values[Index + 1];
+
+						if (Last >= ChunkWidth) return false;
+
+						if (Index != 0 && First <= static_cast<size_t>(Container.Values[Index - 2] + Container.Values[Index - 1]) + 1) return false;
+
+						Container.Count += static_cast<uint32>(Last - First + 1);
+					}
+				}
+			}
+
+			if (Container.Type != EContainerType::Run) Normalize(Container);
+		}
+
+		if (Pointer != End) return false;
+
+		ResetGuard.Release();
+
+		return true;
+	}
+
+	/** Removes all values from the bitset. */
+	FORCEINLINE void Reset(bool bAllowShrinking = true) { Containers.Reset(bAllowShrinking); }
+
+	/** Overloads the Swap algorithm for FCompressedBitset. */
+	friend FORCEINLINE void Swap(FCompressedBitset& A, FCompressedBitset& B) { Swap(A.Containers, B.Containers); }
+
+private:
+
+	static constexpr size_t BitmapWords = ChunkWidth / 64;
+
+	static constexpr uint32 SerialCookie = 0x42524352; // "RCRB" in little-endian
+
+	static constexpr size_t HeaderBytes     = 8;
+	static constexpr size_t DescriptorBytes = 8;
+
+	enum class EContainerType : uint8
+	{
+		Array,
+		Bitmap,
+		Run,
+	};
+
+	enum class EOperation : uint8
+	{
+		And,
+		Or,
+		Xor,
+		AndNot,
+	};
+
+	struct FContainer
+	{
+		uint16         Key;
+		EContainerType Type;
+		uint32         Count;
+
+		/** The sorted values of the array container, or the pairs of the first value and the length minus one of the run container. */
+		TArray<uint16> Values;
+
+		/** The bits of the bitmap container. */
+		TArray<uint64> Words;
+
+		FORCEINLINE FContainer() : Key(0), Type(EContainerType::Array), Count(0) { }
+	};
+
+	TArray<FContainer> Containers;
+
+	FCompressedBitset& Apply(const FCompressedBitset& InValue, EOperation Operation)
+	{
+		const bool bKeepLHS = Operation != EOperation::And;
+		const bool bKeepRHS = Operation == EOperation::Or || Operation == EOperation::Xor;
+
+		TArray<FContainer> Result;
+
+		size_t IndexLHS = 0;
+		size_t IndexRHS = 0;
+
+		while (IndexLHS != Containers.Num() || IndexRHS != InValue.Containers.Num())
+		{
+			if (IndexRHS == InValue.Containers.Num() || (IndexLHS != Containers.Num() && Containers[IndexLHS].Key < InValue.Containers[IndexRHS].Key))
+			{
+				if (bKeepLHS) Result.PushBack(MoveTemp(Containers[IndexLHS]));
+
+				++IndexLHS;
+			}
+			else if (IndexLHS == Containers.Num() || Containers[IndexLHS].Key > InValue.Containers[IndexRHS].Key)
+			{
+				if (bKeepRHS) Result.PushBack(InValue.Containers[IndexRHS]);
+
+				++IndexRHS;
+			}
+			else
+			{
+				FContainer Container = Combine(Containers[IndexLHS], InValue.Containers[IndexRHS], Operation);
+
+				if (Container.Count != 0) Result.PushBack(MoveTemp(Container));
+
+				++IndexLHS;
+				++IndexRHS;
+			}
+		}
+
+		Containers = MoveTemp(Result);
+
+		return *this;
+	}
+
+	NODISCARD size_t FindContainer(uint16 Key) const
+	{
+		size_t Low  = 0;
+		size_t High = Containers.Num();
+
+		while (Low != High)
+		{
+			const size_t Middle = Low + (High - Low) / 2;
+
+			if (Containers[Middle].Key < Key) Low = Middle + 1;
+			else High = Middle;
+		}
+
+		return Low;
+	}
+
+	/** @return The smallest value not less than 'Value' in the containers starting from 'ContainerIndex', which is updated to the container of the result. */
+	NODISCARD size_t FindSetFrom(size_t& ContainerIndex, size_t Value) const
+	{
+		for (; ContainerIndex < Containers.Num(); ++ContainerIndex)
+		{
+			const FContainer& Container = Containers[ContainerIndex];
+
+			const size_t Base = static_cast<size_t>(Container.Key) << 16;
+
+			if (Base + ChunkWidth <= Value) continue;
+
+			const size_t Result = ContainerFindFrom(Container, Value > Base ? Value - Base : 0);
+
+			if (Result != INDEX_NONE) return Base + Result;
+		}
+
+		return INDEX_NONE;
+	}
+
+	NODISCARD static size_t LowerBound(const uint16* Values, size_t Num, uint16 Value)
+	{
+		size_t Low  = 0;
+		size_t High = Num;
+
+		while (Low != High)
+		{
+			const size_t Middle = Low + (High - Low) / 2;
+
+			if (Values[Middle] < Value) Low = Middle + 1;
+			else High = Middle;
+		}
+
+		return Low;
+	}
+
+	/** @return The index of the first run whose last value is not less than 'Value'. */
+	NODISCARD static size_t LowerBoundRun(const FContainer& Container, size_t Value)
+	{
+		size_t Low  = 0;
+		size_t High = Container.Values.Num() / 2;
+
+		while (Low != High)
+		{
+			const size_t Middle = Low + (High - Low) / 2;
+
+			if (static_cast<size_t>(Container.Values[Middle * 2] + Container.Values[Middle * 2 + 1]) < Value) Low = Middle + 1;
+			else High = Middle;
+		}
+
+		return Low;
+	}
+
+	/** @return The index of the first bit not less than 'Index' that is equal to 'bValue', or ChunkWidth if there is no such bit. */
+	NODISCARD static size_t FindInWords(const uint64* Words, size_t Index, bool bValue)
+	{
+		size_t WordIndex = Index / 64;
+
+		uint64 Word = (bValue ? Words[WordIndex] : ~Words[WordIndex]) & (~0ull << Index % 64);
+
+		while (true)
+		{
+			if (Word != 0) return WordIndex * 64 + Math::CountRightZero(Word);
+
+			if (++WordIndex == BitmapWords) return ChunkWidth;
+
+			Word = bValue ? Words[WordIndex] : ~Words[WordIndex];
+		}
+	}
+
+	/** Sets the bits in the range ['First', 'Last'] to true. */
+	static void SetWordsRange(uint64* Words, size_t First, size_t Last)
+	{
+		for (size_t WordIndex = First / 64; WordIndex <= Last / 64; ++WordIndex)
+		{
+			uint64 Mask = ~0ull;
+
+			if (WordIndex == First / 64) Mask &= ~0ull << First % 64;
+			if (WordIndex == Last  / 64) Mask &= ~0ull >> (63 - Last % 64);
+
+			Words[WordIndex] |= Mask;
+		}
+	}
+
+	NODISCARD static bool ContainerContains(const FContainer& Container, uint16 Value)
+	{
+		switch (Container.Type)
+		{
+		case EContainerType::Array:
+			{
+				const size_t Index = LowerBound(Container.Values.GetData(), Container.Values.Num(), Value);
+
+				return Index != Container.Values.Num() && Container.Values[Index] == Value;
+			}
+		case EContainerType::Bitmap: return (Container.Words[Value / 64] >> Value % 64 & 1) != 0;
+		case EContainerType::Run:
+			{
+				const size_t Index = LowerBoundRun(Container, Value);
+
+				return Index != Container.Values.Num() / 2 && Container.Values[Index * 2] <= Value;
+			}
+		default: check_no_entry(); return false;
+		}
+	}
+
+	/** @return The smallest value not less than 'Value' in the container, or INDEX_NONE if there is no such value. */
+	NODISCARD static size_t ContainerFindFrom(const FContainer& Container, size_t Value)
+	{
+		switch (Container.Type)
+		{
+		case EContainerType::Array:
+			{
+				const size_t Index = LowerBound(Container.Values.GetData(), Container.Values.Num(), static_cast<uint16>(Value));
+
+				return Index != Container.Values.Num() ? Container.Values[Index] : INDEX_NONE;
+			}
+		case EContainerType::Bitmap:
+			{
+				const size_t Index = FindInWords(Container.Words.GetData(), Value, true);
+
+				return Index != ChunkWidth ? Index : INDEX_NONE;
+			}
+		case EContainerType::Run:
+			{
+				const size_t Index = LowerBoundRun(Container, Value);
+
+				if (Index == Container.Values.Num() / 2) return INDEX_NONE;
+
+				return Container.Values[Index * 2] > Value ? Container.Values[Index * 2] : Value;
+			}
+		default: check_no_entry(); return INDEX_NONE;
+		}
+	}
+
+	/** @return The largest value in the non-empty container. */
+	NODISCARD static size_t ContainerLast(const FContainer& Container)
+	{
+		if (Container.Type == EContainerType::Array) return Container.Values.Back();
+
+		if (Container.Type == EContainerType::Run) return Container.Values[Container.Values.Num() - 2] + Container.Values.Back();
+
+		size_t WordIndex = BitmapWords - 1;
+
+		while (Container.Words[WordIndex] == 0) --WordIndex;
+
+		return WordIndex * 64 + 63 - Math::CountLeftZero(Container.Words[WordIndex]);
+	}
+
+	NODISCARD static size_t ContainerNumRuns(const FContainer& Container)
+	{
+		size_t Result = 0;
+
+		switch (Container.Type)
+		{
+		case EContainerType::Array:
+			{
+				for (size_t Index = 0; Index != Container.Values.Num(); ++Index)
+				{
+					if (Index == 0 || Container.Values[Index] != Container.Values[Index - 1] + 1) ++Result;
+				}
+
+				break;
+			}
+		case EContainerType::Bitmap:
+			{
+				uint64 Carry = 0;
+
+				for (uint64 Word : Container.Words)
+				{
+					Result += Math::CountAllOne(Word & ~(Word << 1 | Carry));
+
+					Carry = Word >> 63;
+				}
+
+				break;
+			}
+		case EContainerType::Run: Result = Container.Values.Num() / 2; break;
+		default: check_no_entry();
+		}
+
+		return Result;
+	}
+
+	static void ToBitmap(FContainer& Container)
+	{
+		check(Container.Type != EContainerType::Bitmap);
+
+		Container.Words.SetNum(BitmapWords);
+
+		Memory::Memzero(Container.Words.GetData(), BitmapWords * sizeof(uint64));
+
+		if (Container.Type == EContainerType::Array)
+		{
+			for (uint16 Value : Container.Values) Container.Words[Value / 64] |= 1ull << Value % 64;
+		}
+		else
+		{
+			for (size_t Index = 0; Index != Container.Values.Num(); Index += 2)
+			{
+				SetWordsRange(Container.Words.GetData(), Container.Values[Index], Container.Values[Index] + Container.Values[Index + 1]);
+			}
+		}
+
+		Container.Values.Reset();
+
+		Container.Type = EContainerType::Bitmap;
+	}
+
+	static void ToArray(FContainer& Container)
+	{
+		check(Container.Type != EContainerType::Array && Container.Count <= ArrayMaxNum);
+
+		TArray<uint16> Values;
+
+		Values.Reserve(Container.Count);
+
+		if (Container.Type == EContainerType::Bitmap)
+		{
+			for (size_t WordIndex = 0; WordIndex != BitmapWords; ++WordIndex)
+			{
+				for (uint64 Word = Container.Words[WordIndex]; Word != 0; Word &= Word - 1)
+				{
+					Values.PushBack(static_cast<uint16>(WordIndex * 64 + Math::CountRightZero(Word)));
+				}
+			}
+		}
+		else
+		{
+			for (size_t Index = 0; Index != Container.Values.Num(); Index += 2)
+			{
+				for (size_t Value = Container.Values[Index]; Value <= static_cast<size_t>(Container.Values[Index] + Container.Values[Index + 1]); ++Value)
+				{
+					Values.PushBack(static_cast<uint16>(Value));
+				}
+			}
+		}
+
+		Container.Values = MoveTemp(Values);
+
+		Container.Words.Reset();
+
+		Container.Type = EContainerType::Array;
+	}
+
+	static void ToRun(FContainer& Container, size_t NumRuns)
+	{
+		if (Container.Type == EContainerType::Run) return;
+
+		TArray<uint16> Runs;
+
+		Runs.Reserve(NumRuns * 2);
+
+		if (Container.Type == EContainerType::Array)
+		{
+			for (size_t Index = 0; Index != Container.Values.Num(); ++Index)
+			{
+				if (Index != 0 && Container.Values[Index] == Container.Values[Index - 1] + 1) ++Runs.Back();
+
+				else
+				{
+					Runs.PushBack(Container.Values[Index]);
+					Runs.PushBack(0);
+				}
+			}
+		}
+		else
+		{
+			for (size_t First = FindInWords(Container.Words.GetData(), 0, true); First != ChunkWidth; )
+			{
+				const size_t Last = First + 1 != ChunkWidth ? FindInWords(Container.Words.GetData(), First + 1, false) : ChunkWidth;
+
+				Runs.PushBack(static_cast<uint16>(First));
+				Runs.PushBack(static_cast<uint16>(Last - First - 1));
+
+				First = Last != ChunkWidth ? FindInWords(Container.Words.GetData(), Last, true) : ChunkWidth;
+			}
+		}
+
+		check(Runs.Num() == NumRuns * 2);
+
+		Container.Values = MoveTemp(Runs);
+
+		Container.Words.Reset();
+
+		Container.Type = EContainerType::Run;
+	}
+
+	/** Converts the run container to the array or bitmap container. */
+	static void Expand(FContainer& Container)
+	{
+		if (Container.Type != EContainerType::Run) return;
+
+		if (Container.Count <= ArrayMaxNum) ToArray(Container);
+
+		else ToBitmap(Container);
+	}
+
+	/** Converts the array or bitmap container to the other one if it has the inappropriate number of values. */
+	static void Normalize(FContainer& Container)
+	{
+		if (Container.Type == EContainerType::Array  && Container.Count >  ArrayMaxNum) ToBitmap(Container);
+		if (Container.Type == EContainerType::Bitmap && Container.Count <= ArrayMaxNum) ToArray(Container);
+	}
+
+	NODISCARD static const FContainer& AsExpanded(const FContainer& Container, FContainer& Scratch)
+	{
+		if (Container.Type != EContainerType::Run) return Container;
+
+		Scratch = Container;
+
+		Expand(Scratch);
+
+		return Scratch;
+	}
+
+	NODISCARD static const FContainer& AsBitmap(const FContainer& Container, FContainer& Scratch)
+	{
+		if (Container.Type == EContainerType::Bitmap) return Container;
+
+		Scratch = Container;
+
+		ToBitmap(Scratch);
+
+		return Scratch;
+	}
+
+	NODISCARD static FContainer Combine(const FContainer& InLHS, const FContainer& InRHS, EOperation Operation)
+	{
+		FContainer ScratchLHS;
+		FContainer ScratchRHS;
+
+		const FContainer& LHS = AsExpanded(InLHS, ScratchLHS);
+		const FContainer& RHS = AsExpanded(InRHS, ScratchRHS);
+
+		FContainer Result;
+
+		Result.Key = LHS.Key;
+
+		if (LHS.Type == EContainerType::Array && RHS.Type == EContainerType::Array)
+		{
+			const uint16* DataLHS = LHS.Values.GetData();
+			const uint16* DataRHS = RHS.Values.GetData();
+
+			const size_t NumLHS = LHS.Values.Num();
+			const size_t NumRHS = RHS.Values.Num();
+
+			size_t IndexLHS = 0;
+			size_t IndexRHS = 0;
+
+			switch (Operation)
+			{
+			case EOperation::And:
+				{
+					Result.Values.Reserve(NumLHS < NumRHS ? NumLHS : NumRHS);
+
+					// Gallop through the larger array by binary search when the sizes are very different.
+					if (NumLHS * 64 < NumRHS || NumRHS * 64 < NumLHS)
+					{
+						const bool bSwap = NumLHS > NumRHS;
+
+						const uint16* Small = bSwap ? DataRHS : DataLHS;
+						const uint16* Large = bSwap ? DataLHS : DataRHS;
+
+						const size_t NumSmall = bSwap ? NumRHS : NumLHS;
+						const size_t NumLarge = bSwap ? NumLHS : NumRHS;
+
+						size_t Offset = 0;
+
+						for (size_t Index = 0; Index != NumSmall && Offset != NumLarge; ++Index)
+						{
+							Offset += LowerBound(Large + Offset, NumLarge - Offset, Small[Index]);
+
+							if (Offset != NumLarge && Large[Offset] == Small[Index]) Result.Values.PushBack(Small[Index]);
+						}
+
+						break;
+					}
+
+					while (IndexLHS != NumLHS && IndexRHS != NumRHS)
+					{
+						if      (DataLHS[IndexLHS] < DataRHS[IndexRHS]) ++IndexLHS;
+						else if (DataLHS[IndexLHS] > DataRHS[IndexRHS]) ++IndexRHS;
+						else
+						{
+							Result.Values.PushBack(DataLHS[IndexLHS]);
+
+							++IndexLHS;
+							++IndexRHS;
+						}
+					}
+
+					break;
+				}
+			case EOperation::Or:
+			case EOperation::Xor:
+				{
+					Result.Values.Reserve(NumLHS + NumRHS);
+
+					while (IndexLHS != NumLHS && IndexRHS != NumRHS)
+					{
+						if      (DataLHS[IndexLHS] < DataRHS[IndexRHS]) Result.Values.PushBack(DataLHS[IndexLHS++]);
+						else if (DataLHS[IndexLHS] > DataRHS[IndexRHS]) Result.Values.PushBack(DataRHS[IndexRHS++]);
+						else
+						{
+							if (Operation == EOperation::Or) Result.Values.PushBack(DataLHS[IndexLHS]);
+
+							++IndexLHS;
+							++IndexRHS;
+						}
+					}
+
+					while (IndexLHS != NumLHS) Result.Values.PushBack(DataLHS[IndexLHS++]);
+					while (IndexRHS != NumRHS) Result.Values.PushBack(DataRHS[IndexRHS++]);
+
+					break;
+				}
+			case EOperation::AndNot:
+				{
+					Result.Values.Reserve(NumLHS);
+
+					while (IndexLHS != NumLHS)
+					{
+						if (IndexRHS == NumRHS || DataLHS[IndexLHS] < DataRHS[IndexRHS]) Result.Values.PushBack(DataLHS[IndexLHS++]);
+						else if (DataLHS[IndexLHS] > DataRHS[IndexRHS]) ++IndexRHS;
+						else
+						{
+							++IndexLHS;
+							++IndexRHS;
+						}
+					}
+
+					break;
+				}
+			default: check_no_entry();
+			}
+
+			Result.Count = static_cast<uint32>(Result.Values.Num());
+		}
+		else if ((Operation == EOperation::And && (LHS.Type == EContainerType::Array || RHS.Type == EContainerType::Array)) || (Operation == EOperation::AndNot && LHS.Type == EContainerType::Array))
+		{
+			const FContainer& Array  = LHS.Type == EContainerType::Array ? LHS : RHS;
+			const FContainer& Bitmap = LHS.Type == EContainerType::Array ? RHS : LHS;
+
+			const bool bExpected = Operation == EOperation::And;
+
+			Result.Values.Reserve(Array.Values.Num());
+
+			for (uint16 Value : Array.Values)
+			{
+				if (ContainerContains(Bitmap, Value) == bExpected) Result.Values.PushBack(Value);
+			}
+
+			Result.Count = static_cast<uint32>(Result.Values.Num());
+		}
+		else
+		{
+			FContainer ScratchBitmap;
+
+			Result.Type  = EContainerType::Bitmap;
+			Result.Words = AsBitmap(LHS, ScratchBitmap).Words;
+
+			if (RHS.Type == EContainerType::Array)
+			{
+				for (uint16 Value : RHS.Values)
+				{
+					const uint64 Mask = 1ull << Value % 64;
+
+					switch (Operation)
+					{
+					case EOperation::Or:     Result.Words[Value / 64] |=  Mask; break;
+					case EOperation::Xor:    Result.Words[Value / 64] ^=  Mask; break;
+					case EOperation::AndNot: Result.Words[Value / 64] &= ~Mask; break;
+					default: check_no_entry();
+					}
+				}
+			}
+			else switch (Operation)
+			{
+			case EOperation::And:    Memory::BitwiseAnd   (Result.Words.GetData(), RHS.Words.GetData(), BitmapWords); break;
+			case EOperation::Or:     Memory::BitwiseOr    (Result.Words.GetData(), RHS.Words.GetData(), BitmapWords); break;
+			case EOperation::Xor:    Memory::BitwiseXor   (Result.Words.GetData(), RHS.Words.GetData(), BitmapWords); break;
+			case EOperation::AndNot: Memory::BitwiseAndNot(Result.Words.GetData(), RHS.Words.GetData(), BitmapWords); break;
+			default: check_no_entry();
+			}
+
+			for (uint64 Word : Result.Words) Result.Count += Math::CountAllOne(Word);
+		}
+
+		if (Result.Count != 0) Normalize(Result);
+
+		return Result;
+	}
+
+	NODISCARD static size_t ContainerAndCount(const FContainer& InLHS, const FContainer& InRHS)
+	{
+		FContainer ScratchLHS;
+		FContainer ScratchRHS;
+
+		const FContainer& LHS = AsExpanded(InLHS, ScratchLHS);
+		const FContainer& RHS = AsExpanded(InRHS, ScratchRHS);
+
+		if (LHS.Type == EContainerType::Bitmap && RHS.Type == EContainerType::Bitmap)
+		{
+			return Memory::BitwiseAndCount(LHS.Words.GetData(), RHS.Words.GetData(), BitmapWords);
+		}
+
+		if (LHS.Type == EContainerType::Array && RHS.Type == EContainerType::Array)
+		{
+			size_t Result = 0;
+
+			size_t IndexLHS = 0;
+			size_t IndexRHS = 0;
+
+			while (IndexLHS != LHS.Values.Num() && IndexRHS != RHS.Values.Num())
+			{
+				if      (LHS.Values[IndexLHS] < RHS.Values[IndexRHS]) ++IndexLHS;
+				else if (LHS.Values[IndexLHS] > RHS.Values[IndexRHS]) ++IndexRHS;
+				else
+				{
+					++Result;
+					++IndexLHS;
+					++IndexRHS;
+				}
+			}
+
+			return Result;
+		}
+
+		const FContainer& Array  = LHS.Type == EContainerType::Array ? LHS : RHS;
+		const FContainer& Bitmap = LHS.Type == EContainerType::Array ? RHS : LHS;
+
+		size_t Result = 0;
+
+		for (uint16 Value : Array.Values) Result += ContainerContains(Bitmap, Value);
+
+		return Result;
+	}
+
+	template <CUnsignedIntegral T>
+	static FORCEINLINE void Store(uint8*& Pointer, T Value)
+	{
+		for (size_t Index = 0; Index != sizeof(T); ++Index) *Pointer++ = static_cast<uint8>(static_cast<uint64>(Value) >> Index * 8);
+	}
+
+	template <CUnsignedIntegral T>
+	NODISCARD static FORCEINLINE T Load(const uint8*& Pointer)
+	{
+		uint64 Result = 0;
+
+		for (size_t Index = 0; Index != sizeof(T); ++Index) Result |= static_cast<uint64>(*Pointer++) << Index * 8;
+
+		return static_cast<T>(Result);
+	}
+
+public:
+
+	/** The forward iterator over the values in the bitset in ascending order. */
+	class FSetBitIterator final
+	{
+	public:
+
+		using FElementType = size_t;
+
+		FORCEINLINE FSetBitIterator() = default;
+
+		FORCEINLINE FSetBitIterator(const FSetBitIterator&)            = default;
+		FORCEINLINE FSetBitIterator(FSetBitIterator&&)                 = default;
+		FORCEINLINE FSetBitIterator& operator=(const FSetBitIterator&) = default;
+		FORCEINLINE FSetBitIterator& operator=(FSetBitIterator&&)      = default;
+
+		NODISCARD friend FORCEINLINE bool operator==(const FSetBitIterator& LHS, const FSetBitIterator& RHS) { check(LHS.Owner == RHS.Owner); return LHS.Value == RHS.Value; }
+
+		NODISCARD FORCEINLINE bool operator==(FDefaultSentinel) const& { return Value == INDEX_NONE; }
+
+		NODISCARD FORCEINLINE size_t operator*() const { checkf(Value != INDEX_NONE, TEXT("Read access violation. Please check IsValidIterator().")); return Value; }
+
+		FORCEINLINE FSetBitIterator& operator++() { Value = Value < TNumericLimits<uint32>::Max() ? Owner->FindSetFrom(ContainerIndex, Value + 1) : INDEX_NONE; return *this; }
+
+		FORCEINLINE FSetBitIterator operator++(int) { FSetBitIterator Temp = *this; ++*this; return Temp; }
+
+	private:
+
+		const FCompressedBitset* Owner          = nullptr;
+		size_t                   ContainerIndex = 0;
+		size_t                   Value          = INDEX_NONE;
+
+		FORCEINLINE FSetBitIterator(const FCompressedBitset* InContainer, size_t InContainerIndex, size_t InValue)
+			: Owner(InContainer), ContainerIndex(InContainerIndex), Value(InValue)
+		{ }
+
+		friend FCompressedBitset;
+
+	};
+
+};
+
+static_assert(CForwardIterator<FCompressedBitset::FSetBitIterator>);
+static_assert(CSentinelFor<FDefaultSentinel, FCompressedBitset::FSetBitIterator>);
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
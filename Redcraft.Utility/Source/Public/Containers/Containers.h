@@ -6,4 +6,6 @@
 #include "Containers/ArrayView.h"
 #include "Containers/Bitset.h"
 #include "Containers/StaticBitset.h"
+#include "Containers/RankSelectIndex.h"
+#include "Containers/CompressedBitset.h"
 #include "Containers/List.h"
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Containers/Array.h"
+#include "Numerics/Bit.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+/**
+ * The auxiliary index of a bitset that answers rank queries in constant time and select queries in logarithmic time.
+ * The index stores the number of set bits before every 512-bit superblock, which costs 12.5% extra memory for 64-bit blocks.
+ * The index refers to the bitset rather than copying it, so it must be rebuilt after the bitset is modified.
+ */
+template <typename InBitsetType> requires (CUnsignedIntegral<typename InBitsetType::FBlockType>)
+class TRankSelectIndex
+{
+public:
+
+	using FBitsetType = InBitsetType;
+	using FBlockType  = typename FBitsetType::FBlockType;
+
+	static constexpr size_t BlockWidth = FBitsetType::BlockWidth;
+
+	static constexpr size_t SuperblockWidth  = BlockWidth > 512 ? BlockWidth : 512;
+	static constexpr size_t SuperblockBlocks = SuperblockWidth / BlockWidth;
+
+	/** Default constructor. Constructs an index that refers to no bitset. */
+	FORCEINLINE TRankSelectIndex() = default;
+
+	/** Constructs the index of the given bitset. */
+	FORCEINLINE explicit TRankSelectIndex(const FBitsetType& InBitset) { Build(InBitset); }
+
+	/** Rebuilds the index of the given bitset. */
+	void Build(const FBitsetType& InBitset)
+	{
+		Bitset = &InBitset;
+
+		const size_t NumSuperblocks = (Bitset->NumBlocks() + SuperblockBlocks - 1) / SuperblockBlocks;
+
+		Superblocks.SetNum(NumSuperblocks + 1);
+
+		size_t Result = 0;
+
+		for (size_t Index = 0; Index != NumSuperblocks; ++Index)
+		{
+			Superblocks[Index] = Result;
+
+			const size_t First = Index * SuperblockBlocks;
+			const size_t Last  = First + SuperblockBlocks < Bitset->NumBlocks() ? First + SuperblockBlocks : Bitset->NumBlocks();
+
+			for (size_t BlockIndex = First; BlockIndex != Last; ++BlockIndex)
+			{
+				Result += Math::CountAllOne(GetBlock(BlockIndex));
+			}
+		}
+
+		Superblocks[NumSuperblocks] = Result;
+	}
+
+	/** @return The number of bits that are set to true in the range [0, 'Index'). */
+	NODISCARD size_t Rank(size_t Index) const
+	{
+		checkf(Bitset != nullptr && Index <= Bitset->Num(), TEXT("Read access violation. Please check Num()."));
+
+		const size_t Superblock = Index / SuperblockWidth;
+		const size_t BlockIndex = Index / BlockWidth;
+
+		size_t Result = Superblocks[Superblock];
+
+		for (size_t Iter = Superblock * SuperblockBlocks; Iter != BlockIndex; ++Iter)
+		{
+			Result += Math::CountAllOne(GetBlock(Iter));
+		}
+
+		if (Index % BlockWidth != 0)
+		{
+			const FBlockType Bitmask = static_cast<FBlockType>((1ull << Index % BlockWidth) - 1);
+
+			Result += Math::CountAllOne(static_cast<FBlockType>(GetBlock(BlockIndex) & Bitmask));
+		}
+
+		return Result;
+	}
+
+	/** @return The index of the 'Nth' (zero-based) bit that is set to true, or INDEX_NONE if there is no such bit. */
+	NODISCARD size_t Select(size_t Nth) const
+	{
+		checkf(Bitset != nullptr, TEXT("The index is not built. Please check Build()."));
+
+		if (Nth >= Count()) return INDEX_NONE;
+
+		size_t Low  = 0;
+		size_t High = Superblocks.Num() - 1;
+
+		while (High - Low > 1)
+		{
+			const size_t Middle = Low + (High - Low) / 2;
+
+			if (Superblocks[Middle] <= Nth) Low = Middle;
+			else High = Middle;
+		}
+
+		size_t Remaining = Nth - Superblocks[Low];
+
+		for (size_t BlockIndex = Low * SuperblockBlocks; ; ++BlockIndex)
+		{
+			FBlockType Block = GetBlock(BlockIndex);
+
+			const size_t BlockCount = Math::CountAllOne(Block);
+
+			if (Remaining < BlockCount)
+			{
+				for (; Remaining != 0; --Remaining) Block &= Block - 1;
+
+				return BlockIndex * BlockWidth + Math::CountRightZero(Block);
+			}
+
+			Remaining -= BlockCount;
+		}
+	}
+
+	/** @return The number of bits that are set to true in the whole bitset. */
+	NODISCARD FORCEINLINE size_t Count() const { return Superblocks.IsEmpty() ? 0 : Superblocks[Superblocks.Num() - 1]; }
+
+	/** @return The bitset referred to by the index. */
+	NODISCARD FORCEINLINE const FBitsetType& GetBitset() const { checkf(Bitset != nullptr, TEXT("The index is not built. Please check Build().")); return *Bitset; }
+
+private:
+
+	const FBitsetType* Bitset = nullptr;
+
+	TArray<size_t> Superblocks;
+
+	NODISCARD FORCEINLINE FBlockType GetBlock(size_t BlockIndex) const
+	{
+		const FBlockType Block = Bitset->GetData()[BlockIndex];
+
+		if (BlockIndex != Bitset->NumBlocks() - 1 || Bitset->Num() % BlockWidth == 0) return Block;
+
+		return static_cast<FBlockType>(Block & ((1ull << Bitset->Num() % BlockWidth) - 1));
+	}
+
+};
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
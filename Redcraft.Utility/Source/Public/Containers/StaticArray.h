@@ -104,14 +104,7 @@ public:
 	/** Overloads the GetTypeHash algorithm for TStaticArray. */
 	NODISCARD friend FORCEINLINE constexpr size_t GetTypeHash(const TStaticArray& A) requires (CHashable<FElementType>)
 	{
-		size_t Result = 0;
-
-		for (FConstIterator Iter = A.Begin(); Iter != A.End(); ++Iter)
-		{
-			Result = HashCombine(Result, GetTypeHash(*Iter));
-		}
-
-		return Result;
+		return HashRange(A.GetData(), A.Num());
 	}
 
 	/** Overloads the Swap algorithm for TStaticArray. */
@@ -5,9 +5,13 @@
 #include "Templates/Utility.h"
 #include "Templates/TypeHash.h"
 #include "Templates/Noncopyable.h"
+#include "Memory/BitwiseOperator.h"
 #include "Iterators/Utility.h"
 #include "Iterators/BasicIterator.h"
 #include "Iterators/ReverseIterator.h"
+#include "Iterators/Sentinel.h"
+#include "Ranges/View.h"
+#include "Numerics/Bit.h"
 #include "Miscellaneous/Compare.h"
 #include "Miscellaneous/AssertionMacros.h"
 
@@ -41,6 +45,8 @@ public:
 	class      FReference;
 	using FConstReference = bool;
 
+	class FSetBitIterator;
+
 	using      FIterator = TIteratorImpl<false>;
 	using FConstIterator = TIteratorImpl<true >;
 
@@ -136,6 +142,13 @@ public:
 
 		if (&InValue == this) UNLIKELY return *this;
 
+		if (!IsConstantEvaluated())
+		{
+			Memory::BitwiseAnd(Impl, InValue.Impl, NumBlocks());
+
+			return *this;
+		}
+
 		for (size_t Index = 0; Index != NumBlocks(); ++Index)
 		{
 			Impl[Index] &= InValue.Impl[Index];
@@ -151,6 +164,13 @@ public:
 
 		if (&InValue == this) UNLIKELY return *this;
 
+		if (!IsConstantEvaluated())
+		{
+			Memory::BitwiseOr(Impl, InValue.Impl, NumBlocks());
+
+			return *this;
+		}
+
 		for (size_t Index = 0; Index != NumBlocks(); ++Index)
 		{
 			Impl[Index] |= InValue.Impl[Index];
@@ -166,6 +186,13 @@ public:
 
 		if (&InValue == this) UNLIKELY return Set(false);
 
+		if (!IsConstantEvaluated())
+		{
+			Memory::BitwiseXor(Impl, InValue.Impl, NumBlocks());
+
+			return *this;
+		}
+
 		for (size_t Index = 0; Index != NumBlocks(); ++Index)
 		{
 			Impl[Index] ^= InValue.Impl[Index];
@@ -174,6 +201,49 @@ public:
 		return *this;
 	}
 
+	/** Sets the bits to the result of binary AND on corresponding pairs of bits of *this and the complement of other, without materializing the complement. */
+	constexpr TStaticBitset& AndNot(const TStaticBitset& InValue)
+	{
+		if constexpr (N == 0) return *this;
+
+		if (&InValue == this) UNLIKELY return Set(false);
+
+		if (!IsConstantEvaluated())
+		{
+			Memory::BitwiseAndNot(Impl, InValue.Impl, NumBlocks());
+
+			return *this;
+		}
+
+		for (size_t Index = 0; Index != NumBlocks(); ++Index)
+		{
+			Impl[Index] &= ~InValue.Impl[Index];
+		}
+
+		return *this;
+	}
+
+	/** @return The number of bits that are set to true in both *this and other, without materializing the result of binary AND. */
+	NODISCARD constexpr size_t AndCount(const TStaticBitset& InValue) const
+	{
+		if constexpr (N == 0) return 0;
+
+		size_t Result = 0;
+
+		if (!IsConstantEvaluated())
+		{
+			Result = Memory::BitwiseAndCount(Impl, InValue.Impl, NumBlocks() - 1);
+		}
+		else for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
+		{
+			Result += Math::CountAllOne(static_cast<FBlockType>(Impl[Index] & InValue.Impl[Index]));
+		}
+
+		const FBlockType LastBlockBitmask = Num() % BlockWidth != 0 ? (1ull << Num() % BlockWidth) - 1 : -1;
+
+		return Result + Math::CountAllOne(static_cast<FBlockType>(Impl[NumBlocks() - 1] & InValue.Impl[NumBlocks() - 1] & LastBlockBitmask));
+	}
+
 	NODISCARD friend FORCEINLINE constexpr TStaticBitset operator&(const TStaticBitset& LHS, const TStaticBitset& RHS) { return TStaticBitset(LHS) &= RHS; }
 	NODISCARD friend FORCEINLINE constexpr TStaticBitset operator|(const TStaticBitset& LHS, const TStaticBitset& RHS) { return TStaticBitset(LHS) |= RHS; }
 	NODISCARD friend FORCEINLINE constexpr TStaticBitset operator^(const TStaticBitset& LHS, const TStaticBitset& RHS) { return TStaticBitset(LHS) ^= RHS; }
@@ -196,6 +266,13 @@ public:
 	{
 		if constexpr (N == 0) return *this;
 
+		if (!IsConstantEvaluated())
+		{
+			Memory::BitwiseShiftLeft(Impl, NumBlocks(), Offset);
+
+			return *this;
+		}
+
 		const size_t Blockshift = Offset / BlockWidth;
 		const size_t Bitshift   = Offset % BlockWidth;
 
@@ -233,6 +310,13 @@ public:
 			Impl[NumBlocks() - 1] &= (1ull << Num() % BlockWidth) - 1;
 		}
 
+		if (!IsConstantEvaluated())
+		{
+			Memory::BitwiseShiftRight(Impl, NumBlocks(), Offset);
+
+			return *this;
+		}
+
 		if (Blockshift != 0)
 		{
 			for (size_t Index = 0; Index != NumBlocks(); ++Index)
@@ -262,7 +346,11 @@ public:
 	{
 		if constexpr (N == 0) return true;
 
-		for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
+		if (!IsConstantEvaluated())
+		{
+			if (!Memory::IsAllOne(Impl, NumBlocks() - 1)) return false;
+		}
+		else for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
 		{
 			if (Impl[Index] != -1) return false;
 		}
@@ -277,7 +365,11 @@ public:
 	{
 		if constexpr (N == 0) return false;
 
-		for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
+		if (!IsConstantEvaluated())
+		{
+			if (!Memory::IsAllZero(Impl, NumBlocks() - 1)) return true;
+		}
+		else for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
 		{
 			if (Impl[Index] != 0) return true;
 		}
@@ -297,57 +389,27 @@ public:
 
 		size_t Result = 0;
 
-		constexpr auto BlockCount = [](FBlockType Block) constexpr
-		{
-			static_assert(sizeof(FBlockType) <= sizeof(uint64), "The block width of TStaticBitset is unexpected");
-
-			if constexpr (sizeof(FBlockType) == sizeof(uint8))
-			{
-				Block = (Block & 0x55ull) + ((Block >> 1) & 0x55ull);
-				Block = (Block & 0x33ull) + ((Block >> 2) & 0x33ull);
-				Block = (Block & 0x0Full) + ((Block >> 4) & 0x0Full);
-			}
-			else if constexpr (sizeof(FBlockType) == sizeof(uint16))
-			{
-				Block = (Block & 0x5555ull) + ((Block >>  1) & 0x5555ull);
-				Block = (Block & 0x3333ull) + ((Block >>  2) & 0x3333ull);
-				Block = (Block & 0x0F0Full) + ((Block >>  4) & 0x0F0Full);
-				Block = (Block & 0x00FFull) + ((Block >>  8) & 0x00FFull);
-			}
-			else if constexpr (sizeof(FBlockType) == sizeof(uint32))
-			{
-				Block = (Block & 0x55555555ull) + ((Block >>  1) & 0x55555555ull);
-				Block = (Block & 0x33333333ull) + ((Block >>  2) & 0x33333333ull);
-				Block = (Block & 0x0F0F0F0Full) + ((Block >>  4) & 0x0F0F0F0Full);
-				Block = (Block & 0x00FF00FFull) + ((Block >>  8) & 0x00FF00FFull);
-				Block = (Block & 0x0000FFFFull) + ((Block >> 16) & 0x0000FFFFull);
-			}
-			else if constexpr (sizeof(FBlockType) == sizeof(uint64))
-			{
-				Block = (Block & 0x5555555555555555ull) + ((Block >>  1) & 0x5555555555555555ull);
-				Block = (Block & 0x3333333333333333ull) + ((Block >>  2) & 0x3333333333333333ull);
-				Block = (Block & 0x0F0F0F0F0F0F0F0Full) + ((Block >>  4) & 0x0F0F0F0F0F0F0F0Full);
-				Block = (Block & 0x00FF00FF00FF00FFull) + ((Block >>  8) & 0x00FF00FF00FF00FFull);
-				Block = (Block & 0x0000FFFF0000FFFFull) + ((Block >> 16) & 0x0000FFFF0000FFFFull);
-				Block = (Block & 0x00000000FFFFFFFFull) + ((Block >> 32) & 0x00000000FFFFFFFFull);
-			}
-			else check_no_entry();
-
-			return Block;
-		};
-
 		for (size_t Index = 0; Index != NumBlocks() - 1; ++Index)
 		{
-			Result += BlockCount(Impl[Index]);
+			Result += Math::CountAllOne(Impl[Index]);
 		}
 
 		const FBlockType LastBlockBitmask = Num() % BlockWidth != 0 ? (1ull << Num() % BlockWidth) - 1 : -1;
 
-		Result += BlockCount(Impl[NumBlocks() - 1] & LastBlockBitmask);
+		Result += Math::CountAllOne(static_cast<FBlockType>(Impl[NumBlocks() - 1] & LastBlockBitmask));
 
 		return Result;
 	}
 
+	/** @return The index of the first bit that is set to true, or INDEX_NONE if there is no such bit. */
+	NODISCARD FORCEINLINE constexpr size_t FindFirstSet() const { return FindSetFrom(0); }
+
+	/** @return The index of the first bit after 'Index' that is set to true, or INDEX_NONE if there is no such bit. */
+	NODISCARD FORCEINLINE constexpr size_t FindNextSet(size_t Index) const { return Index < Num() ? FindSetFrom(Index + 1) : INDEX_NONE; }
+
+	/** @return The view of the indices of the bits that are set to true, in ascending order. */
+	NODISCARD FORCEINLINE constexpr auto SetBits() const { return Ranges::View(FSetBitIterator(this, FindFirstSet()), DefaultSentinel); }
+
 	/** Sets all bits to true. */
 	constexpr TStaticBitset& Set(bool InValue = true)
 	{
@@ -385,13 +447,13 @@ public:
 		{
 			for (size_t Index = 64 / BlockWidth; Index < NumBlocks() - 1; ++Index)
 			{
-				checkf(Impl[Index] != 0, TEXT("The bitset can not be represented in uint64. Please check Num()."));
+				checkf(Impl[Index] == 0, TEXT("The bitset can not be represented in uint64. Please check Num()."));
 			}
 
 			const FBlockType LastBlockBitmask = Num() % BlockWidth != 0 ? (1ull << Num() % BlockWidth) - 1 : -1;
 			const FBlockType LastBlock = Impl[NumBlocks() - 1] & LastBlockBitmask;
 
-			checkf(LastBlock != 0, TEXT("The bitset can not be represented in uint64. Please check Num()."));
+			checkf(LastBlock == 0, TEXT("The bitset can not be represented in uint64. Please check Num()."));
 		}
 
 		uint64 Result = 0;
@@ -496,6 +558,28 @@ private:
 
 	FBlockType Impl[N != 0 ? (N + BlockWidth - 1) / BlockWidth : 1];
 
+	NODISCARD constexpr size_t FindSetFrom(size_t Index) const
+	{
+		if (Index >= Num()) return INDEX_NONE;
+
+		const FBlockType LastBlockBitmask = Num() % BlockWidth != 0 ? (1ull << Num() % BlockWidth) - 1 : -1;
+
+		size_t BlockIndex = Index / BlockWidth;
+
+		FBlockType Block = Impl[BlockIndex] & static_cast<FBlockType>(static_cast<FBlockType>(-1) << Index % BlockWidth);
+
+		while (true)
+		{
+			if (BlockIndex == NumBlocks() - 1) Block &= LastBlockBitmask;
+
+			if (Block != 0) return BlockIndex * BlockWidth + Math::CountRightZero(Block);
+
+			if (++BlockIndex == NumBlocks()) return INDEX_NONE;
+
+			Block = Impl[BlockIndex];
+		}
+	}
+
 public:
 
 	class FReference final : private FSingleton
@@ -527,6 +611,46 @@ public:
 
 	};
 
+	/** The forward iterator over the indices of the bits that are set to true. */
+	class FSetBitIterator final
+	{
+	public:
+
+		using FElementType = size_t;
+
+		FORCEINLINE constexpr FSetBitIterator() = default;
+
+		FORCEINLINE constexpr FSetBitIterator(const FSetBitIterator&)            = default;
+		FORCEINLINE constexpr FSetBitIterator(FSetBitIterator&&)                 = default;
+		FORCEINLINE constexpr FSetBitIterator& operator=(const FSetBitIterator&) = default;
+		FORCEINLINE constexpr FSetBitIterator& operator=(FSetBitIterator&&)      = default;
+
+		NODISCARD friend FORCEINLINE constexpr bool operator==(const FSetBitIterator& LHS, const FSetBitIterator& RHS) { check(LHS.Owner == RHS.Owner); return LHS.BitIndex == RHS.BitIndex; }
+
+		NODISCARD FORCEINLINE constexpr bool operator==(FDefaultSentinel) const& { return BitIndex == INDEX_NONE; }
+
+		NODISCARD FORCEINLINE constexpr size_t operator*() const { checkf(BitIndex != INDEX_NONE, TEXT("Read access violation. Please check IsValidIterator().")); return BitIndex; }
+
+		FORCEINLINE constexpr FSetBitIterator& operator++() { BitIndex = Owner->FindNextSet(BitIndex); return *this; }
+
+		FORCEINLINE constexpr FSetBitIterator operator++(int) { FSetBitIterator Temp = *this; ++*this; return Temp; }
+
+	private:
+
+		const TStaticBitset* Owner    = nullptr;
+		size_t               BitIndex = INDEX_NONE;
+
+		FORCEINLINE constexpr FSetBitIterator(const TStaticBitset* InContainer, size_t InBitIndex)
+			: Owner(InContainer), BitIndex(InBitIndex)
+		{ }
+
+		friend TStaticBitset;
+
+	};
+
+	static_assert(CForwardIterator<FSetBitIterator>);
+	static_assert(CSentinelFor<FDefaultSentinel, FSetBitIterator>);
+
 private:
 
 	template <bool bConst>
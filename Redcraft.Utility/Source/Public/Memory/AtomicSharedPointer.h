@@ -0,0 +1,210 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Memory/SharedPointer.h"
+#include "Templates/Atomic.h"
+#include "Templates/Utility.h"
+#include "Templates/Noncopyable.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+/**
+ * The shared pointer that can be loaded, stored and exchanged atomically, which is lock-free for both readers and writers.
+ * The shared pointer is kept in an immutable node, and the word of the atomic packs the node address with a local count,
+ * i.e. the split reference counting. Load() pins the node by incrementing the local count, copies the shared pointer,
+ * and then unpins the node. The writer that swaps the node out transfers the local count to the internal count of the node,
+ * which destroys the node once all pinned readers have unpinned it. So each store allocates a node,
+ * which is suitable for the read-mostly data such as the configuration snapshots.
+ */
+template <typename T> requires (CObject<T> && !CBoundedArray<T>)
+class TAtomicSharedPtr final : private FSingleton
+{
+public:
+
+	using FValueType = TSharedPtr<T>;
+
+	/** Constructs an empty atomic shared pointer. */
+	FORCEINLINE TAtomicSharedPtr() : Word(0) { }
+
+	/** Constructs an atomic shared pointer with the shared pointer. */
+	FORCEINLINE TAtomicSharedPtr(FValueType InValue) : Word(Pack(MakeNode(MoveTemp(InValue)), 0)) { }
+
+	/** Destructs the atomic shared pointer, which should not be accessed concurrently. */
+	FORCEINLINE ~TAtomicSharedPtr() { ReleaseSwapped(Word.Load(EMemoryOrder::Acquire)); }
+
+	/** Stores the shared pointer. */
+	FORCEINLINE TAtomicSharedPtr& operator=(FValueType InValue) { Store(MoveTemp(InValue)); return *this; }
+
+	/** Loads the shared pointer. */
+	NODISCARD FORCEINLINE operator FValueType() const { return Load(); }
+
+	/** @return The copy of the current shared pointer. */
+	NODISCARD FValueType Load() const
+	{
+		const uint64 Pinned = Pin();
+
+		if (Pinned == 0) return nullptr;
+
+		FValueType Result = Unpack(Pinned)->Value;
+
+		Unpin(Pinned);
+
+		return Result;
+	}
+
+	/** Replaces the current shared pointer with the new one. */
+	FORCEINLINE void Store(FValueType InValue)
+	{
+		ReleaseSwapped(Word.Exchange(Pack(MakeNode(MoveTemp(InValue)), 0), EMemoryOrder::AcquireRelease));
+	}
+
+	/** Replaces the current shared pointer with the new one, and returns the old one. */
+	NODISCARD FValueType Exchange(FValueType InValue)
+	{
+		const uint64 Swapped = Word.Exchange(Pack(MakeNode(MoveTemp(InValue)), 0), EMemoryOrder::AcquireRelease);
+
+		if (Swapped == 0) return nullptr;
+
+		FValueType Result = Unpack(Swapped)->Value;
+
+		ReleaseSwapped(Swapped);
+
+		return Result;
+	}
+
+	/**
+	 * Replaces the current shared pointer with the desired one if it is equivalent to the expected one,
+	 * i.e. points to the same object and shares the ownership. Otherwise, loads the current one into the expected one.
+	 *
+	 * @param Expected - The shared pointer expected to be found, which is updated to the current one on failure.
+	 * @param Desired  - The shared pointer to store if the current one is equivalent to the expected one.
+	 *
+	 * @return true if the shared pointer was replaced, false otherwise.
+	 */
+	NODISCARD bool CompareExchange(FValueType& Expected, FValueType Desired)
+	{
+		FNode* DesiredNode = nullptr;
+
+		while (true)
+		{
+			const uint64 Pinned = Pin();
+
+			const FValueType& Current = Pinned != 0 ? Unpack(Pinned)->Value : EmptyValue;
+
+			if (Current.Get() != Expected.Get() || Current.OwnerCompare(Expected) != 0)
+			{
+				Expected = Current;
+
+				if (Pinned != 0) Unpin(Pinned);
+
+				delete DesiredNode;
+
+				return false;
+			}
+
+			if (DesiredNode == nullptr && Desired.IsValid()) DesiredNode = MakeNode(MoveTemp(Desired));
+
+			uint64 Swapped = Pinned;
+
+			if (Word.CompareExchange(Swapped, Pack(DesiredNode, 0), EMemoryOrder::AcquireRelease, EMemoryOrder::Relaxed))
+			{
+				// The pin of this thread is counted in the swapped word, so it is consumed by the transfer.
+				if (Pinned != 0) ReleaseSwapped(Swapped, 1);
+
+				return true;
+			}
+
+			// The word has been changed by the other threads, which may be another pin of the same node.
+			if (Pinned != 0) Unpin(Pinned);
+		}
+	}
+
+	/** @return true if the atomic shared pointer is always lock-free. */
+	static constexpr bool bIsAlwaysLockFree = TAtomic<uint64>::bIsAlwaysLockFree;
+
+private:
+
+	struct FNode
+	{
+		FValueType Value;
+
+		TAtomic<ptrdiff> InternalCount = 0;
+	};
+
+	static constexpr uint64 PointerBits = PLATFORM_CPU_BITS == 64 ? 48 : 32;
+	static constexpr uint64 PointerMask = (static_cast<uint64>(1) << PointerBits) - 1;
+	static constexpr uint64 OneCount    =  static_cast<uint64>(1) << PointerBits;
+
+	inline static const FValueType EmptyValue;
+
+	// The empty shared pointer is stored as zero, which is never pinned.
+	mutable TAtomic<uint64> Word;
+
+	NODISCARD static FORCEINLINE FNode* MakeNode(FValueType&& InValue)
+	{
+		return InValue.IsValid() ? new FNode { MoveTemp(InValue) } : nullptr;
+	}
+
+	NODISCARD static FORCEINLINE uint64 Pack(FNode* Node, uint64 Count)
+	{
+		const uint64 Address = static_cast<uint64>(reinterpret_cast<uintptr>(Node));
+
+		checkf((Address & ~PointerMask) == 0, TEXT("The address of the node exceeds the packed bits."));
+
+		return Count * OneCount | Address;
+	}
+
+	NODISCARD static FORCEINLINE FNode* Unpack(uint64 InWord) { return reinterpret_cast<FNode*>(static_cast<uintptr>(InWord & PointerMask)); }
+
+	/** Increments the local count of the current node, returns the pinned word, or zero if the shared pointer is empty. */
+	NODISCARD uint64 Pin() const
+	{
+		uint64 Current = Word.Load(EMemoryOrder::Relaxed);
+
+		while (Current != 0)
+		{
+			checkf((Current >> PointerBits) != (static_cast<uint64>(1) << (64 - PointerBits)) - 1, TEXT("Too many concurrent loads."));
+
+			if (Word.CompareExchange(Current, Current + OneCount, EMemoryOrder::Acquire, EMemoryOrder::Relaxed, true)) return Current + OneCount;
+		}
+
+		return 0;
+	}
+
+	/** Decrements the local count if the node is still current, otherwise the internal count that the local count was transferred to. */
+	void Unpin(uint64 Pinned) const
+	{
+		FNode* Node = Unpack(Pinned);
+
+		uint64 Current = Word.Load(EMemoryOrder::Relaxed);
+
+		// The address of the pinned node cannot be reused by a new node, since the node is not destroyed until it is unpinned.
+		while (Unpack(Current) == Node)
+		{
+			if (Word.CompareExchange(Current, Current - OneCount, EMemoryOrder::Release, EMemoryOrder::Relaxed, true)) return;
+		}
+
+		if (Node->InternalCount.FetchSub(1, EMemoryOrder::AcquireRelease) == 1) delete Node;
+	}
+
+	/** Transfers the local count of the swapped word to its node, and destroys the node if no thread is pinning it. */
+	static void ReleaseSwapped(uint64 Swapped, uint64 Consumed = 0)
+	{
+		FNode* Node = Unpack(Swapped);
+
+		if (Node == nullptr) return;
+
+		const ptrdiff Count = static_cast<ptrdiff>((Swapped >> PointerBits) - Consumed);
+
+		if (Node->InternalCount.FetchAdd(Count, EMemoryOrder::AcquireRelease) + Count == 0) delete Node;
+	}
+
+};
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -0,0 +1,522 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Memory/Memory.h"
+#include "Numerics/Bit.h"
+
+#if PLATFORM_HAS_AVX2
+#	include <immintrin.h>
+#elif PLATFORM_HAS_SSE2
+#	include <emmintrin.h>
+#endif
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_BEGIN(Memory)
+
+NAMESPACE_PRIVATE_BEGIN
+
+enum class EBitwiseOperation : uint8
+{
+	And,
+	Or,
+	Xor,
+	AndNot,
+};
+
+template <EBitwiseOperation Operation, CUnsignedIntegral T>
+FORCEINLINE void BitwiseApply(T* Destination, const T* Source, size_t Count)
+{
+	size_t Index = 0;
+
+#	if PLATFORM_HAS_AVX2
+	{
+		constexpr size_t Lanes = sizeof(__m256i) / sizeof(T);
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			const __m256i LHS = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Destination + Index));
+			const __m256i RHS = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source      + Index));
+
+			__m256i Result;
+
+			if constexpr (Operation == EBitwiseOperation::And)    Result = _mm256_and_si256(LHS, RHS);
+			if constexpr (Operation == EBitwiseOperation::Or)     Result = _mm256_or_si256 (LHS, RHS);
+			if constexpr (Operation == EBitwiseOperation::Xor)    Result = _mm256_xor_si256(LHS, RHS);
+			if constexpr (Operation == EBitwiseOperation::AndNot) Result = _mm256_andnot_si256(RHS, LHS);
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination + Index), Result);
+		}
+	}
+#	endif
+
+#	if PLATFORM_HAS_SSE2
+	{
+		constexpr size_t Lanes = sizeof(__m128i) / sizeof(T);
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			const __m128i LHS = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Destination + Index));
+			const __m128i RHS = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source      + Index));
+
+			__m128i Result;
+
+			if constexpr (Operation == EBitwiseOperation::And)    Result = _mm_and_si128(LHS, RHS);
+			if constexpr (Operation == EBitwiseOperation::Or)     Result = _mm_or_si128 (LHS, RHS);
+			if constexpr (Operation == EBitwiseOperation::Xor)    Result = _mm_xor_si128(LHS, RHS);
+			if constexpr (Operation == EBitwiseOperation::AndNot) Result = _mm_andnot_si128(RHS, LHS);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + Index), Result);
+		}
+	}
+#	endif
+
+	for (; Index != Count; ++Index)
+	{
+		if constexpr (Operation == EBitwiseOperation::And)    Destination[Index] &=  Source[Index];
+		if constexpr (Operation == EBitwiseOperation::Or)     Destination[Index] |=  Source[Index];
+		if constexpr (Operation == EBitwiseOperation::Xor)    Destination[Index] ^=  Source[Index];
+		if constexpr (Operation == EBitwiseOperation::AndNot) Destination[Index] &= ~Source[Index];
+	}
+}
+
+#if PLATFORM_HAS_AVX2
+
+template <CUnsignedIntegral T> FORCEINLINE __m256i ShiftLeft (__m256i Value, __m128i Offset) { if constexpr (sizeof(T) == 2) return _mm256_sll_epi16(Value, Offset); else if constexpr (sizeof(T) == 4) return _mm256_sll_epi32(Value, Offset); else return _mm256_sll_epi64(Value, Offset); }
+template <CUnsignedIntegral T> FORCEINLINE __m256i ShiftRight(__m256i Value, __m128i Offset) { if constexpr (sizeof(T) == 2) return _mm256_srl_epi16(Value, Offset); else if constexpr (sizeof(T) == 4) return _mm256_srl_epi32(Value, Offset); else return _mm256_srl_epi64(Value, Offset); }
+
+#endif
+
+#if PLATFORM_HAS_SSE2
+
+template <CUnsignedIntegral T> FORCEINLINE __m128i ShiftLeft (__m128i Value, __m128i Offset) { if constexpr (sizeof(T) == 2) return _mm_sll_epi16(Value, Offset); else if constexpr (sizeof(T) == 4) return _mm_sll_epi32(Value, Offset); else return _mm_sll_epi64(Value, Offset); }
+template <CUnsignedIntegral T> FORCEINLINE __m128i ShiftRight(__m128i Value, __m128i Offset) { if constexpr (sizeof(T) == 2) return _mm_srl_epi16(Value, Offset); else if constexpr (sizeof(T) == 4) return _mm_srl_epi32(Value, Offset); else return _mm_srl_epi64(Value, Offset); }
+
+#endif
+
+NAMESPACE_PRIVATE_END
+
+/**
+ * Sets the elements of 'Destination' to the result of binary AND on the corresponding pairs of elements of 'Destination' and 'Source'.
+ * The buffers may be the same buffer but may not partially overlap.
+ *
+ * @param  Destination - The pointer to the buffer to read from and write to.
+ * @param  Source      - The pointer to the buffer to read from.
+ * @param  Count       - The number of elements to process.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+FORCEINLINE void BitwiseAnd(T* Destination, const T* Source, size_t Count)
+{
+	NAMESPACE_PRIVATE::BitwiseApply<NAMESPACE_PRIVATE::EBitwiseOperation::And>(Destination, Source, Count);
+}
+
+/**
+ * Sets the elements of 'Destination' to the result of binary OR on the corresponding pairs of elements of 'Destination' and 'Source'.
+ * The buffers may be the same buffer but may not partially overlap.
+ *
+ * @param  Destination - The pointer to the buffer to read from and write to.
+ * @param  Source      - The pointer to the buffer to read from.
+ * @param  Count       - The number of elements to process.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+FORCEINLINE void BitwiseOr(T* Destination, const T* Source, size_t Count)
+{
+	NAMESPACE_PRIVATE::BitwiseApply<NAMESPACE_PRIVATE::EBitwiseOperation::Or>(Destination, Source, Count);
+}
+
+/**
+ * Sets the elements of 'Destination' to the result of binary XOR on the corresponding pairs of elements of 'Destination' and 'Source'.
+ * The buffers may be the same buffer but may not partially overlap.
+ *
+ * @param  Destination - The pointer to the buffer to read from and write to.
+ * @param  Source      - The pointer to the buffer to read from.
+ * @param  Count       - The number of elements to process.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+FORCEINLINE void BitwiseXor(T* Destination, const T* Source, size_t Count)
+{
+	NAMESPACE_PRIVATE::BitwiseApply<NAMESPACE_PRIVATE::EBitwiseOperation::Xor>(Destination, Source, Count);
+}
+
+/**
+ * Sets the elements of 'Destination' to the result of binary AND on the elements of 'Destination' and the complement of the elements of 'Source'.
+ * The buffers may be the same buffer but may not partially overlap.
+ *
+ * @param  Destination - The pointer to the buffer to read from and write to.
+ * @param  Source      - The pointer to the buffer whose complement is read.
+ * @param  Count       - The number of elements to process.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+FORCEINLINE void BitwiseAndNot(T* Destination, const T* Source, size_t Count)
+{
+	NAMESPACE_PRIVATE::BitwiseApply<NAMESPACE_PRIVATE::EBitwiseOperation::AndNot>(Destination, Source, Count);
+}
+
+/**
+ * Flips all bits of the elements of 'Destination'.
+ *
+ * @param  Destination - The pointer to the buffer to flip.
+ * @param  Count       - The number of elements to process.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+void BitwiseNot(T* Destination, size_t Count)
+{
+	size_t Index = 0;
+
+#	if PLATFORM_HAS_AVX2
+	{
+		constexpr size_t Lanes = sizeof(__m256i) / sizeof(T);
+
+		const __m256i AllOne = _mm256_set1_epi8(-1);
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			__m256i* Pointer = reinterpret_cast<__m256i*>(Destination + Index);
+
+			_mm256_storeu_si256(Pointer, _mm256_xor_si256(_mm256_loadu_si256(Pointer), AllOne));
+		}
+	}
+#	endif
+
+#	if PLATFORM_HAS_SSE2
+	{
+		constexpr size_t Lanes = sizeof(__m128i) / sizeof(T);
+
+		const __m128i AllOne = _mm_set1_epi8(-1);
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			__m128i* Pointer = reinterpret_cast<__m128i*>(Destination + Index);
+
+			_mm_storeu_si128(Pointer, _mm_xor_si128(_mm_loadu_si128(Pointer), AllOne));
+		}
+	}
+#	endif
+
+	for (; Index != Count; ++Index) Destination[Index] = ~Destination[Index];
+}
+
+/**
+ * Checks whether all bits of the elements of 'Buffer' are zero.
+ *
+ * @param  Buffer - The pointer to the buffer to examine.
+ * @param  Count  - The number of elements to examine.
+ *
+ * @return true if all bits are zero or 'Count' is zero, false otherwise.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+NODISCARD bool IsAllZero(const T* Buffer, size_t Count)
+{
+	size_t Index = 0;
+
+#	if PLATFORM_HAS_AVX2
+	{
+		constexpr size_t Lanes = sizeof(__m256i) / sizeof(T);
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			const __m256i Value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Buffer + Index));
+
+			if (!_mm256_testz_si256(Value, Value)) return false;
+		}
+	}
+#	endif
+
+#	if PLATFORM_HAS_SSE2
+	{
+		constexpr size_t Lanes = sizeof(__m128i) / sizeof(T);
+
+		const __m128i Zero = _mm_setzero_si128();
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			const __m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Buffer + Index));
+
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(Value, Zero)) != 0xFFFF) return false;
+		}
+	}
+#	endif
+
+	for (; Index != Count; ++Index)
+	{
+		if (Buffer[Index] != 0) return false;
+	}
+
+	return true;
+}
+
+/**
+ * Checks whether all bits of the elements of 'Buffer' are one.
+ *
+ * @param  Buffer - The pointer to the buffer to examine.
+ * @param  Count  - The number of elements to examine.
+ *
+ * @return true if all bits are one or 'Count' is zero, false otherwise.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+NODISCARD bool IsAllOne(const T* Buffer, size_t Count)
+{
+	size_t Index = 0;
+
+#	if PLATFORM_HAS_AVX2
+	{
+		constexpr size_t Lanes = sizeof(__m256i) / sizeof(T);
+
+		const __m256i AllOne = _mm256_set1_epi8(-1);
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			const __m256i Value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Buffer + Index));
+
+			if (!_mm256_testc_si256(Value, AllOne)) return false;
+		}
+	}
+#	endif
+
+#	if PLATFORM_HAS_SSE2
+	{
+		constexpr size_t Lanes = sizeof(__m128i) / sizeof(T);
+
+		const __m128i AllOne = _mm_set1_epi8(-1);
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			const __m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Buffer + Index));
+
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(Value, AllOne)) != 0xFFFF) return false;
+		}
+	}
+#	endif
+
+	for (; Index != Count; ++Index)
+	{
+		if (Buffer[Index] != static_cast<T>(-1)) return false;
+	}
+
+	return true;
+}
+
+/**
+ * Counts the bits that are set in both 'BufferLHS' and 'BufferRHS' without materializing the intersection.
+ *
+ * @param  BufferLHS - The pointer to the buffer to examine.
+ * @param  BufferRHS - The pointer to the buffer to examine.
+ * @param  Count     - The number of elements to examine.
+ *
+ * @return The number of bits that are set in the binary AND of the two buffers.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+NODISCARD size_t BitwiseAndCount(const T* BufferLHS, const T* BufferRHS, size_t Count)
+{
+	size_t Result = 0;
+
+	size_t Index = 0;
+
+	if constexpr (sizeof(T) < sizeof(uint64))
+	{
+		constexpr size_t Lanes = sizeof(uint64) / sizeof(T);
+
+		for (; Index + Lanes <= Count; Index += Lanes)
+		{
+			uint64 LHS;
+			uint64 RHS;
+
+			Memory::Memcpy(&LHS, BufferLHS + Index, sizeof(uint64));
+			Memory::Memcpy(&RHS, BufferRHS + Index, sizeof(uint64));
+
+			Result += Math::CountAllOne(LHS & RHS);
+		}
+	}
+
+	for (; Index != Count; ++Index)
+	{
+		Result += Math::CountAllOne(static_cast<T>(BufferLHS[Index] & BufferRHS[Index]));
+	}
+
+	return Result;
+}
+
+/**
+ * Shifts the bits of the buffer towards the higher addresses, treating the elements as one big little-endian integer.
+ * The vacated bits are filled with zero.
+ *
+ * @param  Buffer - The pointer to the buffer to shift.
+ * @param  Count  - The number of elements in the buffer.
+ * @param  Offset - The number of bits to shift.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+void BitwiseShiftLeft(T* Buffer, size_t Count, size_t Offset)
+{
+	constexpr size_t Width = sizeof(T) * 8;
+
+	const size_t Blockshift = Offset / Width;
+	const size_t Bitshift   = Offset % Width;
+
+	if (Count == 0) return;
+
+	if (Blockshift >= Count)
+	{
+		Memory::Memzero(Buffer, Count * sizeof(T));
+
+		return;
+	}
+
+	if (Blockshift != 0)
+	{
+		Memory::Memmove(Buffer + Blockshift, Buffer, (Count - Blockshift) * sizeof(T));
+		Memory::Memzero(Buffer, Blockshift * sizeof(T));
+	}
+
+	if (Bitshift == 0) return;
+
+	size_t Index = Count - 1;
+
+	if constexpr (sizeof(T) > 1)
+	{
+#		if PLATFORM_HAS_AVX2
+		{
+			constexpr size_t Lanes = sizeof(__m256i) / sizeof(T);
+
+			const __m128i LHSOffset = _mm_cvtsi32_si128(static_cast<int>(Bitshift));
+			const __m128i RHSOffset = _mm_cvtsi32_si128(static_cast<int>(Width - Bitshift));
+
+			for (; Index >= Lanes; Index -= Lanes)
+			{
+				T* Pointer = Buffer + Index - Lanes + 1;
+
+				const __m256i Current  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Pointer));
+				const __m256i Previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Pointer - 1));
+
+				const __m256i Result = _mm256_or_si256(NAMESPACE_PRIVATE::ShiftLeft<T>(Current, LHSOffset), NAMESPACE_PRIVATE::ShiftRight<T>(Previous, RHSOffset));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Pointer), Result);
+			}
+		}
+#		endif
+
+#		if PLATFORM_HAS_SSE2
+		{
+			constexpr size_t Lanes = sizeof(__m128i) / sizeof(T);
+
+			const __m128i LHSOffset = _mm_cvtsi32_si128(static_cast<int>(Bitshift));
+			const __m128i RHSOffset = _mm_cvtsi32_si128(static_cast<int>(Width - Bitshift));
+
+			for (; Index >= Lanes; Index -= Lanes)
+			{
+				T* Pointer = Buffer + Index - Lanes + 1;
+
+				const __m128i Current  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pointer));
+				const __m128i Previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pointer - 1));
+
+				const __m128i Result = _mm_or_si128(NAMESPACE_PRIVATE::ShiftLeft<T>(Current, LHSOffset), NAMESPACE_PRIVATE::ShiftRight<T>(Previous, RHSOffset));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Pointer), Result);
+			}
+		}
+#		endif
+	}
+
+	for (; Index != 0; --Index)
+	{
+		Buffer[Index] = static_cast<T>(Buffer[Index] << Bitshift | Buffer[Index - 1] >> (Width - Bitshift));
+	}
+
+	Buffer[0] = static_cast<T>(Buffer[0] << Bitshift);
+}
+
+/**
+ * Shifts the bits of the buffer towards the lower addresses, treating the elements as one big little-endian integer.
+ * The vacated bits are filled with zero.
+ *
+ * @param  Buffer - The pointer to the buffer to shift.
+ * @param  Count  - The number of elements in the buffer.
+ * @param  Offset - The number of bits to shift.
+ */
+template <CUnsignedIntegral T> requires (!CSameAs<T, bool>)
+void BitwiseShiftRight(T* Buffer, size_t Count, size_t Offset)
+{
+	constexpr size_t Width = sizeof(T) * 8;
+
+	const size_t Blockshift = Offset / Width;
+	const size_t Bitshift   = Offset % Width;
+
+	if (Count == 0) return;
+
+	if (Blockshift >= Count)
+	{
+		Memory::Memzero(Buffer, Count * sizeof(T));
+
+		return;
+	}
+
+	if (Blockshift != 0)
+	{
+		Memory::Memmove(Buffer, Buffer + Blockshift, (Count - Blockshift) * sizeof(T));
+		Memory::Memzero(Buffer + Count - Blockshift, Blockshift * sizeof(T));
+	}
+
+	if (Bitshift == 0) return;
+
+	size_t Index = 0;
+
+	if constexpr (sizeof(T) > 1)
+	{
+#		if PLATFORM_HAS_AVX2
+		{
+			constexpr size_t Lanes = sizeof(__m256i) / sizeof(T);
+
+			const __m128i LHSOffset = _mm_cvtsi32_si128(static_cast<int>(Bitshift));
+			const __m128i RHSOffset = _mm_cvtsi32_si128(static_cast<int>(Width - Bitshift));
+
+			for (; Index + Lanes < Count; Index += Lanes)
+			{
+				T* Pointer = Buffer + Index;
+
+				const __m256i Current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Pointer));
+				const __m256i Next    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Pointer + 1));
+
+				const __m256i Result = _mm256_or_si256(NAMESPACE_PRIVATE::ShiftRight<T>(Current, LHSOffset), NAMESPACE_PRIVATE::ShiftLeft<T>(Next, RHSOffset));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Pointer), Result);
+			}
+		}
+#		endif
+
+#		if PLATFORM_HAS_SSE2
+		{
+			constexpr size_t Lanes = sizeof(__m128i) / sizeof(T);
+
+			const __m128i LHSOffset = _mm_cvtsi32_si128(static_cast<int>(Bitshift));
+			const __m128i RHSOffset = _mm_cvtsi32_si128(static_cast<int>(Width - Bitshift));
+
+			for (; Index + Lanes < Count; Index += Lanes)
+			{
+				T* Pointer = Buffer + Index;
+
+				const __m128i Current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pointer));
+				const __m128i Next    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pointer + 1));
+
+				const __m128i Result = _mm_or_si128(NAMESPACE_PRIVATE::ShiftRight<T>(Current, LHSOffset), NAMESPACE_PRIVATE::ShiftLeft<T>(Next, RHSOffset));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Pointer), Result);
+			}
+		}
+#		endif
+	}
+
+	for (; Index != Count - 1; ++Index)
+	{
+		Buffer[Index] = static_cast<T>(Buffer[Index] >> Bitshift | Buffer[Index + 1] << (Width - Bitshift));
+	}
+
+	Buffer[Count - 1] = static_cast<T>(Buffer[Count - 1] >> Bitshift);
+}
+
+NAMESPACE_END(Memory)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -7,6 +7,10 @@
 #include <cstring>
 #include <cstdlib>
 
+#if PLATFORM_COMPILER_MSVC && PLATFORM_HAS_SSE2
+#	include <xmmintrin.h>
+#endif
+
 NAMESPACE_REDCRAFT_BEGIN
 NAMESPACE_MODULE_BEGIN(Redcraft)
 NAMESPACE_MODULE_BEGIN(Utility)
@@ -110,6 +114,21 @@ FORCEINLINE int32 Memcmp(const void* BufferLHS, const void* BufferRHS, size_t Co
 	return NAMESPACE_STD::memcmp(BufferLHS, BufferRHS, Count);
 }
 
+/**
+ * Reinterprets the buffer pointed to by 'Buffer' as an array of unsigned char and
+ * finds the first occurrence of 'ValueToFind' in the first 'Count' characters of the array.
+ *
+ * @param  Buffer      - The pointer to the memory buffer to examine.
+ * @param  ValueToFind - The byte to search for.
+ * @param  Count       - The number of bytes to examine.
+ *
+ * @return The pointer to the first occurrence of the byte, or nullptr if the byte is not found.
+ */
+FORCEINLINE const void* Memchr(const void* Buffer, uint8 ValueToFind, size_t Count)
+{
+	return NAMESPACE_STD::memchr(Buffer, ValueToFind, Count);
+}
+
 /**
  * Copies 'ValueToSet' into each of the first 'Count' characters of the buffer pointed to by 'Destination'.
  *
@@ -137,6 +156,25 @@ FORCEINLINE void* Memzero(void* Destination, size_t Count)
 	return NAMESPACE_STD::memset(Destination, 0, Count);
 }
 
+/**
+ * Hints the processor to fetch the cache line that contains 'Address' for a later read.
+ * It never faults, so the address does not have to be valid, and it does nothing if the platform does not support it.
+ *
+ * @param  Address - The address to fetch.
+ */
+FORCEINLINE void Prefetch(const void* Address)
+{
+#	if PLATFORM_COMPILER_CLANG || PLATFORM_COMPILER_GCC
+	{
+		__builtin_prefetch(Address);
+	}
+#	elif PLATFORM_COMPILER_MSVC && PLATFORM_HAS_SSE2
+	{
+		_mm_prefetch(static_cast<const char*>(Address), _MM_HINT_T0);
+	}
+#	endif
+}
+
 /**
  * Copies 'Count' bytes from the buffer pointed to by 'Source' to the buffer pointed to by 'Destination'.
  * If the buffers overlap, the behavior is undefined.
@@ -112,6 +112,24 @@ NAMESPACE_MODULE_BEGIN(Utility)
 #	endif
 #endif
 
+// SIMD instruction set information macro
+
+#ifndef PLATFORM_HAS_SSE2
+#	if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#		define PLATFORM_HAS_SSE2 1
+#	else
+#		define PLATFORM_HAS_SSE2 0
+#	endif
+#endif
+
+#ifndef PLATFORM_HAS_AVX2
+#	if defined(__AVX2__)
+#		define PLATFORM_HAS_AVX2 1
+#	else
+#		define PLATFORM_HAS_AVX2 0
+#	endif
+#endif
+
 // Endian information macro
 
 #if !defined(PLATFORM_LITTLE_ENDIAN) && !defined(PLATFORM_BIG_ENDIAN)
@@ -167,26 +167,13 @@ FORCEINLINE constexpr T BitFloor(T Value)
 	return static_cast<T>(1) << (Math::BitWidth(static_cast<T>(Value)) - 1);
 }
 
-template <CUnsignedIntegral T> FORCEINLINE constexpr T RotateLeft (T Value, int Offset);
-template <CUnsignedIntegral T> FORCEINLINE constexpr T RotateRight(T Value, int Offset);
-
 /** @return The value bitwise left-rotation by the given offset. */
 template <CUnsignedIntegral T>
 FORCEINLINE constexpr T RotateLeft(T Value, int Offset)
 {
 	if constexpr (CSameAs<T, bool>) return Value;
 
-	else
-	{
-		if (Offset >= 0)
-		{
-			const auto Remainder = Offset % TNumericLimits<T>::Digits;
-
-			return static_cast<T>((Value << Remainder) | (Value >> (TNumericLimits<T>::Digits - Remainder)));
-		}
-
-		return Math::RotateRight(Value, -Offset);
-	}
+	else return static_cast<T>(NAMESPACE_STD::rotl(Value, Offset));
 }
 
 /** @return The value bitwise right-rotation by the given offset. */
@@ -195,16 +182,7 @@ FORCEINLINE constexpr T RotateRight(T Value, int Offset)
 {
 	if constexpr (CSameAs<T, bool>) return Value;
 
-	else
-	{
-		if (Offset >= 0)
-		{
-			const auto Remainder = Offset % TNumericLimits<T>::Digits;
-
-			return static_cast<T>((Value >> Remainder) | (Value << (TNumericLimits<T>::Digits - Remainder)));
-		}
-		return Math::RotateLeft(Value, -Offset);
-	}
+	else return static_cast<T>(NAMESPACE_STD::rotr(Value, Offset));
 }
 
 /** The enum indicates the endianness of scalar types. */
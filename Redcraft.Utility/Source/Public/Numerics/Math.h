@@ -710,17 +710,19 @@ NODISCARD FORCEINLINE constexpr T Sqrt(T A) FORWARD_FLOATING_POINT_IMPLEMENT_1_A
 template <CIntegral T>
 NODISCARD FORCEINLINE constexpr T Cbrt(T A)
 {
-	if (A < 0) return -Math::Cbrt(-A);
-
 	if (A == 0) return 0;
 
+	const bool bNegative = A < 0;
+
+	if (bNegative) A = -A;
+
 	T X = A;
 
 	while (true)
 	{
 		T Y = (X + A / (X * X)) / 2;
 
-		if (Y >= X) return X;
+		if (Y >= X) return bNegative ? -X : X;
 
 		X = Y;
 	}
@@ -3,6 +3,9 @@
 #include "CoreTypes.h"
 #include "Numerics/Bit.h"
 #include "Numerics/Math.h"
+#include "Numerics/Limits.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
 
 NAMESPACE_REDCRAFT_BEGIN
 NAMESPACE_MODULE_BEGIN(Redcraft)
@@ -83,6 +86,301 @@ NODISCARD FORCEINLINE auto RandWithin(T A, U B)
 
 NAMESPACE_END(Math)
 
+/**
+ * A concept specifies a type is a random number engine that generates the uniformly distributed 32-bit or 64-bit
+ * unsigned integers covering the entire range of the result type, so the results can be used as the random bits directly.
+ */
+template <typename G>
+concept CUniformRandomBitGenerator = CInvocable<G&>
+	&& (CSameAs<TInvokeResult<G&>, uint32> || CSameAs<TInvokeResult<G&>, uint64>)
+	&& requires
+	{
+		{ G::Min() } -> CSameAs<TInvokeResult<G&>>;
+		{ G::Max() } -> CSameAs<TInvokeResult<G&>>;
+		requires G::Min() == 0 && G::Max() == TNumericLimits<TInvokeResult<G&>>::Max();
+	};
+
+/**
+ * The SplitMix64 random number engine, which has a 64-bit state and passes through every 64-bit value once per period.
+ * It is mainly used to expand a single seed into the states of the other engines.
+ */
+class FSplitMix64 final
+{
+public:
+
+	using FResultType = uint64;
+
+	/** Constructs the engine with the given seed. Any seed is valid. */
+	FORCEINLINE constexpr explicit FSplitMix64(uint64 InSeed = 0) : State(InSeed) { }
+
+	/** @return The generated random number within the range of [0, 2^64). */
+	FORCEINLINE constexpr uint64 operator()()
+	{
+		uint64 Result = State += 0x9E3779B97F4A7C15;
+
+		Result = (Result ^ (Result >> 30)) * 0xBF58476D1CE4E5B9;
+		Result = (Result ^ (Result >> 27)) * 0x94D049BB133111EB;
+
+		return Result ^ (Result >> 31);
+	}
+
+	NODISCARD FORCEINLINE static constexpr uint64 Min() { return 0; }
+	NODISCARD FORCEINLINE static constexpr uint64 Max() { return TNumericLimits<uint64>::Max(); }
+
+private:
+
+	uint64 State;
+
+};
+
+/**
+ * The xoshiro256** random number engine, which has a 256-bit state and a period of 2^256 - 1.
+ * It is the fastest general purpose engine here, and the jump function splits the sequence into independent streams.
+ */
+class FXoshiro256StarStar final
+{
+public:
+
+	using FResultType = uint64;
+
+	/** Constructs the engine with the state expanded from the given seed by SplitMix64. */
+	FORCEINLINE constexpr explicit FXoshiro256StarStar(uint64 InSeed = 0)
+	{
+		FSplitMix64 Seeder(InSeed);
+
+		for (uint64& Word : State) Word = Seeder();
+	}
+
+	/** @return The generated random number within the range of [0, 2^64). */
+	FORCEINLINE constexpr uint64 operator()()
+	{
+		const uint64 Result = Math::RotateLeft(State[1] * 5, 7) * 9;
+
+		const uint64 Temp = State[1] << 17;
+
+		State[2] ^= State[0];
+		State[3] ^= State[1];
+		State[1] ^= State[2];
+		State[0] ^= State[3];
+
+		State[2] ^= Temp;
+
+		State[3] = Math::RotateLeft(State[3], 45);
+
+		return Result;
+	}
+
+	/** Advances the engine by 2^128 steps, which generates 2^128 non-overlapping streams for the parallel computations. */
+	constexpr void Jump()
+	{
+		constexpr uint64 Polynomial[] = { 0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C };
+
+		uint64 Result[4] = { };
+
+		for (uint64 Word : Polynomial)
+		{
+			for (uint Bit = 0; Bit != 64; ++Bit)
+			{
+				if (Word & (static_cast<uint64>(1) << Bit))
+				{
+					for (size_t Index = 0; Index != 4; ++Index) Result[Index] ^= State[Index];
+				}
+
+				Ignore = (*this)();
+			}
+		}
+
+		for (size_t Index = 0; Index != 4; ++Index) State[Index] = Result[Index];
+	}
+
+	NODISCARD FORCEINLINE static constexpr uint64 Min() { return 0; }
+	NODISCARD FORCEINLINE static constexpr uint64 Max() { return TNumericLimits<uint64>::Max(); }
+
+private:
+
+	uint64 State[4];
+
+};
+
+#if PLATFORM_HAS_INT128
+
+/**
+ * The PCG64 random number engine, which is a 128-bit linear congruential generator with the XSL-RR output permutation.
+ * It has a period of 2^128, and the engines constructed with different streams generate the independent sequences.
+ * It is only available on the platforms that support the 128-bit integers.
+ */
+class FPCG64 final
+{
+public:
+
+	using FResultType = uint64;
+
+	/** Constructs the engine with the given seed and stream. Any seed and stream are valid. */
+	FORCEINLINE constexpr explicit FPCG64(uint64 InSeed = 0, uint64 InStream = 0)
+		: State(0), Increment((static_cast<uint128>(InStream) << 1) ^ DefaultIncrement)
+	{
+		Step();
+
+		State += InSeed;
+
+		Step();
+	}
+
+	/** @return The generated random number within the range of [0, 2^64). */
+	FORCEINLINE constexpr uint64 operator()()
+	{
+		Step();
+
+		const uint64 Result = static_cast<uint64>(State >> 64) ^ static_cast<uint64>(State);
+
+		return Math::RotateRight(Result, static_cast<int>(State >> 122));
+	}
+
+	NODISCARD FORCEINLINE static constexpr uint64 Min() { return 0; }
+	NODISCARD FORCEINLINE static constexpr uint64 Max() { return TNumericLimits<uint64>::Max(); }
+
+private:
+
+	static constexpr uint128 Multiplier       = static_cast<uint128>(0x2360ED051FC65DA4) << 64 | 0x4385DF649FCCF645;
+	// The increment must be odd for the full period, so the stream only flips the bits above the lowest one of the odd default.
+	static constexpr uint128 DefaultIncrement = static_cast<uint128>(0x5851F42D4C957F2D) << 64 | 0x14057B7EF767814F;
+
+	uint128 State;
+	uint128 Increment;
+
+	FORCEINLINE constexpr void Step() { State = State * Multiplier + Increment; }
+
+};
+
+#endif
+
+NAMESPACE_BEGIN(Math)
+
+/**
+ * @return The random number engine of the calling thread, which is seeded once per thread from the global seed
+ *         and a different stream for each thread, so the parallel computations generate the random numbers without contention.
+ */
+NODISCARD REDCRAFTUTILITY_API FXoshiro256StarStar& ThreadEngine();
+
+NAMESPACE_PRIVATE_BEGIN
+
+/** @return The high 64 bits of the 128-bit product of the given values, and the low 64 bits are stored in 'Low'. */
+FORCEINLINE constexpr uint64 MultiplyHigh(uint64 A, uint64 B, uint64& Low)
+{
+#	if PLATFORM_HAS_INT128
+	{
+		const uint128 Product = static_cast<uint128>(A) * B;
+
+		Low = static_cast<uint64>(Product);
+
+		return static_cast<uint64>(Product >> 64);
+	}
+#	else
+	{
+		const uint64 HighA = A >> 32;
+		const uint64 HighB = B >> 32;
+		const uint64 LowA  = static_cast<uint32>(A);
+		const uint64 LowB  = static_cast<uint32>(B);
+
+		const uint64 ProductHigh    = HighA * HighB;
+		const uint64 ProductMiddleA = HighA * LowB;
+		const uint64 ProductMiddleB = HighB * LowA;
+		const uint64 ProductLow     = LowA  * LowB;
+
+		const uint64 Temp = ProductLow + (ProductMiddleA << 32);
+
+		uint64 Carry = Temp < ProductLow;
+
+		Low = Temp + (ProductMiddleB << 32);
+
+		Carry += Low < Temp;
+
+		return ProductHigh + (ProductMiddleA >> 32) + (ProductMiddleB >> 32) + Carry;
+	}
+#	endif
+}
+
+NAMESPACE_PRIVATE_END
+
+/** @return The generated random number within the range of [0, A), which is unbiased by Lemire's multiply-and-reject method. */
+template <CUniformRandomBitGenerator G, CIntegral T>
+NODISCARD FORCEINLINE constexpr T Rand(G& Engine, T A)
+{
+	using FUnsignedT = TMakeUnsigned<T>;
+
+	if (A <= 0) return 0;
+
+	const uint64 Bound = static_cast<FUnsignedT>(A);
+
+	if constexpr (sizeof(T) <= 4 && CSameAs<TInvokeResult<G&>, uint32>)
+	{
+		uint64 Product = static_cast<uint64>(Engine()) * Bound;
+
+		if (static_cast<uint32>(Product) < Bound) UNLIKELY
+		{
+			const uint32 Threshold = static_cast<uint32>(-static_cast<uint32>(Bound) % static_cast<uint32>(Bound));
+
+			while (static_cast<uint32>(Product) < Threshold) Product = static_cast<uint64>(Engine()) * Bound;
+		}
+
+		return static_cast<T>(Product >> 32);
+	}
+
+	else
+	{
+		auto Generate = [&Engine]() -> uint64
+		{
+			if constexpr (CSameAs<TInvokeResult<G&>, uint64>) return Engine();
+			else return static_cast<uint64>(Engine()) << 32 | Engine();
+		};
+
+		uint64 Low;
+
+		uint64 High = NAMESPACE_PRIVATE::MultiplyHigh(Generate(), Bound, Low);
+
+		if (Low < Bound) UNLIKELY
+		{
+			const uint64 Threshold = -Bound % Bound;
+
+			while (Low < Threshold) High = NAMESPACE_PRIVATE::MultiplyHigh(Generate(), Bound, Low);
+		}
+
+		return static_cast<T>(High);
+	}
+}
+
+/**
+ * @return The generated random number within the range of [0, A), which has the full precision of the 53-bit or 24-bit mantissa,
+ *         and at most 63 bits of precision for the wider floating-point types, since the random bits are shifted within 64 bits.
+ */
+template <CUniformRandomBitGenerator G, CFloatingPoint T>
+NODISCARD FORCEINLINE constexpr T Rand(G& Engine, T A)
+{
+	constexpr int Digits = TNumericLimits<T>::Digits < 63 ? TNumericLimits<T>::Digits : 63;
+
+	uint64 Bits;
+
+	if constexpr (CSameAs<TInvokeResult<G&>, uint64>) Bits = Engine();
+	else Bits = static_cast<uint64>(Engine()) << 32 | Engine();
+
+	return static_cast<T>(Bits >> (64 - Digits)) * (A / static_cast<T>(static_cast<uint64>(1) << Digits));
+}
+
+/** @return The generated random number within the range of [A, B). */
+template <CUniformRandomBitGenerator G, CArithmetic T, CArithmetic U> requires (CCommonType<T, U>)
+NODISCARD FORCEINLINE constexpr auto RandWithin(G& Engine, T A, U B)
+{
+	using FCommonT = TCommonType<T, U>;
+
+	if (A == B) return static_cast<FCommonT>(A);
+
+	if (A > B) return static_cast<FCommonT>(B + Math::Rand(Engine, A - B));
+
+	return static_cast<FCommonT>(A + Math::Rand(Engine, B - A));
+}
+
+NAMESPACE_END(Math)
+
 NAMESPACE_MODULE_END(Utility)
 NAMESPACE_MODULE_END(Redcraft)
 NAMESPACE_REDCRAFT_END
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Ranges/View.h"
+#include "Ranges/Pipe.h"
+#include "Ranges/Utility.h"
+#include "Ranges/Conversion.h"
+#include "Ranges/MoveView.h"
+#include "Ranges/FilterView.h"
+#include "Ranges/TransformView.h"
+#include "Templates/Invoke.h"
+#include "Templates/Utility.h"
+#include "Containers/Array.h"
+#include "Algorithms/ExecutionPolicy.h"
+#include "TypeTraits/TypeTraits.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_BEGIN(Ranges)
+
+NAMESPACE_PRIVATE_BEGIN
+
+template <typename R>
+using TParallelChunk = TRangeView<TRangeIterator<R>>;
+
+template <typename R, typename F>
+using TParallelResult = TInvokeResult<const TRemoveCVRef<F>&, TParallelChunk<R>>;
+
+// The views that treat each element independently, so the result of the whole range is the concatenation of the results of the chunks.
+template <typename V, typename U            > struct TIsElementWiseView                             : FFalse                   { };
+template <typename V                        > struct TIsElementWiseView<V, V>                       : FTrue                    { };
+template <typename V, typename U            > struct TIsElementWiseView<TMoveView<V>, U>            : TIsElementWiseView<V, U> { };
+template <typename V, typename P, typename U> struct TIsElementWiseView<TFilterView<V, P>, U>       : TIsElementWiseView<V, U> { };
+template <typename V, typename F, typename U> struct TIsElementWiseView<TTransformView<V, F>, U>    : TIsElementWiseView<V, U> { };
+
+template <typename R, typename F>
+concept CElementWisePipeline = TIsElementWiseView<TRemoveCVRef<TParallelResult<R, F>>, TParallelChunk<R>>::Value;
+
+template <typename R, typename F>
+concept CParallelPipeline = CRandomAccessRange<R> && CSizedRange<R>
+	&& CInvocable<const TRemoveCVRef<F>&, TParallelChunk<R>> && CInputRange<TParallelResult<R, F>>;
+
+NAMESPACE_PRIVATE_END
+
+/**
+ * Evaluates the pipeline over the random-access range in parallel, and collects the elements into the container.
+ * The result is the same as 'Range | Pipeline | Ranges::To<C>()'. If the pipeline only consists of the element-wise views,
+ * i.e. filter, transform and move views, the range is split into the chunks, each chunk is piped through the same pipeline
+ * on the worker pool, and the elements of the chunks are appended to the container in order. Otherwise, e.g. the pipeline
+ * contains TakeView or TakeWhileView that depends on the preceding elements, the whole range is evaluated sequentially.
+ * The pipeline is shared by the workers and invoked concurrently, so it should be safe to invoke through the const reference.
+ *
+ * @param Range    - The random-access range to split into the chunks.
+ * @param Pipeline - The range adaptor closure or the function that creates the range from each chunk.
+ *
+ * @return The container of the elements of the pipeline.
+ */
+template <typename C, typename R, typename F> requires (!CView<C> && NAMESPACE_PRIVATE::CParallelPipeline<R, F>
+	&& CDefaultConstructible<C> && CAppendableContainer<C, TRangeElement<NAMESPACE_PRIVATE::TParallelResult<R, F>>&&>)
+NODISCARD C Parallel(R&& Range, F&& Pipeline)
+{
+	using FElementType = TRangeElement<NAMESPACE_PRIVATE::TParallelResult<R, F>>;
+
+	const TRemoveCVRef<F>& Closure = Pipeline;
+
+	const size_t Num = Ranges::Num(Range);
+
+	const size_t ChunkNum = NAMESPACE_PRIVATE::CElementWisePipeline<R, F> ? NAMESPACE_REDCRAFT::NAMESPACE_PRIVATE::ParallelChunkNum(Num) : 1;
+
+	// The chunks are the same as the parallel algorithms, which depend only on the number of elements,
+	// and the pipeline that is not element-wise is evaluated over the whole range as a single chunk.
+	auto Chunk = [&Range, Num, ChunkNum](size_t Index)
+	{
+		const size_t First = NAMESPACE_REDCRAFT::NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Index);
+		const size_t Last  = NAMESPACE_REDCRAFT::NAMESPACE_PRIVATE::ParallelChunkBegin(Num, ChunkNum, Index + 1);
+
+		return Ranges::View(Ranges::Begin(Range) + First, Ranges::Begin(Range) + Last);
+	};
+
+	if (ChunkNum == 1) return Ranges::To<C>(Invoke(Closure, Chunk(0)));
+
+	TArray<TArray<FElementType>> Buffers(ChunkNum);
+
+	Execution::ParallelFor(ChunkNum, [&Buffers, &Closure, &Chunk](size_t Index)
+	{
+		Buffers[Index] = Ranges::To<TArray<FElementType>>(Invoke(Closure, Chunk(Index)));
+	});
+
+	C Result;
+
+	if constexpr (CReservableContainer<C>)
+	{
+		size_t Total = 0;
+
+		for (const TArray<FElementType>& Buffer : Buffers) Total += Buffer.Num();
+
+		Result.Reserve(Total);
+	}
+
+	for (TArray<FElementType>& Buffer : Buffers)
+	{
+		for (FElementType& Element : Buffer) Ranges::AppendTo(Result, MoveTemp(Element));
+	}
+
+	return Result;
+}
+
+/**
+ * Evaluates the pipeline over the random-access range in parallel, and collects the elements into the container.
+ *
+ * @param Range    - The random-access range to split into the chunks.
+ * @param Pipeline - The range adaptor closure or the function that creates the range from each chunk.
+ *
+ * @return The container of the elements of the pipeline, which is an array by default.
+ */
+template <template <typename...> typename C = TArray, typename R, typename F> requires (NAMESPACE_PRIVATE::CParallelPipeline<R, F>
+	&& requires { Ranges::Parallel<C<TRangeElement<NAMESPACE_PRIVATE::TParallelResult<R, F>>>>(DeclVal<R>(), DeclVal<F>()); })
+NODISCARD FORCEINLINE auto Parallel(R&& Range, F&& Pipeline)
+{
+	return Ranges::Parallel<C<TRangeElement<NAMESPACE_PRIVATE::TParallelResult<R, F>>>>(Forward<R>(Range), Forward<F>(Pipeline));
+}
+
+/** Creates the closure that evaluates the pipeline over the random-access range in parallel, and collects the elements into the container. */
+template <typename C, typename F> requires (!CView<C> && CMoveConstructible<TDecay<F>>)
+NODISCARD FORCEINLINE constexpr auto Parallel(F&& Pipeline)
+{
+	using FClosure = decltype([]<typename R, typename G> requires (requires { Ranges::Parallel<C>(DeclVal<R>(), DeclVal<G>()); }) (R&& Range, G&& Pipeline)
+	{
+		return Ranges::Parallel<C>(Forward<R>(Range), Forward<G>(Pipeline));
+	});
+
+	return TAdaptorClosure<FClosure, TDecay<F>>(Forward<F>(Pipeline));
+}
+
+/** Creates the closure that evaluates the pipeline over the random-access range in parallel, and collects the elements into the container. */
+template <template <typename...> typename C = TArray, typename F> requires (CMoveConstructible<TDecay<F>>)
+NODISCARD FORCEINLINE constexpr auto Parallel(F&& Pipeline)
+{
+	using FClosure = decltype([]<typename R, typename G> requires (requires { Ranges::Parallel<C>(DeclVal<R>(), DeclVal<G>()); }) (R&& Range, G&& Pipeline)
+	{
+		return Ranges::Parallel<C>(Forward<R>(Range), Forward<G>(Pipeline));
+	});
+
+	return TAdaptorClosure<FClosure, TDecay<F>>(Forward<F>(Pipeline));
+}
+
+NAMESPACE_END(Ranges)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -12,3 +12,4 @@
 #include "Ranges/TransformView.h"
 #include "Ranges/TakeView.h"
 #include "Ranges/TakeWhileView.h"
+#include "Ranges/Parallel.h"
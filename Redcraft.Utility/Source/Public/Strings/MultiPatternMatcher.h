@@ -0,0 +1,387 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Invoke.h"
+#include "Templates/Optional.h"
+#include "Memory/Address.h"
+#include "Containers/Array.h"
+#include "Ranges/Utility.h"
+#include "Algorithms/BinarySearch.h"
+#include "Algorithms/Sort.h"
+#include "Algorithms/Mutation.h"
+#include "Strings/Char.h"
+#include "Strings/StringView.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+template <typename T>  struct TPatternView    { using Type = TArrayView<const T>; };
+template <CCharType T> struct TPatternView<T> { using Type = TStringView<T>;      };
+
+NAMESPACE_PRIVATE_END
+
+/**
+ * The precompiled matcher that finds all occurrences of multiple patterns in a single pass, which is an Aho-Corasick automaton
+ * converted to a deterministic finite automaton, so each code unit of the text takes a single table lookup.
+ * The code units that do not appear in the patterns share a single equivalence class, which compresses the transition table,
+ * and the accepting states are numbered after the others, so the scanning loop checks for matches with a single comparison.
+ * The empty patterns never match. The matcher works on the code units, so the patterns and the text must use the same encoding.
+ */
+template <typename T> requires (CCharType<T> || CSameAs<T, uint8>)
+class TMultiPatternMatcher
+{
+public:
+
+	using FElementType = T;
+
+	/** The occurrence of a pattern in the text. */
+	struct FMatch
+	{
+		/** The index of the matched pattern in the patterns that build the matcher. */
+		size_t Pattern;
+
+		/** The index of the first code unit of the occurrence in the text. */
+		size_t Position;
+
+		/** The number of code units of the occurrence. */
+		size_t Length;
+	};
+
+	/** Default constructor. Constructs a matcher that matches nothing. */
+	TMultiPatternMatcher() { Build(TArray<TArrayView<const T>>()); }
+
+	/** Constructs the matcher from the range of patterns, each of which is a contiguous range of code units. */
+	template <CInputRange R> requires (CContiguousRange<TRangeReference<R>> && CSameAs<TRemoveCV<TRangeElement<TRangeReference<R>>>, T>)
+	FORCEINLINE explicit TMultiPatternMatcher(R&& Patterns) { Build(Forward<R>(Patterns)); }
+
+	/** Constructs the matcher from the initializer list of patterns, which are the string views for the character types. */
+	FORCEINLINE TMultiPatternMatcher(initializer_list<typename NAMESPACE_PRIVATE::TPatternView<T>::Type> Patterns) { Build(Patterns); }
+
+	/** Rebuilds the matcher from the range of patterns, each of which is a contiguous range of code units. */
+	template <CInputRange R> requires (CContiguousRange<TRangeReference<R>> && CSameAs<TRemoveCV<TRangeElement<TRangeReference<R>>>, T>)
+	void Build(R&& Patterns)
+	{
+		Lengths.Reset();
+		NextPatterns.Reset();
+
+		TArray<TArrayView<const T>> Views;
+
+		for (auto&& Pattern : Patterns)
+		{
+			Views.PushBack(TArrayView<const T>(Ranges::Begin(Pattern), Ranges::Num(Pattern)));
+
+			Lengths.PushBack(Ranges::Num(Pattern));
+		}
+
+		checkf(Views.Num() < None, TEXT("Too many patterns. The number of patterns must be less than 2^32 - 1."));
+
+		BuildClasses(Views);
+
+		// The trie of the patterns, where the zero transitions are the missing edges since the root is never a child.
+		TArray<uint32> Delta;
+		TArray<uint32> OwnPatterns;
+
+		Delta.SetNum(ClassNum);
+		OwnPatterns.PushBack(None);
+
+		for (uint32 Index = 0; Index != ClassNum; ++Index) Delta[Index] = 0;
+
+		NextPatterns.SetNum(Views.Num());
+
+		// The patterns are inserted in reverse order, so the same patterns are chained in order.
+		for (size_t Index = Views.Num(); Index != 0; --Index)
+		{
+			const TArrayView<const T>& Pattern = Views[Index - 1];
+
+			if (Pattern.IsEmpty())
+			{
+				NextPatterns[Index - 1] = None;
+
+				continue;
+			}
+
+			uint32 State = 0;
+
+			for (T Unit : Pattern)
+			{
+				uint32& Next = Delta[State * ClassNum + ClassOf(Unit)];
+
+				if (Next == 0)
+				{
+					Next = static_cast<uint32>(OwnPatterns.Num());
+
+					OwnPatterns.PushBack(None);
+
+					for (uint32 Class = 0; Class != ClassNum; ++Class) Delta.PushBack(0);
+				}
+
+				State = Delta[State * ClassNum + ClassOf(Unit)];
+			}
+
+			NextPatterns[Index - 1] = OwnPatterns[State];
+
+			OwnPatterns[State] = static_cast<uint32>(Index - 1);
+		}
+
+		const uint32 StateNum = static_cast<uint32>(OwnPatterns.Num());
+
+		checkf(static_cast<uint64>(StateNum) * ClassNum < None, TEXT("Too many patterns. The transition table must be less than 2^32 - 1 entries."));
+
+		// Completes the trie to the automaton in breadth-first order, where the failure state of each state has been completed.
+		TArray<uint32> Failures;
+		TArray<uint32> OutputLinks;
+		TArray<uint32> Queue;
+
+		Failures   .SetNum(StateNum);
+		OutputLinks.SetNum(StateNum);
+
+		Failures[0]    = 0;
+		OutputLinks[0] = None;
+
+		Queue.Reserve(StateNum);
+		Queue.PushBack(0);
+
+		for (size_t Front = 0; Front != Queue.Num(); ++Front)
+		{
+			const uint32 State = Queue[Front];
+
+			for (uint32 Class = 0; Class != ClassNum; ++Class)
+			{
+				uint32& Next = Delta[State * ClassNum + Class];
+
+				const uint32 Fallback = State == 0 ? 0 : Delta[Failures[State] * ClassNum + Class];
+
+				if (Next == 0) Next = Fallback;
+
+				else
+				{
+					Failures[Next] = Fallback;
+
+					OutputLinks[Next] = OwnPatterns[Fallback] != None ? Fallback : OutputLinks[Fallback];
+
+					Queue.PushBack(Next);
+				}
+			}
+		}
+
+		// Numbers the accepting states after the others and premultiplies the state numbers by the number of classes.
+		TArray<uint32> Renumber;
+
+		Renumber.SetNum(StateNum);
+
+		uint32 AcceptStateBegin = 0;
+
+		for (uint32 State = 0; State != StateNum; ++State)
+		{
+			if (OwnPatterns[State] == None && OutputLinks[State] == None) Renumber[State] = AcceptStateBegin++;
+		}
+
+		uint32 AcceptStateEnd = AcceptStateBegin;
+
+		for (uint32 State = 0; State != StateNum; ++State)
+		{
+			if (OwnPatterns[State] != None || OutputLinks[State] != None) Renumber[State] = AcceptStateEnd++;
+		}
+
+		AcceptBegin = AcceptStateBegin * ClassNum;
+
+		Transitions.SetNum(StateNum * ClassNum);
+
+		FirstPatterns.SetNum(StateNum - AcceptStateBegin);
+		AcceptLinks  .SetNum(StateNum - AcceptStateBegin);
+
+		for (uint32 State = 0; State != StateNum; ++State)
+		{
+			const uint32 NewState = Renumber[State];
+
+			for (uint32 Class = 0; Class != ClassNum; ++Class)
+			{
+				Transitions[NewState * ClassNum + Class] = Renumber[Delta[State * ClassNum + Class]] * ClassNum;
+			}
+
+			if (NewState >= AcceptStateBegin)
+			{
+				FirstPatterns[NewState - AcceptStateBegin] = OwnPatterns[State];
+				AcceptLinks  [NewState - AcceptStateBegin] = OutputLinks[State] != None ? Renumber[OutputLinks[State]] - AcceptStateBegin : None;
+			}
+		}
+	}
+
+	/** @return The number of patterns of the matcher, including the empty patterns. */
+	NODISCARD FORCEINLINE size_t Num() const { return Lengths.Num(); }
+
+	/** @return The number of states of the automaton. */
+	NODISCARD FORCEINLINE size_t NumStates() const { return Transitions.Num() / ClassNum; }
+
+	/**
+	 * Finds all occurrences of the patterns in the text in a single pass, including the overlapping ones.
+	 * The occurrences are reported in order of their end positions, and the longer ones first for the same end position.
+	 * If the callback returns a boolean value, false stops the scanning.
+	 *
+	 * @param Text     - The contiguous range of code units to scan.
+	 * @param Callback - The callback to invoke with each occurrence as FMatch.
+	 *
+	 * @return The number of reported occurrences.
+	 */
+	template <CContiguousRange R, CInvocable<const FMatch&> F> requires (CSameAs<TRemoveCV<TRangeElement<R>>, T>)
+	size_t FindAll(R&& Text, F Callback) const
+	{
+		const T*     Data = ToAddress(Ranges::Begin(Text));
+		const size_t Size = Ranges::Num(Text);
+
+		const uint32* Table = Transitions.GetData();
+
+		size_t Result = 0;
+
+		uint32 State = 0;
+
+		for (size_t Index = 0; Index != Size; ++Index)
+		{
+			State = Table[State + ClassOf(Data[Index])];
+
+			if (State < AcceptBegin) LIKELY continue;
+
+			for (uint32 Accept = (State - AcceptBegin) / ClassNum; Accept != None; Accept = AcceptLinks[Accept])
+			{
+				for (uint32 Pattern = FirstPatterns[Accept]; Pattern != None; Pattern = NextPatterns[Pattern])
+				{
+					const FMatch Match = { Pattern, Index + 1 - Lengths[Pattern], Lengths[Pattern] };
+
+					++Result;
+
+					if constexpr (CBooleanTestable<TInvokeResult<F, const FMatch&>>)
+					{
+						if (!Invoke(Callback, Match)) return Result;
+					}
+
+					else Invoke(Callback, Match);
+				}
+			}
+		}
+
+		return Result;
+	}
+
+	/**
+	 * Finds the occurrence of the patterns that ends first in the text, and the longest one for the same end position.
+	 *
+	 * @param Text - The contiguous range of code units to scan.
+	 *
+	 * @return The first occurrence if found, or an invalid optional otherwise.
+	 */
+	template <CContiguousRange R> requires (CSameAs<TRemoveCV<TRangeElement<R>>, T>)
+	NODISCARD TOptional<FMatch> FindFirst(R&& Text) const
+	{
+		TOptional<FMatch> Result;
+
+		Ignore = FindAll(Forward<R>(Text), [&Result](const FMatch& Match) { Result = Match; return false; });
+
+		return Result;
+	}
+
+	/** @return true if the text contains any pattern, false otherwise. */
+	template <CContiguousRange R> requires (CSameAs<TRemoveCV<TRangeElement<R>>, T>)
+	NODISCARD FORCEINLINE bool Contains(R&& Text) const
+	{
+		return FindFirst(Forward<R>(Text)).IsValid();
+	}
+
+private:
+
+	static constexpr uint32 None = static_cast<uint32>(-1);
+
+	using FUnsignedType = TMakeUnsigned<T>;
+
+	/** The classes of the code units less than 256, and the sorted code units not less than 256 that appear in the patterns. */
+	uint16                ByteClasses[256];
+	TArray<FUnsignedType> WideUnits;
+
+	uint32 ClassNum;
+	uint32 AcceptBegin;
+
+	/** The transition table of the automaton, which is indexed by the premultiplied state plus the class of the code unit. */
+	TArray<uint32> Transitions;
+
+	/** The first pattern ending at each accepting state and the next accepting state in the suffix chain. */
+	TArray<uint32> FirstPatterns;
+	TArray<uint32> AcceptLinks;
+
+	/** The length of each pattern and the next pattern which is the same as it. */
+	TArray<size_t> Lengths;
+	TArray<uint32> NextPatterns;
+
+	void BuildClasses(const TArray<TArrayView<const T>>& Views)
+	{
+		for (uint16& Class : ByteClasses) Class = 0;
+
+		WideUnits.Reset();
+
+		bool bUsedBytes[256] = { };
+
+		for (const TArrayView<const T>& Pattern : Views)
+		{
+			for (T Unit : Pattern)
+			{
+				const FUnsignedType Value = static_cast<FUnsignedType>(Unit);
+
+				if (Value < 256) bUsedBytes[Value] = true;
+
+				else WideUnits.PushBack(Value);
+			}
+		}
+
+		// The class zero is shared by all the code units that do not appear in the patterns.
+		ClassNum = 1;
+
+		for (size_t Value = 0; Value != 256; ++Value)
+		{
+			if (bUsedBytes[Value]) ByteClasses[Value] = static_cast<uint16>(ClassNum++);
+		}
+
+		if constexpr (sizeof(T) > 1)
+		{
+			Algorithms::Sort(WideUnits);
+
+			WideUnits.SetNum(Algorithms::Unique(WideUnits) - WideUnits.Begin());
+
+			ClassNum += static_cast<uint32>(WideUnits.Num());
+		}
+	}
+
+	NODISCARD FORCEINLINE uint32 ClassOf(T Unit) const
+	{
+		const FUnsignedType Value = static_cast<FUnsignedType>(Unit);
+
+		if constexpr (sizeof(T) == 1) return ByteClasses[Value];
+
+		else
+		{
+			if (Value < 256) LIKELY return ByteClasses[Value];
+
+			const auto Iter = Algorithms::LowerBound(WideUnits, Value);
+
+			if (Iter == WideUnits.End() || *Iter != Value) return 0;
+
+			return ClassNum - static_cast<uint32>(WideUnits.Num()) + static_cast<uint32>(Iter - WideUnits.Begin());
+		}
+	}
+
+};
+
+using FMultiPatternMatcher        = TMultiPatternMatcher<char>;
+using FWMultiPatternMatcher       = TMultiPatternMatcher<wchar>;
+using FU8MultiPatternMatcher      = TMultiPatternMatcher<u8char>;
+using FU16MultiPatternMatcher     = TMultiPatternMatcher<u16char>;
+using FU32MultiPatternMatcher     = TMultiPatternMatcher<u32char>;
+using FUnicodeMultiPatternMatcher = TMultiPatternMatcher<unicodechar>;
+using FByteMultiPatternMatcher    = TMultiPatternMatcher<uint8>;
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -4,6 +4,9 @@
 #include "Templates/Utility.h"
 #include "TypeTraits/PrimaryType.h"
 #include "TypeTraits/Miscellaneous.h"
+#include "Memory/Memory.h"
+#include "Ranges/Utility.h"
+#include "Numerics/Bit.h"
 #include "Miscellaneous/AssertionMacros.h"
 
 NAMESPACE_REDCRAFT_BEGIN
@@ -94,23 +97,305 @@ FORCEINLINE constexpr size_t GetTypeHash(const T& A)
 	return GetTypeHash(A.hash_code());
 }
 
-/** Overloads the GetTypeHash algorithm for arrays. */
-template <typename T, size_t N> requires (requires(const T& A) { { GetTypeHash(A) } -> CSameAs<size_t>; })
-FORCEINLINE constexpr size_t GetTypeHash(T(&A)[N])
+NAMESPACE_PRIVATE_BEGIN
+
+// The multiply-mix bulk hash function in the style of wyhash, which consumes 48 bytes per iteration in three independent lanes.
+
+inline constexpr uint64 HashSecret[] = { 0xA0761D6478BD642Fu64, 0xE7037ED1A0B428DBu64, 0x8EBC6AF09C88C6E3u64, 0x589965CC75374CC3u64 };
+
+FORCEINLINE constexpr void HashMultiply(uint64& A, uint64& B)
 {
-	size_t Result = 3516520171;
+#	if PLATFORM_HAS_INT128
+	{
+		const uint128 Product = static_cast<uint128>(A) * B;
 
-	for (size_t Index = 0; Index < N; ++Index)
+		A = static_cast<uint64>(Product);
+		B = static_cast<uint64>(Product >> 64);
+	}
+#	else
 	{
-		Result = HashCombine(Result, GetTypeHash(A[Index]));
+		const uint64 HighA = A >> 32;
+		const uint64 HighB = B >> 32;
+		const uint64 LowA  = static_cast<uint32>(A);
+		const uint64 LowB  = static_cast<uint32>(B);
+
+		const uint64 ProductHigh    = HighA * HighB;
+		const uint64 ProductMiddleA = HighA * LowB;
+		const uint64 ProductMiddleB = HighB * LowA;
+		const uint64 ProductLow     = LowA  * LowB;
+
+		const uint64 Temp = ProductLow + (ProductMiddleA << 32);
+
+		uint64 Carry = Temp < ProductLow;
+
+		A = Temp + (ProductMiddleB << 32);
+
+		Carry += A < Temp;
+
+		B = ProductHigh + (ProductMiddleA >> 32) + (ProductMiddleB >> 32) + Carry;
 	}
+#	endif
+}
 
-	return Result;
+FORCEINLINE constexpr uint64 HashMix(uint64 A, uint64 B)
+{
+	HashMultiply(A, B);
+
+	return A ^ B;
+}
+
+/** Reads the bytes of the buffer in little-endian order. */
+struct FHashBytesReader
+{
+	const uint8* Data;
+
+	NODISCARD FORCEINLINE uint64 Load8(size_t Offset) const { return Data[Offset]; }
+
+	NODISCARD FORCEINLINE uint64 Load32(size_t Offset) const
+	{
+		uint32 Result;
+
+		Memory::Memcpy(&Result, Data + Offset, sizeof(uint32));
+
+		if constexpr (Math::EEndian::Native == Math::EEndian::Big) Result = Math::ByteSwap(Result);
+
+		return Result;
+	}
+
+	NODISCARD FORCEINLINE uint64 Load64(size_t Offset) const
+	{
+		uint64 Result;
+
+		Memory::Memcpy(&Result, Data + Offset, sizeof(uint64));
+
+		if constexpr (Math::EEndian::Native == Math::EEndian::Big) Result = Math::ByteSwap(Result);
+
+		return Result;
+	}
+};
+
+/** Reads the object representation of the elements in the same order as FHashBytesReader, but in constant evaluation. */
+template <typename T>
+struct THashElementsReader
+{
+	const T* Data;
+
+	NODISCARD FORCEINLINE constexpr uint64 Load8(size_t Offset) const
+	{
+		struct FBytes { uint8 Bytes[sizeof(T)]; };
+
+		return Math::BitCast<FBytes>(Data[Offset / sizeof(T)]).Bytes[Offset % sizeof(T)];
+	}
+
+	NODISCARD FORCEINLINE constexpr uint64 Load32(size_t Offset) const
+	{
+		uint64 Result = 0;
+
+		for (size_t Index = 0; Index != 4; ++Index) Result |= Load8(Offset + Index) << Index * 8;
+
+		return Result;
+	}
+
+	NODISCARD FORCEINLINE constexpr uint64 Load64(size_t Offset) const
+	{
+		return Load32(Offset) | Load32(Offset + 4) << 32;
+	}
+};
+
+template <typename FReader>
+NODISCARD constexpr uint64 HashBytesImpl(const FReader& Reader, size_t Count, uint64 Seed)
+{
+	Seed ^= HashMix(Seed ^ HashSecret[0], HashSecret[1]);
+
+	uint64 A;
+	uint64 B;
+
+	if (Count <= 16)
+	{
+		if (Count >= 4)
+		{
+			const size_t Offset = (Count >> 3) << 2;
+
+			A = Reader.Load32(0)         << 32 | Reader.Load32(Offset);
+			B = Reader.Load32(Count - 4) << 32 | Reader.Load32(Count - 4 - Offset);
+		}
+		else if (Count > 0)
+		{
+			A = Reader.Load8(0) << 16 | Reader.Load8(Count >> 1) << 8 | Reader.Load8(Count - 1);
+			B = 0;
+		}
+		else A = B = 0;
+	}
+	else
+	{
+		size_t Offset    = 0;
+		size_t Remaining = Count;
+
+		if (Remaining > 48)
+		{
+			uint64 SeedB = Seed;
+			uint64 SeedC = Seed;
+
+			do
+			{
+				Seed  = HashMix(Reader.Load64(Offset +  0) ^ HashSecret[1], Reader.Load64(Offset +  8) ^ Seed);
+				SeedB = HashMix(Reader.Load64(Offset + 16) ^ HashSecret[2], Reader.Load64(Offset + 24) ^ SeedB);
+				SeedC = HashMix(Reader.Load64(Offset + 32) ^ HashSecret[3], Reader.Load64(Offset + 40) ^ SeedC);
+
+				Offset    += 48;
+				Remaining -= 48;
+			}
+			while (Remaining > 48);
+
+			Seed ^= SeedB ^ SeedC;
+		}
+
+		while (Remaining > 16)
+		{
+			Seed = HashMix(Reader.Load64(Offset) ^ HashSecret[1], Reader.Load64(Offset + 8) ^ Seed);
+
+			Offset    += 16;
+			Remaining -= 16;
+		}
+
+		A = Reader.Load64(Offset + Remaining - 16);
+		B = Reader.Load64(Offset + Remaining -  8);
+	}
+
+	A ^= HashSecret[1];
+	B ^= Seed;
+
+	HashMultiply(A, B);
+
+	return HashMix(A ^ HashSecret[0] ^ Count, B ^ HashSecret[1]);
+}
+
+NAMESPACE_PRIVATE_END
+
+/** @return The hash value of the bytes in the buffer, which is much faster than combining the hash values of the bytes one by one. */
+NODISCARD FORCEINLINE size_t HashBytes(const void* Buffer, size_t Count, uint64 Seed = 0)
+{
+	return static_cast<size_t>(NAMESPACE_PRIVATE::HashBytesImpl(NAMESPACE_PRIVATE::FHashBytesReader(static_cast<const uint8*>(Buffer)), Count, Seed));
+}
+
+/**
+ * The concept of the types whose equal values have the same object representation without padding,
+ * so that the contiguous elements can be hashed in bulk by HashBytes().
+ */
+template <typename T>
+concept CTriviallyHashable = CIntegral<TRemoveCV<T>> || CEnum<TRemoveCV<T>> || CPointer<TRemoveCV<T>> || (CFloatingPoint<TRemoveCV<T>> && sizeof(T) <= 8);
+
+/**
+ * @return The hash value of the contiguous elements, computed in bulk by HashBytes() if the elements are trivially hashable,
+ *         otherwise by combining the hash values of the elements one by one.
+ */
+template <typename T> requires (requires(const T& A) { { GetTypeHash(A) } -> CSameAs<size_t>; })
+NODISCARD FORCEINLINE constexpr size_t HashRange(const T* Data, size_t Count)
+{
+	if constexpr (CTriviallyHashable<T>)
+	{
+		if (!IsConstantEvaluated()) return HashBytes(Data, Count * sizeof(T));
+
+		return static_cast<size_t>(NAMESPACE_PRIVATE::HashBytesImpl(NAMESPACE_PRIVATE::THashElementsReader<T>(Data), Count * sizeof(T), 0));
+	}
+
+	else
+	{
+		size_t Result = 0;
+
+		for (size_t Index = 0; Index != Count; ++Index)
+		{
+			Result = HashCombine(Result, GetTypeHash(Data[Index]));
+		}
+
+		return Result;
+	}
+}
+
+/** Overloads the GetTypeHash algorithm for arrays. */
+template <typename T, size_t N> requires (requires(const T& A) { { GetTypeHash(A) } -> CSameAs<size_t>; })
+FORCEINLINE constexpr size_t GetTypeHash(T(&A)[N])
+{
+	return HashRange(A, N);
 }
 
 template <typename T>
 concept CHashable = requires(const T& A) { { GetTypeHash(A) } -> CSameAs<size_t>; };
 
+/** @return The value with the avalanche finalizer applied, so that every bit of the input affects every bit of the result. */
+NODISCARD FORCEINLINE constexpr size_t HashFinalize(size_t A)
+{
+	uint64 Result = A;
+
+	Result ^= Result >> 30; Result *= 0xBF58476D1CE4E5B9u64;
+	Result ^= Result >> 27; Result *= 0x94D049BB133111EBu64;
+	Result ^= Result >> 31;
+
+	return static_cast<size_t>(Result);
+}
+
+/** @return The random seed that is generated once per process, which is used by FSeededHasher by default. */
+NODISCARD REDCRAFTUTILITY_API uint64 GetProcessHashSeed();
+
+/** The concept of the function objects that compute the hash values of T, which is the hasher template parameter of the hash containers. */
+template <typename H, typename T>
+concept CHasher = CDefaultConstructible<H> && CCopyable<H> && requires(const H& Hasher, const T& A) { { Hasher(A) } -> CSameAs<size_t>; };
+
+/** The hasher that calls GetTypeHash() directly, which is the fastest, but e.g. the integers hash to themselves and cluster in open addressing tables. */
+struct FDefaultHasher
+{
+	template <CHashable T>
+	NODISCARD FORCEINLINE constexpr size_t operator()(const T& A) const { return GetTypeHash(A); }
+};
+
+/** The hasher that applies HashFinalize() to GetTypeHash(), which spreads the clustered hash values at the cost of two multiplications. */
+struct FMixedHasher
+{
+	template <CHashable T>
+	NODISCARD FORCEINLINE constexpr size_t operator()(const T& A) const { return HashFinalize(GetTypeHash(A)); }
+};
+
+/**
+ * The hasher with a secret seed, which makes the hash values unpredictable to resist hash flooding attacks.
+ * The trivially hashable values and the contiguous ranges of them are hashed together with the seed by HashBytes(),
+ * while other values mix the seed into GetTypeHash(), so their resistance is limited by the collisions of GetTypeHash().
+ */
+class FSeededHasher
+{
+public:
+
+	/** Constructs the hasher with the process-wide random seed. */
+	FORCEINLINE FSeededHasher() : Seed(GetProcessHashSeed()) { }
+
+	/** Constructs the hasher with the given seed. */
+	FORCEINLINE constexpr explicit FSeededHasher(uint64 InSeed) : Seed(InSeed) { }
+
+	template <CHashable T>
+	NODISCARD FORCEINLINE size_t operator()(const T& A) const
+	{
+		if constexpr (CTriviallyHashable<T>) return HashBytes(&A, sizeof(T), Seed);
+
+		else if constexpr (requires { requires CContiguousRange<const T&> && CTriviallyHashable<TRangeElement<const T&>>; })
+		{
+			return HashBytes(Ranges::GetData(A), Ranges::Num(A) * sizeof(TRangeElement<const T&>), Seed);
+		}
+
+		else return static_cast<size_t>(NAMESPACE_PRIVATE::HashMix(GetTypeHash(A) ^ Seed, NAMESPACE_PRIVATE::HashSecret[1]));
+	}
+
+	/** @return The seed of the hasher. */
+	NODISCARD FORCEINLINE constexpr uint64 GetSeed() const { return Seed; }
+
+private:
+
+	uint64 Seed;
+
+};
+
+static_assert(CHasher<FDefaultHasher, int32>);
+static_assert(CHasher<FMixedHasher,   int32>);
+static_assert(CHasher<FSeededHasher,  int32>);
+
 NAMESPACE_MODULE_END(Utility)
 NAMESPACE_MODULE_END(Redcraft)
 NAMESPACE_REDCRAFT_END
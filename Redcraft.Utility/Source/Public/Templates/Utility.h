@@ -8,6 +8,12 @@ NAMESPACE_REDCRAFT_BEGIN
 NAMESPACE_MODULE_BEGIN(Redcraft)
 NAMESPACE_MODULE_BEGIN(Utility)
 
+/** @return true if the call occurs within a constant-evaluated context, false otherwise. */
+FORCEINLINE constexpr bool IsConstantEvaluated()
+{
+	return NAMESPACE_STD::is_constant_evaluated();
+}
+
 /** Forms lvalue reference to const type of 'Ref'. */
 template <typename T>
 FORCEINLINE constexpr const T& AsConst(T& Ref)
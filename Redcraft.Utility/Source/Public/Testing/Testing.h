@@ -18,6 +18,7 @@ REDCRAFTUTILITY_API void TestMemory();
 REDCRAFTUTILITY_API void TestContainers();
 REDCRAFTUTILITY_API void TestString();
 REDCRAFTUTILITY_API void TestMiscellaneous();
+REDCRAFTUTILITY_API void TestThreading();
 
 NAMESPACE_END(Testing)
 
@@ -0,0 +1,450 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Memory/Memory.h"
+#include "Memory/Alignment.h"
+#include "Memory/MemoryOperator.h"
+#include "Numerics/Bit.h"
+#include "Templates/Invoke.h"
+#include "Templates/Utility.h"
+#include "Templates/Atomic.h"
+#include "Templates/Function.h"
+#include "Templates/Noncopyable.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+inline constexpr size_t EventRecordAlignment = 16;
+
+struct FEventRecordOps
+{
+	void(*Invoke)  (void*);
+	void(*Destruct)(void*);
+	void(*Relocate)(void*, void*);
+};
+
+template <typename T>
+inline constexpr FEventRecordOps EventRecordOps =
+{
+	[](void* Ptr) { Invoke(*static_cast<T*>(Ptr)); },
+	[](void* Ptr) { Memory::Destruct(static_cast<T*>(Ptr)); },
+	[](void* Target, void* Source)
+	{
+		new (Target) T(MoveTemp(*static_cast<T*>(Source)));
+
+		Memory::Destruct(static_cast<T*>(Source));
+	}
+};
+
+/** The header of the record in the ring buffer, followed by the callable object, the padding record at the end of the buffer has no operations. */
+struct alignas(EventRecordAlignment) FEventRecord
+{
+	const FEventRecordOps* Ops;
+
+	size_t Size;
+
+	NODISCARD FORCEINLINE void* GetPayload() { return this + 1; }
+};
+
+struct FEventRemoteNode
+{
+	TAtomic<FEventRemoteNode*> Next;
+
+	TUniqueFunction<void()> Function;
+};
+
+/** The intrusive MPSC queue of Dmitry Vyukov for the remote callbacks, the producers only exchange the head. */
+struct FEventRemoteQueue final : private FSingleton
+{
+	alignas(Memory::DestructiveInterference) TAtomic<FEventRemoteNode*> Head;
+	alignas(Memory::DestructiveInterference) FEventRemoteNode*          Tail;
+
+	FEventRemoteNode Stub;
+
+	FEventRemoteQueue()
+	{
+		Stub.Next.Store(nullptr, EMemoryOrder::Relaxed);
+
+		Head.Store(&Stub, EMemoryOrder::Relaxed);
+
+		Tail = &Stub;
+	}
+
+	~FEventRemoteQueue()
+	{
+		while (FEventRemoteNode* Node = Pop()) delete Node;
+	}
+
+	void Push(FEventRemoteNode* Node)
+	{
+		Node->Next.Store(nullptr, EMemoryOrder::Relaxed);
+
+		FEventRemoteNode* Previous = Head.Exchange(Node);
+
+		Previous->Next.Store(Node, EMemoryOrder::Release);
+	}
+
+	/** Pops the oldest node, or returns nullptr if the queue is empty or a producer has not linked its node yet. */
+	FEventRemoteNode* Pop()
+	{
+		FEventRemoteNode* Node = Tail;
+		FEventRemoteNode* Next = Node->Next.Load(EMemoryOrder::Acquire);
+
+		if (Node == &Stub)
+		{
+			if (Next == nullptr) return nullptr;
+
+			Tail = Next;
+
+			Node = Next;
+			Next = Next->Next.Load(EMemoryOrder::Acquire);
+		}
+
+		if (Next != nullptr)
+		{
+			Tail = Next;
+
+			return Node;
+		}
+
+		if (Node != Head.Load()) return nullptr;
+
+		// The node is the last one, so the stub is pushed behind it to keep the queue non-empty.
+		Push(&Stub);
+
+		Next = Node->Next.Load(EMemoryOrder::Acquire);
+
+		if (Next != nullptr)
+		{
+			Tail = Next;
+
+			return Node;
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Runs and deletes the nodes that are pushed before it is called, the nodes that are pushed during the pass are left in the queue.
+	 *
+	 * @return The number of the nodes that have been run.
+	 */
+	size_t Drain()
+	{
+		size_t Result = 0;
+
+		FEventRemoteNode* Last = Head.Load();
+
+		// If the head is the stub, it may have been pushed by the previous pop while the producers are pushing the nodes
+		// in front of it, so the pass ends when the stub reaches the tail instead of being treated as an empty queue.
+		while (Last != &Stub || Tail != &Stub)
+		{
+			FEventRemoteNode* Node = Pop();
+
+			if (Node == nullptr) break;
+
+			Node->Function();
+
+			const bool bLast = Node == Last;
+
+			delete Node;
+
+			++Result;
+
+			if (bLast) break;
+		}
+
+		return Result;
+	}
+};
+
+NAMESPACE_PRIVATE_END
+
+/**
+ * The single-thread event loop that runs the posted callbacks in order. The callbacks that are posted by the loop thread
+ * are stored inline in a contiguous ring buffer of the variable-size records, so the posting does not allocate once the buffer
+ * has grown to the working size, whatever the size of the captures. The callbacks that are posted by the other threads
+ * are passed through an intrusive MPSC queue, each of which allocates a node, and wake up the loop if it is waiting.
+ * All functions except PostRemote() and Stop() should only be called by the loop thread.
+ */
+class FEventLoop final : private FSingleton
+{
+public:
+
+	/** Constructs an empty event loop with the initial capacity of the ring buffer in bytes, which is rounded up to the power of two. */
+	explicit FEventLoop(size_t InCapacity = 4096)
+		: Capacity(Math::BitCeil(InCapacity > MinCapacity ? InCapacity : MinCapacity))
+	{
+		Buffer = static_cast<uint8*>(Memory::Malloc(Capacity, RecordAlignment));
+	}
+
+	/** Destructs the event loop and the pending callbacks without running them, the loop should not be running. */
+	~FEventLoop()
+	{
+		checkf(Running == nullptr, TEXT("The event loop is destroyed while running."));
+
+		for (size_t Cursor = Head; Cursor != Tail; )
+		{
+			FRecord* Record = At(Cursor);
+
+			if (Record->Ops != nullptr) Record->Ops->Destruct(Record->GetPayload());
+
+			Cursor += Record->Size;
+		}
+
+		Memory::Free(Buffer);
+	}
+
+	/**
+	 * Posts the callback to be run by the loop thread, which is moved into the ring buffer without allocation.
+	 * It can also be called by the running callbacks.
+	 *
+	 * @param Func - The callable object to be invoked without arguments.
+	 */
+	template <typename F> requires (CInvocable<TDecay<F>&> && CConstructibleFrom<TDecay<F>, F&&> && CMoveConstructible<TDecay<F>>
+		&& alignof(TDecay<F>) <= NAMESPACE_PRIVATE::EventRecordAlignment)
+	void Post(F&& Func)
+	{
+		using FCallable = TDecay<F>;
+
+		constexpr size_t Size = sizeof(FRecord) + Memory::Align(sizeof(FCallable), RecordAlignment);
+
+		FRecord* Record = Allocate(Size);
+
+		Record->Ops  = &NAMESPACE_PRIVATE::EventRecordOps<FCallable>;
+		Record->Size = Size;
+
+		new (Record->GetPayload()) FCallable(Forward<F>(Func));
+
+		++LocalNum;
+	}
+
+	/**
+	 * Posts the callback from any thread, which is passed through the MPSC queue and wakes up the loop if it is waiting.
+	 *
+	 * @param Func - The function to be invoked by the loop thread.
+	 */
+	void PostRemote(TUniqueFunction<void()> Func)
+	{
+		checkf(Func.IsValid(), TEXT("The callback should not be empty."));
+
+		FRemoteNode* Node = new FRemoteNode { nullptr, MoveTemp(Func) };
+
+		Remote.Push(Node);
+
+		Signal.FetchAdd(1);
+		Signal.Notify();
+	}
+
+	/**
+	 * Runs the remote callbacks and then the local callbacks that are pending when it is called, and returns without waiting.
+	 * The callbacks that are posted during the pass are run in the next pass.
+	 *
+	 * @return The number of the callbacks that have been run.
+	 */
+	size_t RunOnce()
+	{
+		checkf(Running == nullptr, TEXT("The event loop cannot be run recursively."));
+
+		// Only the remote callbacks that are posted before the pass are run, so the busy producers cannot starve the local callbacks.
+		size_t Result = Remote.Drain();
+
+		for (size_t Count = LocalNum; Count != 0; --Count)
+		{
+			RunRecord();
+
+			++Result;
+		}
+
+		return Result;
+	}
+
+	/** Runs the callbacks and waits for the new ones until Stop() is called, the stop request is consumed when it returns. */
+	void Run()
+	{
+		while (!bStopping.Exchange(false))
+		{
+			if (RunOnce() != 0) continue;
+
+			const uint32 Observed = Signal.Load();
+
+			// Rechecks after the signal is loaded, since the remote callbacks may be posted just before it.
+			if (LocalNum != 0 || Remote.Head.Load() != Remote.Tail || bStopping.Load()) continue;
+
+			Signal.Wait(Observed);
+		}
+	}
+
+	/** Requests the running loop to return after the current pass, which can be called from any thread. */
+	void Stop()
+	{
+		bStopping.Store(true);
+
+		Signal.FetchAdd(1);
+		Signal.Notify();
+	}
+
+	/** @return The number of the pending callbacks that are posted by the loop thread. */
+	NODISCARD FORCEINLINE size_t Num() const { return LocalNum; }
+
+	/** @return The capacity of the ring buffer in bytes. */
+	NODISCARD FORCEINLINE size_t Max() const { return Capacity; }
+
+private:
+
+	using FRecord     = NAMESPACE_PRIVATE::FEventRecord;
+	using FRemoteNode = NAMESPACE_PRIVATE::FEventRemoteNode;
+
+	static constexpr size_t RecordAlignment = NAMESPACE_PRIVATE::EventRecordAlignment;
+	static constexpr size_t MinCapacity     = 64;
+
+	// The offsets are increasing and wrapped by the capacity, so the used size is always 'Tail - Head'.
+	uint8* Buffer;
+	size_t Capacity;
+	size_t Head     = 0;
+	size_t Tail     = 0;
+	size_t LocalNum = 0;
+
+	// The running record is kept in the old buffer if the buffer grows while it is running, which is freed after it returns.
+	FRecord* Running       = nullptr;
+	uint8*   RetiredBuffer = nullptr;
+	bool     bDetached     = false;
+
+	NAMESPACE_PRIVATE::FEventRemoteQueue Remote;
+
+	alignas(Memory::DestructiveInterference) TAtomic<uint32> Signal    = 0;
+	alignas(Memory::DestructiveInterference) TAtomic<bool>   bStopping = false;
+
+	NODISCARD FORCEINLINE FRecord* At(size_t Offset) const { return reinterpret_cast<FRecord*>(Buffer + (Offset & (Capacity - 1))); }
+
+	/** Reserves the contiguous space of the record at the tail, the rest of the buffer is skipped by a padding record if it is not enough. */
+	FRecord* Allocate(size_t Size)
+	{
+		while (true)
+		{
+			const size_t Contiguous = Capacity - (Tail & (Capacity - 1));
+
+			const size_t Padding = Contiguous < Size ? Contiguous : 0;
+
+			if (Capacity - (Tail - Head) < Padding + Size) UNLIKELY
+			{
+				Grow(Size);
+
+				continue;
+			}
+
+			if (Padding != 0)
+			{
+				FRecord* Record = At(Tail);
+
+				Record->Ops  = nullptr;
+				Record->Size = Padding;
+
+				Tail += Padding;
+			}
+
+			FRecord* Record = At(Tail);
+
+			Tail += Size;
+
+			return Record;
+		}
+	}
+
+	/** Relocates the pending records to the beginning of a larger buffer, which also removes the padding records. */
+	void Grow(size_t Size)
+	{
+		size_t Cursor = Head;
+
+		// The running record that is still in the buffer stays where it is until it returns.
+		if (Running != nullptr && !bDetached) Cursor += Running->Size;
+
+		size_t NewCapacity = Capacity * 2;
+
+		while (NewCapacity < Tail - Cursor + Size) NewCapacity *= 2;
+
+		uint8* NewBuffer = static_cast<uint8*>(Memory::Malloc(NewCapacity, RecordAlignment));
+
+		size_t NewTail = 0;
+
+		for (; Cursor != Tail; )
+		{
+			FRecord* Record = At(Cursor);
+
+			if (Record->Ops != nullptr)
+			{
+				FRecord* NewRecord = reinterpret_cast<FRecord*>(NewBuffer + NewTail);
+
+				NewRecord->Ops  = Record->Ops;
+				NewRecord->Size = Record->Size;
+
+				Record->Ops->Relocate(NewRecord->GetPayload(), Record->GetPayload());
+
+				NewTail += Record->Size;
+			}
+
+			Cursor += Record->Size;
+		}
+
+		if (Running != nullptr && !bDetached)
+		{
+			RetiredBuffer = Buffer;
+
+			bDetached = true;
+		}
+
+		else Memory::Free(Buffer);
+
+		Buffer   = NewBuffer;
+		Capacity = NewCapacity;
+		Head     = 0;
+		Tail     = NewTail;
+	}
+
+	/** Runs and destructs the record at the head. */
+	void RunRecord()
+	{
+		FRecord* Record = At(Head);
+
+		while (Record->Ops == nullptr)
+		{
+			Head += Record->Size;
+
+			Record = At(Head);
+		}
+
+		Running = Record;
+
+		--LocalNum;
+
+		Record->Ops->Invoke(Record->GetPayload());
+
+		Record->Ops->Destruct(Record->GetPayload());
+
+		if (!bDetached) Head += Record->Size;
+
+		else
+		{
+			Memory::Free(RetiredBuffer);
+
+			RetiredBuffer = nullptr;
+
+			bDetached = false;
+		}
+
+		Running = nullptr;
+
+		// Rewinds the empty buffer, so the records are less likely to be wrapped.
+		if (Head == Tail) Head = Tail = 0;
+	}
+
+};
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -0,0 +1,568 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Invoke.h"
+#include "Templates/Meta.h"
+#include "Templates/Optional.h"
+#include "Templates/Tuple.h"
+#include "Templates/Function.h"
+#include "Templates/Atomic.h"
+#include "Templates/Noncopyable.h"
+#include "Memory/Allocators.h"
+#include "Memory/SharedPointer.h"
+#include "Containers/Array.h"
+#include "Ranges/Utility.h"
+#include "Threading/TaskScheduler.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+template <typename T>
+class TFuture;
+
+template <typename T, CMultipleAllocator Allocator>
+class TPromise;
+
+NAMESPACE_PRIVATE_BEGIN
+
+template <typename T> struct TIsTFuture             : FFalse { };
+template <typename T> struct TIsTFuture<TFuture<T>> : FTrue  { };
+
+/** The stored value of the void futures. */
+struct FFutureVoid { };
+
+template <typename T>
+using TFutureValue = TConditional<CVoid<T>, FFutureVoid, T>;
+
+template <typename T, typename F> struct TContinuationResult          { using FType = TInvokeResult<F, T>; };
+template <typename F>             struct TContinuationResult<void, F> { using FType = TInvokeResult<F>;    };
+
+enum class EFutureState : uint8
+{
+	Pending,
+	Continued,
+	Ready,
+};
+
+/**
+ * The shared state of a future and its promise, which is allocated once by the promise. The state is handed over by a single
+ * atomic exchange instead of a mutex, so setting the value and attaching the continuation never block each other.
+ */
+template <typename T>
+class TFutureState final : FSingleton
+{
+public:
+
+	using FValueType = TFutureValue<T>;
+
+	/** The value, which is written before the state becomes ready and is read only after that. */
+	TOptional<FValueType> Value;
+
+	TAtomic<uint32> RefCount = 1;
+
+	void(*Destroy)(TFutureState*);
+
+	NODISCARD FORCEINLINE bool IsReady() const { return State.Load(EMemoryOrder::Acquire) == EFutureState::Ready; }
+
+	void Wait()
+	{
+		// The worker threads run the other tasks instead of blocking, since the value may be set by a pending task.
+		if (Tasks::IsWorkerThread()) Tasks::RunUntil([this] { return IsReady(); });
+
+		else for (EFutureState Current; (Current = State.Load(EMemoryOrder::Acquire)) != EFutureState::Ready; )
+		{
+			State.Wait(Current, EMemoryOrder::Acquire);
+		}
+	}
+
+	template <typename... Ts>
+	void SetValue(Ts&&... Args)
+	{
+		Value.Emplace(Forward<Ts>(Args)...);
+
+		const EFutureState Old = State.Exchange(EFutureState::Ready, EMemoryOrder::AcquireRelease);
+
+		checkf(Old != EFutureState::Ready, TEXT("The value of the promise has already been set."));
+
+		if (Old == EFutureState::Continued) Dispatch();
+
+		else State.Notify(true);
+	}
+
+	/** Sets the continuation, which runs once the value is ready, inline on the setting thread or as a task on the task scheduler. */
+	void SetContinuation(TUniqueFunction<void()> InContinuation, bool bInInline)
+	{
+		Continuation = MoveTemp(InContinuation);
+
+		bInline = bInInline;
+
+		EFutureState Expected = EFutureState::Pending;
+
+		if (!State.CompareExchange(Expected, EFutureState::Continued, EMemoryOrder::AcquireRelease, EMemoryOrder::Acquire)) Dispatch();
+	}
+
+	FORCEINLINE void AddRef() { RefCount.FetchAdd(1, EMemoryOrder::Relaxed); }
+
+	FORCEINLINE void Release()
+	{
+		if (RefCount.FetchSub(1, EMemoryOrder::AcquireRelease) == 1) Destroy(this);
+	}
+
+private:
+
+	TAtomic<EFutureState> State = EFutureState::Pending;
+
+	bool bInline;
+
+	TUniqueFunction<void()> Continuation;
+
+	void Dispatch()
+	{
+		// The continuation may release the last reference to the state, so it is moved out before being invoked.
+		TUniqueFunction<void()> Function = MoveTemp(Continuation);
+
+		if (bInline) Function();
+
+		else Tasks::Submit(MoveTemp(Function));
+	}
+
+};
+
+NAMESPACE_PRIVATE_END
+
+/** A concept specifies the type is a TFuture. */
+template <typename T>
+concept CTFuture = NAMESPACE_PRIVATE::TIsTFuture<TRemoveCV<T>>::Value;
+
+/**
+ * The future is the consumer end of the asynchronous value, which is set by the associated promise.
+ * The future is movable only, and it is consumed by Get() or Then(), which make it invalid.
+ */
+template <typename T>
+class TFuture final : private FNoncopyable
+{
+public:
+
+	using FValueType = T;
+
+	/** Constructs an invalid future. */
+	FORCEINLINE TFuture() : State(nullptr) { }
+
+	FORCEINLINE TFuture(TFuture&& InValue) : State(Exchange(InValue.State, nullptr)) { }
+
+	FORCEINLINE TFuture& operator=(TFuture&& InValue)
+	{
+		if (&InValue == this) UNLIKELY return *this;
+
+		if (State != nullptr) State->Release();
+
+		State = Exchange(InValue.State, nullptr);
+
+		return *this;
+	}
+
+	FORCEINLINE ~TFuture() { if (State != nullptr) State->Release(); }
+
+	/** @return true if the future refers to a shared state, false otherwise. */
+	NODISCARD FORCEINLINE bool IsValid() const { return State != nullptr; }
+
+	/** @return true if the value of the future has been set, false otherwise. */
+	NODISCARD FORCEINLINE bool IsReady() const
+	{
+		checkf(IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		return State->IsReady();
+	}
+
+	/** Waits until the value is set. The worker threads of the task scheduler run the other tasks while waiting. */
+	FORCEINLINE void Wait() const
+	{
+		checkf(IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		State->Wait();
+	}
+
+	/** Waits until the value is set and moves the value out, which makes the future invalid. */
+	NODISCARD T Get()
+	{
+		Wait();
+
+		NAMESPACE_PRIVATE::TFutureState<T>* Temp = Exchange(State, nullptr);
+
+		if constexpr (CVoid<T>) Temp->Release();
+
+		else
+		{
+			T Result = MoveTemp(*Temp->Value);
+
+			Temp->Release();
+
+			return Result;
+		}
+	}
+
+	/**
+	 * Attaches the continuation to the future, which is invoked with the value as a task on the task scheduler
+	 * once the value is set, without blocking any thread. The future becomes invalid.
+	 *
+	 * @param Func - The continuation to invoke with the value, or with nothing for the void futures.
+	 *
+	 * @return The future of the result of the continuation.
+	 */
+	template <typename F> requires ((CVoid<T> && CInvocable<TDecay<F>>) || (!CVoid<T> && CInvocable<TDecay<F>, T>))
+	NODISCARD auto Then(F&& Func)
+	{
+		using FResultType = typename NAMESPACE_PRIVATE::TContinuationResult<T, TDecay<F>>::FType;
+
+		checkf(IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		TPromise<FResultType, FHeapAllocator> Promise;
+
+		TFuture<FResultType> Result = Promise.GetFuture();
+
+		NAMESPACE_PRIVATE::TFutureState<T>* Temp = Exchange(State, nullptr);
+
+		Temp->SetContinuation([Temp, Promise = MoveTemp(Promise), Func = Forward<F>(Func)]() mutable
+		{
+			if constexpr (CVoid<T> && CVoid<FResultType>) { Invoke(Func); Promise.SetValue(); }
+
+			else if constexpr (CVoid<T>) Promise.SetValue(Invoke(Func));
+
+			else if constexpr (CVoid<FResultType>) { Invoke(Func, MoveTemp(*Temp->Value)); Promise.SetValue(); }
+
+			else Promise.SetValue(Invoke(Func, MoveTemp(*Temp->Value)));
+
+			Temp->Release();
+		}, false);
+
+		return Result;
+	}
+
+private:
+
+	NAMESPACE_PRIVATE::TFutureState<T>* State;
+
+	FORCEINLINE explicit TFuture(NAMESPACE_PRIVATE::TFutureState<T>* InState) : State(InState) { }
+
+	template <typename U, CMultipleAllocator A> friend class TPromise;
+
+	template <typename... Ts> requires (sizeof...(Ts) > 0 && (!CVoid<Ts> && ...))
+	friend TFuture<TTuple<Ts...>> WhenAll(TFuture<Ts>... Futures);
+
+	template <CInputRange R> requires (CTFuture<TRangeElement<R>>)
+	friend auto WhenAll(R&& Futures);
+
+	template <CInputRange R> requires (CTFuture<TRangeElement<R>>)
+	friend auto WhenAny(R&& Futures);
+
+};
+
+/**
+ * The promise is the producer end of the asynchronous value, which allocates the shared state once by the allocator.
+ * The value should be set before the promise is destroyed if the future is still referenced.
+ */
+template <typename T, CMultipleAllocator Allocator = FHeapAllocator>
+class TPromise final : private FNoncopyable
+{
+private:
+
+	using FState = NAMESPACE_PRIVATE::TFutureState<T>;
+
+	using FStateAllocator = typename Allocator::template TForElementType<FState>;
+
+public:
+
+	using FValueType = T;
+
+	/** Constructs the promise with a new shared state. */
+	TPromise() : bIsRetrieved(false)
+	{
+		FStateAllocator StateAllocator;
+
+		State = new (StateAllocator.Allocate(1)) FState();
+
+		State->Destroy = [](FState* InState)
+		{
+			FStateAllocator StateAllocator;
+
+			InState->~FState();
+
+			StateAllocator.Deallocate(InState);
+		};
+	}
+
+	FORCEINLINE TPromise(TPromise&& InValue) : State(Exchange(InValue.State, nullptr)), bIsRetrieved(InValue.bIsRetrieved) { }
+
+	FORCEINLINE TPromise& operator=(TPromise&& InValue)
+	{
+		if (&InValue == this) UNLIKELY return *this;
+
+		Reset();
+
+		State        = Exchange(InValue.State, nullptr);
+		bIsRetrieved = InValue.bIsRetrieved;
+
+		return *this;
+	}
+
+	FORCEINLINE ~TPromise() { Reset(); }
+
+	/** @return true if the promise refers to a shared state, false otherwise. */
+	NODISCARD FORCEINLINE bool IsValid() const { return State != nullptr; }
+
+	/** @return The future associated with the promise, which can be retrieved only once. */
+	NODISCARD TFuture<T> GetFuture()
+	{
+		checkf(IsValid(), TEXT("Read access violation. Please check IsValid()."));
+		checkf(!bIsRetrieved, TEXT("The future has already been retrieved."));
+
+		bIsRetrieved = true;
+
+		State->AddRef();
+
+		return TFuture<T>(State);
+	}
+
+	/** Sets the value constructed from the arguments, which makes the future ready and schedules its continuation. */
+	template <typename... Ts> requires (CConstructibleFrom<NAMESPACE_PRIVATE::TFutureValue<T>, Ts...>)
+	FORCEINLINE void SetValue(Ts&&... Args)
+	{
+		checkf(IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		State->SetValue(Forward<Ts>(Args)...);
+	}
+
+private:
+
+	FState* State;
+
+	bool bIsRetrieved;
+
+	FORCEINLINE void Reset()
+	{
+		if (State == nullptr) return;
+
+		checkf(State->IsReady() || State->RefCount.Load(EMemoryOrder::Relaxed) == 1, TEXT("The promise is destroyed without setting the value."));
+
+		Exchange(State, nullptr)->Release();
+	}
+
+};
+
+/**
+ * Creates the future that is ready when all the futures are ready, whose value is the tuple of their values.
+ * The futures are consumed, and their values are collected inline on the thread that sets the last value.
+ */
+template <typename... Ts> requires (sizeof...(Ts) > 0 && (!CVoid<Ts> && ...))
+NODISCARD TFuture<TTuple<Ts...>> WhenAll(TFuture<Ts>... Futures)
+{
+	struct FJoin
+	{
+		TTuple<TOptional<Ts>...> Values;
+
+		TAtomic<size_t> Remaining = sizeof...(Ts);
+
+		TPromise<TTuple<Ts...>> Promise;
+
+		void Arrive()
+		{
+			if (Remaining.FetchSub(1, EMemoryOrder::AcquireRelease) != 1) return;
+
+			[this]<size_t... Indices>(TIndexSequence<Indices...>)
+			{
+				Promise.SetValue(MoveTemp(*Values.template GetValue<Indices>())...);
+			}
+			(TIndexSequenceFor<Ts...>());
+		}
+	};
+
+	TSharedRef<FJoin> Join = MakeShared<FJoin>();
+
+	TFuture<TTuple<Ts...>> Result = Join->Promise.GetFuture();
+
+	auto Attach = [&Join]<size_t Index, typename T>(TFuture<T>& Input)
+	{
+		checkf(Input.IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		NAMESPACE_PRIVATE::TFutureState<T>* State = Exchange(Input.State, nullptr);
+
+		State->SetContinuation([Join, State]
+		{
+			Join->Values.template GetValue<Index>().Emplace(MoveTemp(*State->Value));
+
+			State->Release();
+
+			Join->Arrive();
+		}, true);
+	};
+
+	TTuple<TFuture<Ts>&...> Inputs(Futures...);
+
+	[&Attach, &Inputs]<size_t... Indices>(TIndexSequence<Indices...>)
+	{
+		(Attach.template operator()<Indices>(Inputs.template GetValue<Indices>()), ...);
+	}
+	(TIndexSequenceFor<Ts...>());
+
+	return Result;
+}
+
+/**
+ * Creates the future that is ready when all the futures in the range are ready, whose value is the array of their values in order,
+ * or void for the void futures. The futures are consumed, and their values are collected inline on the thread that sets the last value.
+ */
+template <CInputRange R> requires (CTFuture<TRangeElement<R>>)
+NODISCARD auto WhenAll(R&& Futures)
+{
+	using T = typename TRangeElement<R>::FValueType;
+
+	using FResultType = TConditional<CVoid<T>, void, TArray<NAMESPACE_PRIVATE::TFutureValue<T>>>;
+
+	struct FJoin
+	{
+		TArray<TOptional<NAMESPACE_PRIVATE::TFutureValue<T>>> Values;
+
+		TAtomic<size_t> Remaining;
+
+		TPromise<FResultType> Promise;
+
+		void Arrive()
+		{
+			if (Remaining.FetchSub(1, EMemoryOrder::AcquireRelease) != 1) return;
+
+			if constexpr (CVoid<T>) Promise.SetValue();
+
+			else
+			{
+				TArray<T> Result;
+
+				Result.Reserve(Values.Num());
+
+				for (TOptional<T>& Value : Values) Result.PushBack(MoveTemp(*Value));
+
+				Promise.SetValue(MoveTemp(Result));
+			}
+		}
+	};
+
+	TArray<NAMESPACE_PRIVATE::TFutureState<T>*> States;
+
+	for (auto&& Future : Futures)
+	{
+		checkf(Future.IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		States.PushBack(Exchange(Future.State, nullptr));
+	}
+
+	TSharedRef<FJoin> Join = MakeShared<FJoin>();
+
+	if constexpr (!CVoid<T>) Join->Values.SetNum(States.Num());
+
+	// The extra count prevents the result from being set before all continuations are attached.
+	Join->Remaining = States.Num() + 1;
+
+	TFuture<FResultType> Result = Join->Promise.GetFuture();
+
+	for (size_t Index = 0; Index != States.Num(); ++Index)
+	{
+		NAMESPACE_PRIVATE::TFutureState<T>* State = States[Index];
+
+		State->SetContinuation([Join, State, Index]
+		{
+			if constexpr (!CVoid<T>) Join->Values[Index].Emplace(MoveTemp(*State->Value));
+
+			State->Release();
+
+			Join->Arrive();
+		}, true);
+	}
+
+	Join->Arrive();
+
+	return Result;
+}
+
+/**
+ * Creates the future that is ready when any of the futures in the range is ready, whose value is the tuple of the index and the value
+ * of the first ready future, or the index only for the void futures. The futures are consumed, and the values of the others are discarded.
+ * The range should not be empty.
+ */
+template <CInputRange R> requires (CTFuture<TRangeElement<R>>)
+NODISCARD auto WhenAny(R&& Futures)
+{
+	using T = typename TRangeElement<R>::FValueType;
+
+	using FResultType = TConditional<CVoid<T>, size_t, TTuple<size_t, NAMESPACE_PRIVATE::TFutureValue<T>>>;
+
+	struct FRace
+	{
+		TAtomic<bool> bIsDone = false;
+
+		TPromise<FResultType> Promise;
+	};
+
+	TSharedRef<FRace> Race = MakeShared<FRace>();
+
+	TFuture<FResultType> Result = Race->Promise.GetFuture();
+
+	size_t Index = 0;
+
+	for (auto&& Future : Futures)
+	{
+		checkf(Future.IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		NAMESPACE_PRIVATE::TFutureState<T>* State = Exchange(Future.State, nullptr);
+
+		State->SetContinuation([Race, State, Index]
+		{
+			if (!Race->bIsDone.Exchange(true, EMemoryOrder::Relaxed))
+			{
+				if constexpr (CVoid<T>) Race->Promise.SetValue(Index);
+
+				else Race->Promise.SetValue(Index, MoveTemp(*State->Value));
+			}
+
+			State->Release();
+		}, true);
+
+		++Index;
+	}
+
+	checkf(Index != 0, TEXT("The range of futures should not be empty."));
+
+	return Result;
+}
+
+/**
+ * Runs the function as a task on the task scheduler.
+ *
+ * @param Func - The function to run.
+ *
+ * @return The future of the result of the function.
+ */
+template <typename F> requires (CInvocable<TDecay<F>>)
+NODISCARD auto Async(F&& Func)
+{
+	using FResultType = TInvokeResult<TDecay<F>>;
+
+	TPromise<FResultType> Promise;
+
+	TFuture<FResultType> Result = Promise.GetFuture();
+
+	Tasks::Submit([Promise = MoveTemp(Promise), Func = Forward<F>(Func)]() mutable
+	{
+		if constexpr (CVoid<FResultType>) { Invoke(Func); Promise.SetValue(); }
+
+		else Promise.SetValue(Invoke(Func));
+	});
+
+	return Result;
+}
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -0,0 +1,367 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Templates/Atomic.h"
+#include "Templates/Noncopyable.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+#if PLATFORM_COMPILER_MSVC && PLATFORM_CPU_X86_FAMILY
+#	include <intrin.h>
+#endif
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+/** Hints the processor that the calling thread is in a spin-wait loop, which saves power and yields the pipeline to the sibling hyper-thread. */
+FORCEINLINE void SpinPause()
+{
+#	if PLATFORM_CPU_X86_FAMILY && PLATFORM_COMPILER_MSVC
+	{
+		_mm_pause();
+	}
+#	elif PLATFORM_CPU_X86_FAMILY
+	{
+		__builtin_ia32_pause();
+	}
+#	elif PLATFORM_CPU_ARM_FAMILY && !PLATFORM_COMPILER_MSVC
+	{
+		__asm__ __volatile__("yield");
+	}
+#	endif
+}
+
+/** A concept specifies the type can be locked and unlocked exclusively. */
+template <typename T>
+concept CLockable = requires (T& Mutex)
+{
+	Mutex.Lock();
+	Mutex.Unlock();
+	{ Mutex.TryLock() } -> CSameAs<bool>;
+};
+
+/** A concept specifies the type can also be locked and unlocked in shared mode. */
+template <typename T>
+concept CSharedLockable = CLockable<T> && requires (T& Mutex)
+{
+	Mutex.LockShared();
+	Mutex.UnlockShared();
+	{ Mutex.TryLockShared() } -> CSameAs<bool>;
+};
+
+/**
+ * The spinlock that never blocks the thread, which is only suitable for the very short critical sections.
+ * The waiting threads spin on the plain load instead of the exchange, i.e. test-and-test-and-set,
+ * which keeps the cache line shared until the lock is released, and back off exponentially with the pause instruction.
+ */
+class FSpinLock final : private FSingleton
+{
+public:
+
+	FORCEINLINE constexpr FSpinLock() = default;
+
+	/** Locks the spinlock, spins until the spinlock is available. */
+	FORCEINLINE void Lock()
+	{
+		if (!bLocked.Exchange(true, EMemoryOrder::Acquire)) LIKELY return;
+
+		LockSlow();
+	}
+
+	/** Tries to lock the spinlock, returns immediately if the spinlock is not available. */
+	NODISCARD FORCEINLINE bool TryLock()
+	{
+		return !bLocked.Load(EMemoryOrder::Relaxed) && !bLocked.Exchange(true, EMemoryOrder::Acquire);
+	}
+
+	/** Unlocks the spinlock, which must be locked by the calling thread. */
+	FORCEINLINE void Unlock()
+	{
+		checkf(bLocked.Load(EMemoryOrder::Relaxed), TEXT("The spinlock is not locked."));
+
+		bLocked.Store(false, EMemoryOrder::Release);
+	}
+
+private:
+
+	TAtomic<bool> bLocked = false;
+
+	void LockSlow()
+	{
+		uint32 Backoff = 1;
+
+		do
+		{
+			while (bLocked.Load(EMemoryOrder::Relaxed))
+			{
+				for (uint32 Index = 0; Index != Backoff; ++Index) SpinPause();
+
+				if (Backoff < MaxBackoff) Backoff <<= 1;
+			}
+		}
+		while (bLocked.Exchange(true, EMemoryOrder::Acquire));
+	}
+
+	static constexpr uint32 MaxBackoff = 64;
+
+};
+
+/**
+ * The adaptive mutex that spins for a short while and then parks the thread on the futex by TAtomic::Wait().
+ * The state is 0 if unlocked, 1 if locked and 2 if locked and there may be waiting threads,
+ * so the uncontended lock and unlock are a single atomic operation without the system call.
+ */
+class FMutex final : private FSingleton
+{
+public:
+
+	FORCEINLINE constexpr FMutex() = default;
+
+	/** Locks the mutex, blocks the thread if the mutex is not available. */
+	FORCEINLINE void Lock()
+	{
+		uint32 Expected = Unlocked;
+
+		if (State.CompareExchange(Expected, Locked, EMemoryOrder::Acquire)) LIKELY return;
+
+		LockSlow();
+	}
+
+	/** Tries to lock the mutex, returns immediately if the mutex is not available. */
+	NODISCARD FORCEINLINE bool TryLock()
+	{
+		uint32 Expected = Unlocked;
+
+		return State.CompareExchange(Expected, Locked, EMemoryOrder::Acquire);
+	}
+
+	/** Unlocks the mutex, which must be locked by the calling thread, and wakes one of the waiting threads. */
+	FORCEINLINE void Unlock()
+	{
+		const uint32 Previous = State.Exchange(Unlocked, EMemoryOrder::Release);
+
+		checkf(Previous != Unlocked, TEXT("The mutex is not locked."));
+
+		if (Previous == Contended) State.Notify();
+	}
+
+private:
+
+	static constexpr uint32 Unlocked  = 0;
+	static constexpr uint32 Locked    = 1;
+	static constexpr uint32 Contended = 2;
+
+	TAtomic<uint32> State = Unlocked;
+
+	void LockSlow()
+	{
+		for (uint32 Index = 0; Index != SpinCount; ++Index)
+		{
+			uint32 Expected = State.Load(EMemoryOrder::Relaxed);
+
+			if (Expected == Unlocked && State.CompareExchange(Expected, Locked, EMemoryOrder::Acquire)) return;
+
+			if (Expected == Contended) break;
+
+			SpinPause();
+		}
+
+		// Marks the mutex as contended, so the owner will wake one of the waiting threads when it unlocks.
+		while (State.Exchange(Contended, EMemoryOrder::Acquire) != Unlocked) State.Wait(Contended, EMemoryOrder::Relaxed);
+	}
+
+	static constexpr uint32 SpinCount = 100;
+
+};
+
+/**
+ * The reader-writer mutex for the read-mostly data, the uncontended shared lock and unlock are a single atomic addition.
+ * The writers are serialized by an inner mutex and take precedence over the new readers, so the writers do not starve.
+ */
+class FSharedMutex final : private FSingleton
+{
+public:
+
+	FORCEINLINE constexpr FSharedMutex() = default;
+
+	/** Locks the mutex exclusively, blocks the thread until the other writers and all readers have unlocked. */
+	void Lock()
+	{
+		WriterMutex.Lock();
+
+		// Blocks the new readers, then waits for the current readers to leave.
+		uint32 Current = State.FetchOr(WriterBit, EMemoryOrder::Acquire) | WriterBit;
+
+		for (uint32 Index = 0; Current != WriterBit; ++Index)
+		{
+			if (Index < SpinCount) SpinPause();
+
+			else State.Wait(Current, EMemoryOrder::Acquire);
+
+			Current = State.Load(EMemoryOrder::Acquire);
+		}
+	}
+
+	/** Tries to lock the mutex exclusively, returns immediately if the mutex is not available. */
+	NODISCARD bool TryLock()
+	{
+		if (!WriterMutex.TryLock()) return false;
+
+		uint32 Expected = 0;
+
+		if (State.CompareExchange(Expected, WriterBit, EMemoryOrder::Acquire)) return true;
+
+		WriterMutex.Unlock();
+
+		return false;
+	}
+
+	/** Unlocks the exclusive mutex, which must be locked by the calling thread, and wakes the waiting readers. */
+	void Unlock()
+	{
+		// Only clears the writer bit, since the readers that are withdrawing their optimistic increments may be counted.
+		MAYBE_UNUSED const uint32 Previous = State.FetchAnd(~WriterBit, EMemoryOrder::Release);
+
+		checkf(Previous & WriterBit, TEXT("The mutex is not locked exclusively."));
+
+		State.Notify(true);
+
+		WriterMutex.Unlock();
+	}
+
+	/** Locks the mutex in shared mode, blocks the thread while a writer holds or is waiting for the mutex. */
+	FORCEINLINE void LockShared()
+	{
+		if (!(State.FetchAdd(1, EMemoryOrder::Acquire) & WriterBit)) LIKELY return;
+
+		LockSharedSlow();
+	}
+
+	/** Tries to lock the mutex in shared mode, returns immediately if a writer holds or is waiting for the mutex. */
+	NODISCARD FORCEINLINE bool TryLockShared()
+	{
+		uint32 Expected = State.Load(EMemoryOrder::Relaxed);
+
+		while (!(Expected & WriterBit))
+		{
+			if (State.CompareExchange(Expected, Expected + 1, EMemoryOrder::Acquire, true)) return true;
+		}
+
+		return false;
+	}
+
+	/** Unlocks the shared mutex, which must be locked in shared mode by the calling thread, and wakes the waiting writer if it is the last reader. */
+	FORCEINLINE void UnlockShared()
+	{
+		const uint32 Previous = State.FetchSub(1, EMemoryOrder::Release);
+
+		checkf((Previous & ~WriterBit) != 0, TEXT("The mutex is not locked in shared mode."));
+
+		if (Previous == (WriterBit | 1)) State.Notify(true);
+	}
+
+private:
+
+	static constexpr uint32 WriterBit = 1u << 31;
+
+	TAtomic<uint32> State = 0;
+
+	FMutex WriterMutex;
+
+	void LockSharedSlow()
+	{
+		// Withdraws the optimistic increment, which may be the last one that the writer is waiting for.
+		UnlockShared();
+
+		for (uint32 Index = 0; ; ++Index)
+		{
+			uint32 Current = State.Load(EMemoryOrder::Relaxed);
+
+			if (!(Current & WriterBit))
+			{
+				if (State.CompareExchange(Current, Current + 1, EMemoryOrder::Acquire, true)) return;
+
+				continue;
+			}
+
+			if (Index < SpinCount) SpinPause();
+
+			else State.Wait(Current, EMemoryOrder::Relaxed);
+		}
+	}
+
+	static constexpr uint32 SpinCount = 100;
+
+};
+
+/** The scope guard that locks the mutex exclusively and unlocks it when the scope is exited. */
+template <CLockable T>
+class TScopeLock final : private FNoncopyable
+{
+public:
+
+	/** Locks the mutex. */
+	FORCEINLINE explicit TScopeLock(T& InMutex) : Mutex(&InMutex) { Mutex->Lock(); }
+
+	/** Move constructor. Takes the ownership of the lock from other. */
+	FORCEINLINE TScopeLock(TScopeLock&& InValue) : Mutex(InValue.Mutex) { InValue.Mutex = nullptr; }
+
+	/** Unlocks the mutex if the guard still owns the lock. */
+	FORCEINLINE ~TScopeLock() { if (Mutex != nullptr) Mutex->Unlock(); }
+
+	/** Unlocks the mutex before the scope is exited. */
+	FORCEINLINE void Unlock()
+	{
+		checkf(Mutex != nullptr, TEXT("The lock has been released."));
+
+		Mutex->Unlock();
+
+		Mutex = nullptr;
+	}
+
+private:
+
+	T* Mutex;
+
+};
+
+template <typename T>
+TScopeLock(T&) -> TScopeLock<T>;
+
+/** The scope guard that locks the mutex in shared mode and unlocks it when the scope is exited. */
+template <CSharedLockable T>
+class TScopeSharedLock final : private FNoncopyable
+{
+public:
+
+	/** Locks the mutex in shared mode. */
+	FORCEINLINE explicit TScopeSharedLock(T& InMutex) : Mutex(&InMutex) { Mutex->LockShared(); }
+
+	/** Move constructor. Takes the ownership of the lock from other. */
+	FORCEINLINE TScopeSharedLock(TScopeSharedLock&& InValue) : Mutex(InValue.Mutex) { InValue.Mutex = nullptr; }
+
+	/** Unlocks the mutex if the guard still owns the lock. */
+	FORCEINLINE ~TScopeSharedLock() { if (Mutex != nullptr) Mutex->UnlockShared(); }
+
+	/** Unlocks the mutex before the scope is exited. */
+	FORCEINLINE void Unlock()
+	{
+		checkf(Mutex != nullptr, TEXT("The lock has been released."));
+
+		Mutex->UnlockShared();
+
+		Mutex = nullptr;
+	}
+
+private:
+
+	T* Mutex;
+
+};
+
+template <typename T>
+TScopeSharedLock(T&) -> TScopeSharedLock<T>;
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
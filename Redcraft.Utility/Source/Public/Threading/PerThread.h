@@ -0,0 +1,231 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Memory/Memory.h"
+#include "Numerics/Bit.h"
+#include "Numerics/Limits.h"
+#include "Templates/Atomic.h"
+#include "Templates/Invoke.h"
+#include "Templates/Noncopyable.h"
+#include "Containers/StaticArray.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+/**
+ * @return The dense index of the calling thread, which is unique among the living threads.
+ * The index is reused by the later threads after the thread exits, so the indices are kept small.
+ */
+NODISCARD REDCRAFTUTILITY_API size_t GetThreadIndex();
+
+/**
+ * The per-thread storage of the values, each thread writes to its own slot that is padded to avoid false sharing,
+ * and the values of all threads are visited by ForEach(). The slots are allocated in chunks on the first access
+ * of a thread, and are kept for the later threads that reuse the thread index, so the written values are never lost.
+ * The slots that are visited while their threads are writing them should be atomic.
+ */
+template <typename T> requires (CDefaultConstructible<T> && CDestructible<T>)
+class TPerThread final : private FSingleton
+{
+public:
+
+	/** Constructs the storage without any slot. */
+	TPerThread() = default;
+
+	/** Destructs the values of all threads, which should no longer be accessed. */
+	~TPerThread()
+	{
+		for (TAtomic<FChunk*>& Chunk : Directory) delete Chunk.Load(EMemoryOrder::Relaxed);
+	}
+
+	/** @return The value of the calling thread, which is default constructed on the first access. */
+	NODISCARD FORCEINLINE T& Get()
+	{
+		const size_t Index = GetThreadIndex();
+
+		checkf(Index < ChunkNum * ChunkSize, TEXT("Too many living threads."));
+
+		FChunk* Chunk = Directory[Index / ChunkSize].Load(EMemoryOrder::Acquire);
+
+		if (Chunk == nullptr) UNLIKELY Chunk = AllocateChunk(Index / ChunkSize);
+
+		return Chunk->Slots[Index % ChunkSize].Value;
+	}
+
+	/** Visits the values of all slots that have been allocated, including the slots that are not accessed by any thread. */
+	template <typename F> requires (CInvocable<F, T&>)
+	void ForEach(F&& Func)
+	{
+		for (TAtomic<FChunk*>& Entry : Directory)
+		{
+			FChunk* Chunk = Entry.Load(EMemoryOrder::Acquire);
+
+			if (Chunk == nullptr) continue;
+
+			for (FSlot& Slot : Chunk->Slots) Invoke(Func, Slot.Value);
+		}
+	}
+
+	/** Visits the values of all slots that have been allocated, including the slots that are not accessed by any thread. */
+	template <typename F> requires (CInvocable<F, const T&>)
+	void ForEach(F&& Func) const
+	{
+		for (const TAtomic<FChunk*>& Entry : Directory)
+		{
+			const FChunk* Chunk = Entry.Load(EMemoryOrder::Acquire);
+
+			if (Chunk == nullptr) continue;
+
+			for (const FSlot& Slot : Chunk->Slots) Invoke(Func, Slot.Value);
+		}
+	}
+
+private:
+
+	static constexpr size_t ChunkSize = 16;
+	static constexpr size_t ChunkNum  = 256;
+
+	struct alignas(Memory::DestructiveInterference) FSlot { T Value; };
+
+	struct FChunk { FSlot Slots[ChunkSize]; };
+
+	TAtomic<FChunk*> Directory[ChunkNum] = { };
+
+	FChunk* AllocateChunk(size_t ChunkIndex)
+	{
+		FChunk* NewChunk = new FChunk();
+		FChunk* Expected = nullptr;
+
+		if (Directory[ChunkIndex].CompareExchange(Expected, NewChunk, EMemoryOrder::AcquireRelease, EMemoryOrder::Acquire)) return NewChunk;
+
+		// The chunk has been allocated by the other thread.
+		delete NewChunk;
+
+		return Expected;
+	}
+
+};
+
+/**
+ * The counter that is incremented by many threads without contention, each thread adds to its own slot without the atomic
+ * read-modify-write operation, and Get() sums all slots lazily, which is not a snapshot of the concurrent additions.
+ */
+class FShardedCounter final : private FSingleton
+{
+public:
+
+	FShardedCounter() = default;
+
+	/** Adds the value to the counter of the calling thread, the counter wraps around on overflow. */
+	FORCEINLINE void Add(uint64 InValue = 1)
+	{
+		TAtomic<uint64>& Slot = Slots.Get();
+
+		Slot.Store(Slot.Load(EMemoryOrder::Relaxed) + InValue, EMemoryOrder::Relaxed);
+	}
+
+	/** @return The sum of the counters of all threads. */
+	NODISCARD uint64 Get() const
+	{
+		uint64 Result = 0;
+
+		Slots.ForEach([&Result](const TAtomic<uint64>& Slot) { Result += Slot.Load(EMemoryOrder::Relaxed); });
+
+		return Result;
+	}
+
+private:
+
+	TPerThread<TAtomic<uint64>> Slots;
+
+};
+
+/** The maximum of the values that are updated by many threads without contention, Get() returns the maximum of all slots lazily. */
+template <typename T> requires (CArithmetic<T> && TAtomic<T>::bIsAlwaysLockFree)
+class TShardedMax final : private FSingleton
+{
+public:
+
+	TShardedMax() = default;
+
+	/** Updates the maximum of the calling thread with the value. */
+	FORCEINLINE void Update(T InValue)
+	{
+		TAtomic<T>& Slot = Slots.Get().Value;
+
+		if (InValue > Slot.Load(EMemoryOrder::Relaxed)) Slot.Store(InValue, EMemoryOrder::Relaxed);
+	}
+
+	/** @return The maximum of the values of all threads, or the minimum value of T if there is no value. */
+	NODISCARD T Get() const
+	{
+		T Result = TNumericLimits<T>::Min();
+
+		Slots.ForEach([&Result](const FSlot& Slot) { const T Value = Slot.Value.Load(EMemoryOrder::Relaxed); if (Value > Result) Result = Value; });
+
+		return Result;
+	}
+
+private:
+
+	struct FSlot
+	{
+		TAtomic<T> Value;
+
+		FORCEINLINE FSlot() : Value(TNumericLimits<T>::Min()) { }
+	};
+
+	TPerThread<FSlot> Slots;
+
+};
+
+/**
+ * The histogram of the unsigned values that are recorded by many threads without contention, such as the latencies.
+ * The bucket 0 counts the value 0 and the bucket N counts the values in [2^(N-1), 2^N), which are merged lazily.
+ */
+class FShardedHistogram final : private FSingleton
+{
+public:
+
+	static constexpr size_t BucketNum = TNumericLimits<uint64>::Digits + 1;
+
+	FShardedHistogram() = default;
+
+	/** Records the value in the histogram of the calling thread. */
+	FORCEINLINE void Record(uint64 InValue)
+	{
+		TAtomic<uint64>& Slot = Slots.Get().Buckets[GetBucketIndex(InValue)];
+
+		Slot.Store(Slot.Load(EMemoryOrder::Relaxed) + 1, EMemoryOrder::Relaxed);
+	}
+
+	/** @return The counts of the buckets of all threads. */
+	NODISCARD TStaticArray<uint64, BucketNum> Get() const
+	{
+		TStaticArray<uint64, BucketNum> Result = { };
+
+		Slots.ForEach([&Result](const FSlot& Slot)
+		{
+			for (size_t Index = 0; Index != BucketNum; ++Index) Result[Index] += Slot.Buckets[Index].Load(EMemoryOrder::Relaxed);
+		});
+
+		return Result;
+	}
+
+	/** @return The index of the bucket that counts the value. */
+	NODISCARD static FORCEINLINE constexpr size_t GetBucketIndex(uint64 InValue) { return Math::BitWidth(InValue); }
+
+private:
+
+	struct FSlot { TAtomic<uint64> Buckets[BucketNum]; };
+
+	TPerThread<FSlot> Slots;
+
+};
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
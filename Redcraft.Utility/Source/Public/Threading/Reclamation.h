@@ -0,0 +1,348 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Memory/Memory.h"
+#include "Numerics/Math.h"
+#include "Templates/Utility.h"
+#include "Templates/Atomic.h"
+#include "Templates/Noncopyable.h"
+#include "Containers/Array.h"
+#include "Algorithms/Sort.h"
+#include "Algorithms/BinarySearch.h"
+#include "Threading/PerThread.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+/** The deleter of the retired object, which is called once no thread can access the object. */
+using FRetireDeleter = void(*)(void*);
+
+NAMESPACE_PRIVATE_BEGIN
+
+struct FRetiredObject
+{
+	void* Ptr;
+
+	FRetireDeleter Deleter;
+
+	uint64 Epoch;
+};
+
+struct FEpochRecord
+{
+	// The epoch that the thread has observed when it entered the critical section, or zero if the thread is not in one.
+	TAtomic<uint64> Epoch = 0;
+
+	// The fields below are only accessed by the thread that owns the record.
+	uint32 Depth = 0;
+
+	TArray<FRetiredObject> Retired;
+};
+
+inline constexpr size_t HazardPointerNum = 4;
+
+struct FHazardRecord
+{
+	TAtomic<void*> Hazards[HazardPointerNum] = { };
+
+	// The fields below are only accessed by the thread that owns the record.
+	uint32 UsedMask = 0;
+
+	size_t ScanLimit = 0;
+
+	TArray<FRetiredObject> Retired;
+};
+
+NAMESPACE_PRIVATE_END
+
+/**
+ * The epoch-based reclamation domain for the lock-free data structures, the readers only publish the global epoch
+ * in their per-thread records when they enter the critical section, which is much cheaper than the reference counting.
+ * The removed objects are retired into the batched per-thread lists, which are freed after the global epoch has advanced twice,
+ * and the global epoch only advances when all threads in the critical sections have observed the current one.
+ * So a stalled reader blocks the reclamation of all objects, use FHazardDomain if the memory must be bounded.
+ */
+class FEpochDomain final : private FSingleton
+{
+public:
+
+	/** The number of the retired objects of a thread that triggers the reclamation. */
+	static constexpr size_t BatchSize = 64;
+
+	FEpochDomain() = default;
+
+	/** Destructs the domain and frees all retired objects, the domain should no longer be accessed. */
+	~FEpochDomain()
+	{
+		Records.ForEach([](FRecord& Record) { for (FRetired& Retired : Record.Retired) Retired.Deleter(Retired.Ptr); });
+	}
+
+	/** Enters the critical section, the objects loaded in the critical section are not freed until it is left. The critical sections can be nested. */
+	FORCEINLINE void Enter()
+	{
+		FRecord& Record = Records.Get();
+
+		if (Record.Depth++ != 0) return;
+
+		Record.Epoch.Store(GlobalEpoch.Load(EMemoryOrder::Relaxed), EMemoryOrder::Relaxed);
+
+		// Publishes the epoch before loading any object, which pairs with the fence in TryAdvance().
+		AtomicThreadFence();
+	}
+
+	/** Leaves the critical section, the objects loaded in the critical section should no longer be accessed. */
+	FORCEINLINE void Leave()
+	{
+		FRecord& Record = Records.Get();
+
+		checkf(Record.Depth != 0, TEXT("The thread is not in the critical section."));
+
+		if (--Record.Depth != 0) return;
+
+		Record.Epoch.Store(0, EMemoryOrder::Release);
+	}
+
+	/**
+	 * Retires the object that has been removed from the data structure, which is freed once no critical section can access it.
+	 *
+	 * @param Ptr     - The pointer to the object, which must be unreachable for the new critical sections.
+	 * @param Deleter - The function to free the object, which is Memory::Free() by default.
+	 */
+	void Retire(void* Ptr, FRetireDeleter Deleter = Memory::Free)
+	{
+		FRecord& Record = Records.Get();
+
+		Record.Retired.PushBack({ Ptr, Deleter, GlobalEpoch.Load() });
+
+		if (Record.Retired.Num() >= BatchSize) Collect(Record);
+	}
+
+	/** Tries to advance the global epoch and frees the retired objects of the calling thread that are safe to free. */
+	FORCEINLINE void Flush() { Collect(Records.Get()); }
+
+	/** @return The current global epoch. */
+	NODISCARD FORCEINLINE uint64 GetEpoch() const { return GlobalEpoch.Load(EMemoryOrder::Relaxed); }
+
+private:
+
+	using FRecord  = NAMESPACE_PRIVATE::FEpochRecord;
+	using FRetired = NAMESPACE_PRIVATE::FRetiredObject;
+
+	TAtomic<uint64> GlobalEpoch = 1;
+
+	TPerThread<FRecord> Records;
+
+	/** Advances the global epoch if all threads in the critical sections have observed it. */
+	void TryAdvance()
+	{
+		AtomicThreadFence();
+
+		uint64 Epoch = GlobalEpoch.Load(EMemoryOrder::Relaxed);
+
+		bool bObserved = true;
+
+		Records.ForEach([Epoch, &bObserved](const FRecord& Record)
+		{
+			const uint64 Observed = Record.Epoch.Load(EMemoryOrder::Acquire);
+
+			if (Observed != 0 && Observed != Epoch) bObserved = false;
+		});
+
+		// The epoch may have been advanced by the other threads, which is also fine.
+		if (bObserved) Ignore = GlobalEpoch.CompareExchange(Epoch, Epoch + 1, EMemoryOrder::AcquireRelease, EMemoryOrder::Relaxed);
+	}
+
+	/** Frees the retired objects that were retired at least two epochs ago, since the threads in the critical sections are at most one epoch behind. */
+	void Collect(FRecord& Record)
+	{
+		TryAdvance();
+
+		const uint64 Epoch = GlobalEpoch.Load(EMemoryOrder::Acquire);
+
+		size_t Kept = 0;
+
+		for (FRetired& Retired : Record.Retired)
+		{
+			if (Retired.Epoch + 2 <= Epoch) Retired.Deleter(Retired.Ptr);
+
+			else Record.Retired[Kept++] = Retired;
+		}
+
+		Record.Retired.SetNum(Kept, false);
+	}
+
+};
+
+/** The scope guard that enters the critical section of the epoch domain and leaves it when the scope is exited. */
+class FEpochGuard final : private FSingleton
+{
+public:
+
+	/** Enters the critical section of the domain. */
+	FORCEINLINE explicit FEpochGuard(FEpochDomain& InDomain) : Domain(InDomain) { Domain.Enter(); }
+
+	/** Leaves the critical section of the domain. */
+	FORCEINLINE ~FEpochGuard() { Domain.Leave(); }
+
+private:
+
+	FEpochDomain& Domain;
+
+};
+
+/**
+ * The hazard pointer reclamation domain for the lock-free data structures, each reader publishes the pointers it is accessing
+ * in its per-thread hazard slots, and the retired objects that are not published by any thread are freed when the per-thread list is scanned.
+ * Unlike FEpochDomain, a stalled reader only keeps the objects it protects, so the number of unfreed objects is bounded,
+ * but each protection costs a full fence, and each thread can only protect a few pointers at the same time.
+ */
+class FHazardDomain final : private FSingleton
+{
+public:
+
+	/** The number of the hazard pointers that a thread can hold at the same time. */
+	static constexpr size_t HazardNum = NAMESPACE_PRIVATE::HazardPointerNum;
+
+	/** The minimum number of the retired objects of a thread that triggers the scan, which grows with the protected objects that are kept. */
+	static constexpr size_t ScanThreshold = 64;
+
+	FHazardDomain() = default;
+
+	/** Destructs the domain and frees all retired objects, the domain should no longer be accessed. */
+	~FHazardDomain()
+	{
+		Records.ForEach([](FRecord& Record) { for (FRetired& Retired : Record.Retired) Retired.Deleter(Retired.Ptr); });
+	}
+
+	/**
+	 * Retires the object that has been removed from the data structure, which is freed once no hazard pointer protects it.
+	 *
+	 * @param Ptr     - The pointer to the object, which must be unreachable for the new protections.
+	 * @param Deleter - The function to free the object, which is Memory::Free() by default.
+	 */
+	void Retire(void* Ptr, FRetireDeleter Deleter = Memory::Free)
+	{
+		FRecord& Record = Records.Get();
+
+		Record.Retired.PushBack({ Ptr, Deleter, 0 });
+
+		if (Record.Retired.Num() >= Math::Max(ScanThreshold, Record.ScanLimit)) Scan(Record);
+	}
+
+	/** Frees the retired objects of the calling thread that are not protected by any hazard pointer. */
+	FORCEINLINE void Flush() { Scan(Records.Get()); }
+
+private:
+
+	using FRecord  = NAMESPACE_PRIVATE::FHazardRecord;
+	using FRetired = NAMESPACE_PRIVATE::FRetiredObject;
+
+	TPerThread<FRecord> Records;
+
+	/** Collects the hazard pointers of all threads and frees the retired objects that are not among them. */
+	void Scan(FRecord& Record)
+	{
+		// Pairs with the fence in FHazardPointer::Protect(), so either the scan sees the hazard or the reader sees the removal.
+		AtomicThreadFence();
+
+		TArray<uintptr> Protected;
+
+		Records.ForEach([&Protected](const FRecord& Other)
+		{
+			for (const TAtomic<void*>& Hazard : Other.Hazards)
+			{
+				void* Ptr = Hazard.Load(EMemoryOrder::Acquire);
+
+				if (Ptr != nullptr) Protected.PushBack(reinterpret_cast<uintptr>(Ptr));
+			}
+		});
+
+		Algorithms::Sort(Protected);
+
+		size_t Kept = 0;
+
+		for (FRetired& Retired : Record.Retired)
+		{
+			if (!Algorithms::BinarySearch(Protected, reinterpret_cast<uintptr>(Retired.Ptr))) Retired.Deleter(Retired.Ptr);
+
+			else Record.Retired[Kept++] = Retired;
+		}
+
+		Record.Retired.SetNum(Kept, false);
+
+		// The kept objects are at most the hazard pointers of all threads, so each scan frees at least half of the list.
+		Record.ScanLimit = Kept * 2;
+	}
+
+	friend class FHazardPointer;
+
+};
+
+/**
+ * The hazard pointer that occupies a hazard slot of the calling thread, and releases it when the scope is exited.
+ * The hazard pointer should only be used by the thread that constructs it.
+ */
+class FHazardPointer final : private FSingleton
+{
+public:
+
+	/** Occupies a free hazard slot of the calling thread in the domain. */
+	explicit FHazardPointer(FHazardDomain& InDomain) : Record(InDomain.Records.Get())
+	{
+		checkf(Record.UsedMask != (1u << FHazardDomain::HazardNum) - 1, TEXT("Too many hazard pointers in the thread."));
+
+		while (Record.UsedMask & (1u << Index)) ++Index;
+
+		Record.UsedMask |= 1u << Index;
+	}
+
+	/** Clears the protection and releases the hazard slot. */
+	FORCEINLINE ~FHazardPointer()
+	{
+		Reset();
+
+		Record.UsedMask &= ~(1u << Index);
+	}
+
+	/**
+	 * Protects the object that is loaded from the source, which is not freed until the hazard pointer is reset or protects another one.
+	 *
+	 * @param Source - The atomic pointer to load the object from.
+	 *
+	 * @return The loaded pointer that is protected, which is validated to be still reachable from the source after the protection.
+	 */
+	template <typename T>
+	NODISCARD T* Protect(const TAtomic<T*>& Source)
+	{
+		T* Ptr = Source.Load(EMemoryOrder::Relaxed);
+
+		while (true)
+		{
+			Record.Hazards[Index].Store(const_cast<void*>(static_cast<const void*>(Ptr)), EMemoryOrder::Relaxed);
+
+			AtomicThreadFence();
+
+			T* Current = Source.Load(EMemoryOrder::Acquire);
+
+			if (Current == Ptr) return Ptr;
+
+			Ptr = Current;
+		}
+	}
+
+	/** Clears the protection, the protected object should no longer be accessed. */
+	FORCEINLINE void Reset() { Record.Hazards[Index].Store(nullptr, EMemoryOrder::Release); }
+
+private:
+
+	NAMESPACE_PRIVATE::FHazardRecord& Record;
+
+	uint32 Index = 0;
+
+};
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
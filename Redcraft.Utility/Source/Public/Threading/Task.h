@@ -0,0 +1,396 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Optional.h"
+#include "Templates/Noncopyable.h"
+#include "Memory/Memory.h"
+#include "Memory/Alignment.h"
+#include "Threading/TaskScheduler.h"
+#include "Threading/Future.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+#include <coroutine>
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+/**
+ * A concept specifies the type allocates the coroutine frames, which is passed as the first argument of the coroutine.
+ * The frames are allocated and deallocated with the same size and alignment.
+ */
+template <typename A>
+concept CCoroutineFrameAllocator = requires (A& Allocator, void* Ptr, size_t Size, size_t Alignment)
+{
+	{ Allocator.Allocate(Size, Alignment) } -> CSameAs<void*>;
+	{ Allocator.Deallocate(Ptr, Size)     } -> CSameAs<void>;
+};
+
+/** A concept specifies the type can resume the suspended coroutines, such as on a thread pool or an event loop. */
+template <typename S>
+concept CCoroutineScheduler = requires (S& Scheduler, NAMESPACE_STD::coroutine_handle<> Handle)
+{
+	Scheduler.Schedule(Handle);
+};
+
+/** The coroutine scheduler that resumes the coroutines as the tasks on the task scheduler. */
+struct FTaskSchedulerHook
+{
+	FORCEINLINE void Schedule(NAMESPACE_STD::coroutine_handle<> Handle) const
+	{
+		Tasks::Submit([Handle] { Handle.resume(); });
+	}
+};
+
+/**
+ * The arena that allocates the coroutine frames from the inline buffer in the stack order, which is the order
+ * of the nested tasks that are awaited one by one. If the buffer is exhausted, the frames are allocated by Memory::Malloc().
+ * The arena is not thread-safe and must outlive the coroutines that are allocated from it.
+ */
+template <size_t N>
+class TCoroutineArena final : private FSingleton
+{
+public:
+
+	TCoroutineArena() = default;
+
+	NODISCARD void* Allocate(size_t Size, size_t Alignment)
+	{
+		const size_t Offset = Memory::Align(Used, Alignment);
+
+		if (Offset + Size <= N)
+		{
+			Used = Offset + Size;
+
+			++Num;
+
+			return Buffer + Offset;
+		}
+
+		return Memory::Malloc(Size, Alignment);
+	}
+
+	void Deallocate(void* Ptr, size_t Size)
+	{
+		uint8* Bytes = static_cast<uint8*>(Ptr);
+
+		if (Bytes < Buffer || Bytes >= Buffer + N) return Memory::Free(Ptr);
+
+		// Only the last frame is reclaimed, the others are reclaimed when the arena is empty again.
+		if (Bytes + Size == Buffer + Used) Used = Bytes - Buffer;
+
+		if (--Num == 0) Used = 0;
+	}
+
+	/** @return The number of bytes of the buffer in use. */
+	NODISCARD FORCEINLINE size_t GetUsed() const { return Used; }
+
+private:
+
+	alignas(16) uint8 Buffer[N];
+
+	size_t Used = 0;
+	size_t Num  = 0;
+
+};
+
+NAMESPACE_PRIVATE_BEGIN
+
+/**
+ * The base of the coroutine promises, which allocates the frames by Memory::Malloc(), or by the frame allocator
+ * if it is the first argument of the coroutine. The deallocation is recorded in a header before the frame.
+ * Note that GCC 12 reports the coroutines with the frame allocator as the mismatched new and delete, which is a false positive.
+ */
+struct FCoroutinePromiseBase
+{
+	struct alignas(16) FFrameHeader
+	{
+		void(*Deallocate)(void* Allocator, void* Ptr, size_t Size);
+
+		void* Allocator;
+	};
+
+	NODISCARD static void* operator new(size_t Size)
+	{
+		FFrameHeader* Header = static_cast<FFrameHeader*>(Memory::Malloc(Size + sizeof(FFrameHeader), alignof(FFrameHeader)));
+
+		Header->Deallocate = nullptr;
+
+		return Header + 1;
+	}
+
+	template <CCoroutineFrameAllocator A, typename... Ts>
+	NODISCARD static void* operator new(size_t Size, A& Allocator, Ts&&...)
+	{
+		FFrameHeader* Header = static_cast<FFrameHeader*>(Allocator.Allocate(Size + sizeof(FFrameHeader), alignof(FFrameHeader)));
+
+		Header->Deallocate = [](void* InAllocator, void* Ptr, size_t InSize) { static_cast<A*>(InAllocator)->Deallocate(Ptr, InSize); };
+
+		Header->Allocator = &Allocator;
+
+		return Header + 1;
+	}
+
+	static void operator delete(void* Ptr, size_t Size)
+	{
+		FFrameHeader* Header = static_cast<FFrameHeader*>(Ptr) - 1;
+
+		if (Header->Deallocate == nullptr) Memory::Free(Header);
+
+		else Header->Deallocate(Header->Allocator, Header, Size + sizeof(FFrameHeader));
+	}
+
+	FORCEINLINE void unhandled_exception() { check_no_entry(); }
+};
+
+template <typename T>
+struct TTaskPromiseBase : FCoroutinePromiseBase
+{
+	TOptional<T> Value;
+
+	template <typename U = T> requires (CConstructibleFrom<T, U&&>)
+	FORCEINLINE void return_value(U&& InValue) { Value.Emplace(Forward<U>(InValue)); }
+};
+
+template <>
+struct TTaskPromiseBase<void> : FCoroutinePromiseBase
+{
+	FORCEINLINE void return_void() { }
+};
+
+/** The coroutine that starts eagerly and destroys itself when it finishes, which runs the detached tasks. */
+struct FDetachedCoroutine
+{
+	struct promise_type : FCoroutinePromiseBase
+	{
+		FORCEINLINE FDetachedCoroutine get_return_object() { return { }; }
+
+		FORCEINLINE NAMESPACE_STD::suspend_never initial_suspend() { return { }; }
+		FORCEINLINE NAMESPACE_STD::suspend_never final_suspend() noexcept { return { }; }
+
+		FORCEINLINE void return_void() { }
+	};
+};
+
+NAMESPACE_PRIVATE_END
+
+/**
+ * The lazy coroutine task, which starts when it is awaited and resumes the awaiting coroutine when it finishes.
+ * The control is transferred symmetrically between the coroutines, so the long chains of the synchronous completions
+ * do not grow the stack. The frames are allocated by Memory::Malloc(), or by the frame allocator if it is the first
+ * argument of the coroutine, such as TCoroutineArena. Use ResumeOn() to move the coroutine onto a scheduler,
+ * and Spawn(), ToFuture() or SyncWait() to start the task from the non-coroutine code.
+ */
+template <typename T = void>
+class TTask final : private FNoncopyable
+{
+public:
+
+	struct promise_type : NAMESPACE_PRIVATE::TTaskPromiseBase<T>
+	{
+		NAMESPACE_STD::coroutine_handle<> Continuation;
+
+		FORCEINLINE TTask get_return_object() { return TTask(NAMESPACE_STD::coroutine_handle<promise_type>::from_promise(*this)); }
+
+		FORCEINLINE NAMESPACE_STD::suspend_always initial_suspend() { return { }; }
+
+		FORCEINLINE auto final_suspend() noexcept
+		{
+			struct FFinalAwaiter
+			{
+				FORCEINLINE bool await_ready() noexcept { return false; }
+
+				FORCEINLINE NAMESPACE_STD::coroutine_handle<> await_suspend(NAMESPACE_STD::coroutine_handle<promise_type> Handle) noexcept
+				{
+					NAMESPACE_STD::coroutine_handle<> Continuation = Handle.promise().Continuation;
+
+					return Continuation ? Continuation : NAMESPACE_STD::noop_coroutine();
+				}
+
+				FORCEINLINE void await_resume() noexcept { }
+			};
+
+			return FFinalAwaiter { };
+		}
+	};
+
+	using FValueType = T;
+
+	/** Constructs an invalid task. */
+	FORCEINLINE TTask() = default;
+
+	FORCEINLINE TTask(TTask&& InValue) : Handle(Exchange(InValue.Handle, nullptr)) { }
+
+	FORCEINLINE TTask& operator=(TTask&& InValue)
+	{
+		if (&InValue == this) UNLIKELY return *this;
+
+		if (Handle) Handle.destroy();
+
+		Handle = Exchange(InValue.Handle, nullptr);
+
+		return *this;
+	}
+
+	/** Destroys the coroutine frame, which should not be running. */
+	FORCEINLINE ~TTask() { if (Handle) Handle.destroy(); }
+
+	/** @return true if the task refers to a coroutine, false otherwise. */
+	NODISCARD FORCEINLINE bool IsValid() const { return static_cast<bool>(Handle); }
+
+	/** @return true if the coroutine has finished, false otherwise. */
+	NODISCARD FORCEINLINE bool IsDone() const
+	{
+		checkf(IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		return Handle.done();
+	}
+
+	/** Starts the task and suspends the awaiting coroutine until the task finishes, which returns the result of the task. */
+	NODISCARD FORCEINLINE auto operator co_await() &&
+	{
+		checkf(IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+		struct FAwaiter
+		{
+			NAMESPACE_STD::coroutine_handle<promise_type> Handle;
+
+			FORCEINLINE bool await_ready() { return Handle.done(); }
+
+			FORCEINLINE NAMESPACE_STD::coroutine_handle<> await_suspend(NAMESPACE_STD::coroutine_handle<> Continuation)
+			{
+				Handle.promise().Continuation = Continuation;
+
+				return Handle;
+			}
+
+			FORCEINLINE T await_resume()
+			{
+				if constexpr (!CVoid<T>) return MoveTemp(*Handle.promise().Value);
+			}
+		};
+
+		return FAwaiter { Handle };
+	}
+
+private:
+
+	NAMESPACE_STD::coroutine_handle<promise_type> Handle = nullptr;
+
+	FORCEINLINE explicit TTask(NAMESPACE_STD::coroutine_handle<promise_type> InHandle) : Handle(InHandle) { }
+
+};
+
+/**
+ * Suspends the coroutine and resumes it by the scheduler.
+ *
+ * @param Scheduler - The scheduler to resume the coroutine, the task scheduler by default.
+ */
+template <CCoroutineScheduler S = FTaskSchedulerHook>
+NODISCARD FORCEINLINE auto ResumeOn(S Scheduler = { })
+{
+	struct FAwaiter
+	{
+		S Scheduler;
+
+		FORCEINLINE bool await_ready() { return false; }
+
+		FORCEINLINE void await_suspend(NAMESPACE_STD::coroutine_handle<> Handle) { Scheduler.Schedule(Handle); }
+
+		FORCEINLINE void await_resume() { }
+	};
+
+	return FAwaiter { MoveTemp(Scheduler) };
+}
+
+/** Suspends the coroutine until the future is ready, which is resumed as a task on the task scheduler and returns the value. */
+template <typename T>
+NODISCARD FORCEINLINE auto operator co_await(TFuture<T>&& Future)
+{
+	checkf(Future.IsValid(), TEXT("Read access violation. Please check IsValid()."));
+
+	struct FAwaiter
+	{
+		TFuture<T> Future;
+
+		TOptional<NAMESPACE_PRIVATE::TFutureValue<T>> Value;
+
+		FORCEINLINE explicit FAwaiter(TFuture<T>&& InFuture) : Future(MoveTemp(InFuture)) { }
+
+		FORCEINLINE bool await_ready() { return Future.IsReady(); }
+
+		FORCEINLINE void await_suspend(NAMESPACE_STD::coroutine_handle<> Handle)
+		{
+			if constexpr (CVoid<T>) Ignore = Future.Then([Handle] { Handle.resume(); });
+
+			else Ignore = Future.Then([this, Handle](T InValue) { Value.Emplace(MoveTemp(InValue)); Handle.resume(); });
+		}
+
+		FORCEINLINE T await_resume()
+		{
+			if (Future.IsValid()) return Future.Get();
+
+			if constexpr (!CVoid<T>) return MoveTemp(*Value);
+		}
+	};
+
+	return FAwaiter(MoveTemp(Future));
+}
+
+/**
+ * Starts the task as a detached coroutine, which is resumed by the scheduler first.
+ *
+ * @param Task      - The task to start, whose result is discarded.
+ * @param Scheduler - The scheduler to start the task, the task scheduler by default.
+ */
+template <typename T, CCoroutineScheduler S = FTaskSchedulerHook>
+FORCEINLINE void Spawn(TTask<T> Task, S Scheduler = { })
+{
+	[](TTask<T> Task, S Scheduler) -> NAMESPACE_PRIVATE::FDetachedCoroutine
+	{
+		co_await ResumeOn(MoveTemp(Scheduler));
+
+		if constexpr (CVoid<T>) co_await MoveTemp(Task);
+
+		else Ignore = co_await MoveTemp(Task);
+	}
+	(MoveTemp(Task), MoveTemp(Scheduler));
+}
+
+/**
+ * Starts the task on the task scheduler and returns the future of its result.
+ *
+ * @param Task - The task to start.
+ *
+ * @return The future of the result of the task.
+ */
+template <typename T>
+NODISCARD TFuture<T> ToFuture(TTask<T> Task)
+{
+	TPromise<T> Promise;
+
+	TFuture<T> Result = Promise.GetFuture();
+
+	Spawn([](TTask<T> Task, TPromise<T> Promise) -> TTask<>
+	{
+		if constexpr (CVoid<T>) { co_await MoveTemp(Task); Promise.SetValue(); }
+
+		else Promise.SetValue(co_await MoveTemp(Task));
+	}
+	(MoveTemp(Task), MoveTemp(Promise)));
+
+	return Result;
+}
+
+/** Starts the task on the task scheduler and blocks the calling thread until the task finishes, which returns the result of the task. */
+template <typename T>
+NODISCARD FORCEINLINE T SyncWait(TTask<T> Task)
+{
+	return ToFuture(MoveTemp(Task)).Get();
+}
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -0,0 +1,291 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Templates/Utility.h"
+#include "Templates/Function.h"
+#include "Templates/Atomic.h"
+#include "Templates/Noncopyable.h"
+#include "Containers/Array.h"
+#include "Memory/SharedPointer.h"
+#include "Threading/TaskScheduler.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+#include <chrono>
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+NAMESPACE_PRIVATE_BEGIN
+
+struct FTaskGraphNode
+{
+	TFunction<void()> Function;
+
+	TArray<size_t> Successors;
+
+	size_t PredecessorNum = 0;
+
+	TAtomic<size_t> Remaining = 0;
+
+	uint64 StartTime  = 0;
+	uint64 FinishTime = 0;
+
+	FORCEINLINE FTaskGraphNode() = default;
+
+	// The nodes are only moved when the graph is built, so the counters are not running.
+	FORCEINLINE FTaskGraphNode(FTaskGraphNode&& InValue)
+		: Function(MoveTemp(InValue.Function)), Successors(MoveTemp(InValue.Successors)), PredecessorNum(InValue.PredecessorNum)
+	{ }
+
+	FORCEINLINE FTaskGraphNode& operator=(FTaskGraphNode&& InValue)
+	{
+		Function       = MoveTemp(InValue.Function);
+		Successors     = MoveTemp(InValue.Successors);
+		PredecessorNum = InValue.PredecessorNum;
+
+		return *this;
+	}
+};
+
+/** The state of the task graph is shared with the running tasks, since the last task may still touch it after the calling thread has returned. */
+struct FTaskGraphState
+{
+	TArray<FTaskGraphNode> Nodes;
+
+	TArray<size_t> Order;
+
+	bool bCompiled = true;
+
+	TAtomic<size_t> Pending = 0;
+
+	NAMESPACE_STD::chrono::steady_clock::time_point BaseTime;
+};
+
+NAMESPACE_PRIVATE_END
+
+/**
+ * The directed acyclic graph of the tasks, which runs the tasks on the task scheduler once their prerequisites have finished.
+ * The topology and the in-degree counters are reused and reset in place for each execution, but the ready tasks are still
+ * submitted to the task scheduler, which allocates a node for each of them.
+ * The start and finish times of each task are recorded in each execution, which are used to find the critical path.
+ */
+class FTaskGraph final : private FNoncopyable
+{
+public:
+
+	/** Constructs an empty graph. */
+	FTaskGraph() : State(MakeShared<FState>()) { }
+
+	/** Destructs the graph, which should not be executing. */
+	~FTaskGraph() = default;
+
+	/**
+	 * Adds a task to the graph.
+	 *
+	 * @param Function - The function of the task.
+	 *
+	 * @return The index of the task in the graph.
+	 */
+	size_t AddTask(TFunction<void()> Function)
+	{
+		checkf(Function.IsValid(), TEXT("Illegal function. Please check IsValid()."));
+
+		State->Nodes.SetNum(State->Nodes.Num() + 1, false);
+
+		State->Nodes.Back().Function = MoveTemp(Function);
+
+		State->bCompiled = false;
+
+		return State->Nodes.Num() - 1;
+	}
+
+	/**
+	 * Adds a dependency edge to the graph, the dependent task runs after the prerequisite task has finished.
+	 *
+	 * @param Prerequisite - The index of the task that runs first.
+	 * @param Dependent    - The index of the task that runs after the prerequisite.
+	 */
+	void AddDependency(size_t Prerequisite, size_t Dependent)
+	{
+		checkf(Prerequisite < Num() && Dependent < Num(), TEXT("Read access violation. Please check Num()."));
+		checkf(Prerequisite != Dependent, TEXT("The task cannot depend on itself."));
+
+		State->Nodes[Prerequisite].Successors.PushBack(Dependent);
+
+		++State->Nodes[Dependent].PredecessorNum;
+
+		State->bCompiled = false;
+	}
+
+	/** Executes all tasks in the graph and blocks the calling thread until they have finished, which also runs the other tasks while waiting. */
+	void Execute()
+	{
+		FState& Graph = *State;
+
+		if (!Graph.bCompiled) Compile();
+
+		if (Graph.Nodes.IsEmpty()) return;
+
+		for (FNode& Node : Graph.Nodes) Node.Remaining.Store(Node.PredecessorNum, EMemoryOrder::Relaxed);
+
+		Graph.Pending.Store(Graph.Nodes.Num(), EMemoryOrder::Relaxed);
+
+		Graph.BaseTime = NAMESPACE_STD::chrono::steady_clock::now();
+
+		// The roots are the first tasks in the topological order, the first root is run by the calling thread.
+		for (size_t Index = 1; Index != Graph.Order.Num() && Graph.Nodes[Graph.Order[Index]].PredecessorNum == 0; ++Index)
+		{
+			Tasks::Submit([Shared = State, Root = Graph.Order[Index]] { Run(Shared, Root); });
+		}
+
+		Run(State, Graph.Order[0]);
+
+		while (true)
+		{
+			const size_t Pending = Graph.Pending.Load(EMemoryOrder::Acquire);
+
+			if (Pending == 0) break;
+
+			if (!Tasks::TryRunTask()) Graph.Pending.Wait(Pending, EMemoryOrder::Acquire);
+		}
+	}
+
+	/** @return The number of tasks in the graph. */
+	NODISCARD FORCEINLINE size_t Num() const { return State->Nodes.Num(); }
+
+	/** @return The start time of the task in nanoseconds since the last execution started. */
+	NODISCARD FORCEINLINE uint64 GetStartTime(size_t Index) const
+	{
+		checkf(Index < Num(), TEXT("Read access violation. Please check Num()."));
+
+		return State->Nodes[Index].StartTime;
+	}
+
+	/** @return The finish time of the task in nanoseconds since the last execution started. */
+	NODISCARD FORCEINLINE uint64 GetFinishTime(size_t Index) const
+	{
+		checkf(Index < Num(), TEXT("Read access violation. Please check Num()."));
+
+		return State->Nodes[Index].FinishTime;
+	}
+
+	/** @return The path of the tasks with the longest total duration in the last execution, from the first task to the last. */
+	NODISCARD TArray<size_t> GetCriticalPath() const
+	{
+		const FState& Graph = *State;
+
+		checkf(Graph.bCompiled, TEXT("The graph has not been executed since it was changed."));
+
+		if (Graph.Nodes.IsEmpty()) return TArray<size_t>();
+
+		TArray<uint64> Length(Graph.Nodes.Num(), 0);
+		TArray<size_t> Previous(Graph.Nodes.Num(), INDEX_NONE);
+
+		size_t Last = Graph.Order[0];
+
+		for (size_t Index : Graph.Order)
+		{
+			const FNode& Node = Graph.Nodes[Index];
+
+			Length[Index] += Node.FinishTime - Node.StartTime;
+
+			if (Length[Index] > Length[Last]) Last = Index;
+
+			for (size_t Successor : Node.Successors)
+			{
+				if (Previous[Successor] == INDEX_NONE || Length[Index] > Length[Previous[Successor]])
+				{
+					Length[Successor] = Length[Index];
+					Previous[Successor] = Index;
+				}
+			}
+		}
+
+		TArray<size_t> Result;
+
+		for (size_t Index = Last; Index != INDEX_NONE; Index = Previous[Index]) Result.PushBack(Index);
+
+		for (size_t Index = 0; Index != Result.Num() / 2; ++Index) Swap(Result[Index], Result[Result.Num() - Index - 1]);
+
+		return Result;
+	}
+
+private:
+
+	using FNode  = NAMESPACE_PRIVATE::FTaskGraphNode;
+	using FState = NAMESPACE_PRIVATE::FTaskGraphState;
+
+	TSharedRef<FState> State;
+
+	/** Sorts the tasks topologically by Kahn's algorithm, which checks that the graph is acyclic. */
+	void Compile()
+	{
+		FState& Graph = *State;
+
+		Graph.Order.Reset(false);
+
+		Graph.Order.Reserve(Graph.Nodes.Num());
+
+		TArray<size_t> InDegree(Graph.Nodes.Num());
+
+		for (size_t Index = 0; Index != Graph.Nodes.Num(); ++Index)
+		{
+			InDegree[Index] = Graph.Nodes[Index].PredecessorNum;
+
+			if (InDegree[Index] == 0) Graph.Order.PushBack(Index);
+		}
+
+		for (size_t Cursor = 0; Cursor != Graph.Order.Num(); ++Cursor)
+		{
+			for (size_t Successor : Graph.Nodes[Graph.Order[Cursor]].Successors)
+			{
+				if (--InDegree[Successor] == 0) Graph.Order.PushBack(Successor);
+			}
+		}
+
+		checkf(Graph.Order.Num() == Graph.Nodes.Num(), TEXT("The task graph must be acyclic."));
+
+		Graph.bCompiled = true;
+	}
+
+	/** Runs the task and its successors that become ready, one of which is run in place and the others are submitted. */
+	static void Run(const TSharedRef<FState>& Shared, size_t Index)
+	{
+		FState& Graph = *Shared;
+
+		auto Now = [&Graph]
+		{
+			return static_cast<uint64>(NAMESPACE_STD::chrono::duration_cast<NAMESPACE_STD::chrono::nanoseconds>(NAMESPACE_STD::chrono::steady_clock::now() - Graph.BaseTime).count());
+		};
+
+		while (Index != INDEX_NONE)
+		{
+			FNode& Node = Graph.Nodes[Index];
+
+			Node.StartTime = Now();
+
+			Node.Function();
+
+			Node.FinishTime = Now();
+
+			Index = INDEX_NONE;
+
+			for (size_t Successor : Node.Successors)
+			{
+				if (Graph.Nodes[Successor].Remaining.FetchSub(1, EMemoryOrder::AcquireRelease) != 1) continue;
+
+				if (Index != INDEX_NONE) Tasks::Submit([Shared, Index] { Run(Shared, Index); });
+
+				Index = Successor;
+			}
+
+			if (Graph.Pending.FetchSub(1, EMemoryOrder::AcquireRelease) == 1) Graph.Pending.Notify(true);
+		}
+	}
+
+};
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "TypeTraits/TypeTraits.h"
+#include "Templates/Utility.h"
+#include "Templates/Function.h"
+#include "Miscellaneous/AssertionMacros.h"
+
+NAMESPACE_REDCRAFT_BEGIN
+NAMESPACE_MODULE_BEGIN(Redcraft)
+NAMESPACE_MODULE_BEGIN(Utility)
+
+/**
+ * The task scheduler is a single work-stealing thread pool shared by the whole library, which has a worker thread less than
+ * the hardware concurrency since the waiting threads also run the tasks. Each worker owns a Chase-Lev deque, where it pushes and
+ * pops its own tasks at the bottom in LIFO order, and the idle workers steal the oldest tasks from the top of the others.
+ * The tasks submitted from the other threads go into a global injection queue in FIFO order. The idle workers spin
+ * for a while and then park on an atomic wait, and each submission wakes a parked worker if there is one.
+ */
+NAMESPACE_BEGIN(Tasks)
+
+/** @return The number of worker threads of the task scheduler, excluding the calling thread. */
+NODISCARD REDCRAFTUTILITY_API size_t GetWorkerNum();
+
+/** @return true if the calling thread is a worker thread of the task scheduler, false otherwise. */
+NODISCARD REDCRAFTUTILITY_API bool IsWorkerThread();
+
+/**
+ * Submits the task to the task scheduler. If it is called from a worker thread, the task is pushed into the deque of the worker
+ * and will be run by the worker soon unless it is stolen, otherwise the task is pushed into the injection queue.
+ * If there are no worker threads, the task is run by the threads that wait for the tasks.
+ *
+ * @param Task - The task to run, which should not be empty.
+ */
+REDCRAFTUTILITY_API void Submit(TUniqueFunction<void()> Task);
+
+/**
+ * Runs a pending task on the calling thread if there is one, which is taken from the deque of the calling worker first,
+ * then from the injection queue, and finally stolen from the other workers.
+ *
+ * @return true if a task was run, false if no pending task was found.
+ */
+REDCRAFTUTILITY_API bool TryRunTask();
+
+/**
+ * Runs the pending tasks on the calling thread until the predicate is satisfied, and yields the thread if there is nothing to run.
+ * It should be used instead of blocking to wait for the tasks, which would deadlock if all worker threads were blocked.
+ *
+ * @param Predicate - The predicate to check, which is checked between the tasks.
+ */
+REDCRAFTUTILITY_API void RunUntil(TFunctionRef<bool()> Predicate);
+
+NAMESPACE_END(Tasks)
+
+NAMESPACE_MODULE_END(Utility)
+NAMESPACE_MODULE_END(Redcraft)
+NAMESPACE_REDCRAFT_END
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Threading/TaskScheduler.h"
+#include "Threading/Future.h"
+#include "Threading/Task.h"
+#include "Threading/TaskGraph.h"
+#include "Threading/Mutex.h"
+#include "Threading/PerThread.h"
+#include "Threading/Reclamation.h"
+#include "Threading/EventLoop.h"
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Redcraft.Utility/Source/Private/Algorithms/ExecutionPolicy.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Algorithms/ExecutionPolicy.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Algorithms/ExecutionPolicy.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Memory/Memory.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Memory/Memory.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Memory/Memory.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Miscellaneous/Console.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Miscellaneous/Console.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Miscellaneous/Console.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Miscellaneous/FileSystem.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Miscellaneous/FileSystem.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Miscellaneous/FileSystem.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Numerics/Random.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Numerics/Random.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Numerics/Random.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Templates/TypeHash.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Templates/TypeHash.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Templates/TypeHash.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Algorithms.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Algorithms.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Algorithms.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Containers.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Containers.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Containers.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Iterators.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Iterators.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Iterators.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Memory.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Memory.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Memory.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Miscellaneous.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Miscellaneous.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Miscellaneous.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Numerics.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Numerics.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Numerics.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Ranges.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Ranges.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Ranges.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Strings.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Strings.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Strings.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Templates.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Templates.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Templates.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/Threading.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Threading.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Threading.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Testing/TypeTraits.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/TypeTraits.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/TypeTraits.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Threading/PerThread.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Threading/PerThread.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Threading/PerThread.cpp.o.d"
+  "/root/repo/Redcraft.Utility/Source/Private/Threading/TaskScheduler.cpp" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Threading/TaskScheduler.cpp.o" "gcc" "Redcraft.Utility/CMakeFiles/Redcraft.Utility.dir/Source/Private/Threading/TaskScheduler.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../Build/libRedcraft.Utility.pdb"
+  "../Build/libRedcraft.Utility.so"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Algorithms/ExecutionPolicy.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Algorithms/ExecutionPolicy.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Memory/Memory.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Memory/Memory.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Miscellaneous/Console.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Miscellaneous/Console.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Miscellaneous/FileSystem.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Miscellaneous/FileSystem.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Numerics/Random.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Numerics/Random.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Templates/TypeHash.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Templates/TypeHash.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Algorithms.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Algorithms.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Containers.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Containers.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Iterators.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Iterators.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Memory.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Memory.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Miscellaneous.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Miscellaneous.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Numerics.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Numerics.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Ranges.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Ranges.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Strings.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Strings.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Templates.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Templates.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Threading.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/Threading.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/TypeTraits.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Testing/TypeTraits.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Threading/PerThread.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Threading/PerThread.cpp.o.d"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Threading/TaskScheduler.cpp.o"
+  "CMakeFiles/Redcraft.Utility.dir/Source/Private/Threading/TaskScheduler.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Redcraft.Utility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()